@@ -363,6 +363,95 @@ Alx_Status AlxMmc_WriteBlock(AlxMmc* me, uint32_t numOfBlocks, uint32_t addr, ui
 	// Return
 	return Alx_ErrNumOfTries;
 }
+Alx_Status AlxMmc_EraseBlock(AlxMmc* me, uint32_t numOfBlocks, uint32_t addr, uint8_t numOfTries, uint16_t newTryWaitTime_ms)
+{
+	//------------------------------------------------------------------------------
+	// Assert
+	//------------------------------------------------------------------------------
+	ALX_MMC_ASSERT(me->wasCtorCalled == true);
+	ALX_MMC_ASSERT(me->isInit == true);
+	ALX_MMC_ASSERT(numOfBlocks > 0);
+
+
+	//------------------------------------------------------------------------------
+	// Local Variables
+	//------------------------------------------------------------------------------
+	HAL_StatusTypeDef statusHal = HAL_ERROR;
+	Alx_Status statusAlx = Alx_Err;
+
+
+	//------------------------------------------------------------------------------
+	// Check
+	//------------------------------------------------------------------------------
+
+	// Erase is only a hint to card, ERASE command (CMD38 arg 0x0) works on whole erase groups & would also erase live neighbouring blocks, so if TRIM is NOT available, do nothing
+	#if !defined(HAL_MMC_TRIM)
+	(void)statusHal;
+	(void)statusAlx;
+	(void)addr;
+	(void)numOfTries;
+	(void)newTryWaitTime_ms;
+	return Alx_Ok;
+	#else
+
+
+	//------------------------------------------------------------------------------
+	// Try
+	//------------------------------------------------------------------------------
+
+	// Try for number of tries
+	for (uint32_t _try = 1; _try <= numOfTries; _try++)
+	{
+		// Trim - Sends ERASE_GROUP_START, ERASE_GROUP_END & ERASE with TRIM arg (CMD38 arg 0x1), which works on write blocks, so only specified blocks are reclaimed by card
+		statusHal = HAL_MMC_EraseSequence(&me->hmmc, HAL_MMC_TRIM, addr, addr + numOfBlocks - 1);
+		#if defined(HAL_MMC_ERROR_UNSUPPORTED_FEATURE)
+		if ((statusHal != HAL_OK) && ((HAL_MMC_GetError(&me->hmmc) & HAL_MMC_ERROR_UNSUPPORTED_FEATURE) != 0))
+		{
+			// Card older than eMMC 4.4 without TRIM, nothing was sent
+			return Alx_Ok;
+		}
+		#endif
+		if (statusHal != HAL_OK)
+		{
+			ALX_MMC_TRACE_WRN("Err: %d, try=%u, numOfBlocks=%u, addr=%u", statusHal, _try, numOfBlocks, addr);
+			statusAlx = AlxMmc_ReInit(me);
+			if (statusAlx != Alx_Ok)
+			{
+				ALX_MMC_TRACE_WRN("Err: %d", statusAlx);
+				return Alx_Err;
+			}
+			AlxDelay_ms(newTryWaitTime_ms);
+			continue;
+		}
+
+		// Wait
+		statusAlx = AlxMmc_WaitForTransferState_Private(me);
+		if (statusAlx != Alx_Ok)
+		{
+			ALX_MMC_TRACE_WRN("Err: %d, try=%u, numOfBlocks=%u, addr=%u", statusAlx, _try, numOfBlocks, addr);
+			statusAlx = AlxMmc_ReInit(me);
+			if (statusAlx != Alx_Ok)
+			{
+				ALX_MMC_TRACE_WRN("Err: %d", statusAlx);
+				return Alx_Err;
+			}
+			AlxDelay_ms(newTryWaitTime_ms);
+			continue;
+		}
+
+		// Return
+		return Alx_Ok;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Catch
+	//------------------------------------------------------------------------------
+
+	// Return
+	return Alx_ErrNumOfTries;
+	#endif
+}
 Alx_Status AlxMmc_WaitForTransferState(AlxMmc* me)
 {
 	// Assert
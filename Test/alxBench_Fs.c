@@ -0,0 +1,142 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxBench_Fs.c
+  * @brief		Auralix C Library - ALX File System Module - Host Benchmark
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Defines
+//******************************************************************************
+#define ALX_BENCH_FS_NUM_OF_RECS 20000
+#define ALX_BENCH_FS_REC_LEN 64
+#define ALX_BENCH_FS_SYNC_PERIOD 32	// Logger syncs every this many records
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxMmc alxMmc = {};
+static AlxFs alxFs = {};
+static uint32_t latencyArr_ns[ALX_BENCH_FS_NUM_OF_RECS] = {};
+static uint32_t latencyArr_blocks[ALX_BENCH_FS_NUM_OF_RECS] = {};
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxBench_Fs_Setup(void)
+{
+	AlxTest_Mmc_Clear();
+	AlxTest_OsMutex_Clear();
+	AlxFs_Ctor(&alxFs, AlxFs_Config_Fatfs_Mmc, &alxMmc, NULL, NULL, NULL, NULL, NULL);
+	ALX_TEST_CHECK(AlxFs_Format(&alxFs) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_Mount(&alxFs) == Alx_Ok);
+}
+
+
+//******************************************************************************
+// Benchmarks
+//******************************************************************************
+static void AlxBench_Fs_Log(bool isMaintenance)
+{
+	// Setup
+	AlxBench_Fs_Setup();
+	AlxFs_File file = {};
+	uint8_t rec[ALX_BENCH_FS_REC_LEN] = {};
+	uint32_t numOfWrittenBlocks_Maintenance = 0;
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "log.bin", "w") == Alx_Ok);
+
+	// Append records, latency of write path is write & periodic sync, as logger sees it
+	for (uint32_t i = 0; i < ALX_BENCH_FS_NUM_OF_RECS; i++)
+	{
+		// Write
+		memset(rec, (int)(i & 0xFF), sizeof(rec));
+		uint32_t numOfWrittenBlocks = alxTest_mmc.numOfWrittenBlocks;
+		uint64_t t_ns = AlxTest_Bench_GetTime_ns();
+		ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &file, rec, sizeof(rec)) == Alx_Ok);
+		if ((i % ALX_BENCH_FS_SYNC_PERIOD) == (ALX_BENCH_FS_SYNC_PERIOD - 1))
+		{
+			ALX_TEST_CHECK(AlxFs_File_Sync(&alxFs, &file) == Alx_Ok);
+		}
+		latencyArr_ns[i] = (uint32_t)(AlxTest_Bench_GetTime_ns() - t_ns);
+		latencyArr_blocks[i] = alxTest_mmc.numOfWrittenBlocks - numOfWrittenBlocks;
+
+		// Idle, maintenance between records, as idle priority thread would run it
+		if (isMaintenance)
+		{
+			numOfWrittenBlocks = alxTest_mmc.numOfWrittenBlocks;
+			ALX_TEST_CHECK(AlxFs_Maintenance(&alxFs, 10) == Alx_Ok);
+			numOfWrittenBlocks_Maintenance = numOfWrittenBlocks_Maintenance + (alxTest_mmc.numOfWrittenBlocks - numOfWrittenBlocks);
+		}
+	}
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+
+	// Print, time is host RAM disk time, blocks written in write path are what stalls logger on real card
+	const char* name = isMaintenance ? "with maintenance" : "without maintenance";
+	printf("BENCH: Fs log %-19s blocks written/write p50 %u p99 %u max %u, in maintenance %u\r\n",
+		name,
+		(unsigned int)AlxTest_Bench_Percentile(latencyArr_blocks, ALX_BENCH_FS_NUM_OF_RECS, 50),
+		(unsigned int)AlxTest_Bench_Percentile(latencyArr_blocks, ALX_BENCH_FS_NUM_OF_RECS, 99),
+		(unsigned int)AlxTest_Bench_Percentile(latencyArr_blocks, ALX_BENCH_FS_NUM_OF_RECS, 100),
+		(unsigned int)numOfWrittenBlocks_Maintenance);
+	printf("BENCH: Fs log %-19s us/write p50 %.2f p99 %.2f max %.2f\r\n",
+		name,
+		(double)AlxTest_Bench_Percentile(latencyArr_ns, ALX_BENCH_FS_NUM_OF_RECS, 50) / 1000.0,
+		(double)AlxTest_Bench_Percentile(latencyArr_ns, ALX_BENCH_FS_NUM_OF_RECS, 99) / 1000.0,
+		(double)AlxTest_Bench_Percentile(latencyArr_ns, ALX_BENCH_FS_NUM_OF_RECS, 100) / 1000.0);
+}
+static void AlxBench_Fs_Log_WithoutMaintenance(void)
+{
+	AlxBench_Fs_Log(false);
+}
+static void AlxBench_Fs_Log_WithMaintenance(void)
+{
+	AlxBench_Fs_Log(true);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxBench_Fs_Log_WithoutMaintenance);
+	ALX_TEST_RUN(AlxBench_Fs_Log_WithMaintenance);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
@@ -0,0 +1,330 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxBench_ParamItem.c
+  * @brief		Auralix C Library - ALX Parameter Item Module - Host Benchmark
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxParamItem.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Defines
+//******************************************************************************
+#define ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS 1000
+#define ALX_BENCH_PARAM_ITEM_NUM_OF_REPEATS 100
+#define ALX_BENCH_PARAM_ITEM_STR_LEN 32
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxParamItem itemArr[ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS] = {};
+static uint8_t itemBuffArr[ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS][ALX_BENCH_PARAM_ITEM_STR_LEN] = {};
+static uint8_t itemDefBuffArr[ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS][ALX_BENCH_PARAM_ITEM_STR_LEN] = {};
+static char strArr[ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS][ALX_BENCH_PARAM_ITEM_STR_LEN] = {};
+static bool isValTypical = false;	// Float & Double values in [-1000, 1000) instead of random bits over whole range
+static volatile uint64_t sink = 0;	// Keeps libc reference results, so that they are not optimized out
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static uint64_t AlxBench_ParamItem_Rand(void)
+{
+	static uint64_t state = 0x9E3779B97F4A7C15;
+	state = state ^ (state << 13);
+	state = state ^ (state >> 7);
+	state = state ^ (state << 17);
+	return state;
+}
+static const char* AlxBench_ParamItem_GetDataTypeStr(AlxParamItem_DataType dataType)
+{
+	switch (dataType)
+	{
+		case AlxParamItem_Uint8: return "Uint8";
+		case AlxParamItem_Uint16: return "Uint16";
+		case AlxParamItem_Uint32: return "Uint32";
+		case AlxParamItem_Uint64: return "Uint64";
+		case AlxParamItem_Int8: return "Int8";
+		case AlxParamItem_Int16: return "Int16";
+		case AlxParamItem_Int32: return "Int32";
+		case AlxParamItem_Int64: return "Int64";
+		case AlxParamItem_Float: return "Float";
+		case AlxParamItem_Double: return "Double";
+		case AlxParamItem_Bool: return "Bool";
+		case AlxParamItem_Arr: return "Arr";
+		case AlxParamItem_Str: return "Str";
+		default: return "";
+	}
+}
+static void AlxBench_ParamItem_Setup(AlxParamItem_DataType dataType)
+{
+	// Items over whole range, set to random values
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS; i++)
+	{
+		AlxParamItem* item = &itemArr[i];
+		uint64_t rand = AlxBench_ParamItem_Rand();
+		switch (dataType)
+		{
+			case AlxParamItem_Uint8:
+				AlxParamItem_CtorUint8(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, 0, UINT8_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValUint8(item, (uint8_t)rand);
+				break;
+			case AlxParamItem_Uint16:
+				AlxParamItem_CtorUint16(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, 0, UINT16_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValUint16(item, (uint16_t)rand);
+				break;
+			case AlxParamItem_Uint32:
+				AlxParamItem_CtorUint32(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, 0, UINT32_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValUint32(item, (uint32_t)rand);
+				break;
+			case AlxParamItem_Uint64:
+				AlxParamItem_CtorUint64(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, 0, UINT64_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValUint64(item, rand);
+				break;
+			case AlxParamItem_Int8:
+				AlxParamItem_CtorInt8(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, INT8_MIN, INT8_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValInt8(item, (int8_t)rand);
+				break;
+			case AlxParamItem_Int16:
+				AlxParamItem_CtorInt16(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, INT16_MIN, INT16_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValInt16(item, (int16_t)rand);
+				break;
+			case AlxParamItem_Int32:
+				AlxParamItem_CtorInt32(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, INT32_MIN, INT32_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValInt32(item, (int32_t)rand);
+				break;
+			case AlxParamItem_Int64:
+				AlxParamItem_CtorInt64(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, INT64_MIN, INT64_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValInt64(item, (int64_t)rand);
+				break;
+			case AlxParamItem_Float:
+			{
+				uint32_t bits = (uint32_t)rand & 0xFF7FFFFF;	// Exponent below inf/nan
+				float val = 0;
+				memcpy(&val, &bits, sizeof(val));
+				if (isValTypical)
+				{
+					val = (float)((double)(rand >> 11) / 9007199254740992.0 * 2000 - 1000);
+				}
+				AlxParamItem_CtorFloat(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, -FLT_MAX, FLT_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValFloat(item, val);
+				break;
+			}
+			case AlxParamItem_Double:
+			{
+				uint64_t bits = rand & 0xFFEFFFFFFFFFFFFF;	// Exponent below inf/nan
+				double val = 0;
+				memcpy(&val, &bits, sizeof(val));
+				if (isValTypical)
+				{
+					val = (double)(rand >> 11) / 9007199254740992.0 * 2000 - 1000;
+				}
+				AlxParamItem_CtorDouble(item, NULL, AlxParamItem_Param, "item", i, "group", 1, 0, -DBL_MAX, DBL_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+				AlxParamItem_SetValDouble(item, val);
+				break;
+			}
+			case AlxParamItem_Bool:
+				AlxParamItem_CtorBool(item, NULL, AlxParamItem_Param, "item", i, "group", 1, false, "", false);
+				AlxParamItem_SetValBool(item, (rand & 1) != 0);
+				break;
+			case AlxParamItem_Arr:
+				memset(itemDefBuffArr[i], 0, ALX_BENCH_PARAM_ITEM_STR_LEN);
+				AlxParamItem_CtorArr(item, NULL, AlxParamItem_Param, "item", i, "group", 1, itemDefBuffArr[i], itemBuffArr[i], itemDefBuffArr[i], ALX_BENCH_PARAM_ITEM_STR_LEN, AlxParamItem_Ignore, "", false);
+				memset(strArr[i], (int)(rand & 0xFF), ALX_BENCH_PARAM_ITEM_STR_LEN);
+				AlxParamItem_SetValArr(item, strArr[i]);
+				break;
+			case AlxParamItem_Str:
+			{
+				char val[ALX_BENCH_PARAM_ITEM_STR_LEN] = "";
+				uint32_t len = 1 + (uint32_t)(rand % (ALX_BENCH_PARAM_ITEM_STR_LEN - 1));
+				memset(val, 'a' + (int)(rand % 26), len - 1);
+				AlxParamItem_CtorStr(item, NULL, AlxParamItem_Param, "item", i, "group", 1, "", AlxParamItem_Ignore, "", false, itemBuffArr[i], ALX_BENCH_PARAM_ITEM_STR_LEN);
+				AlxParamItem_SetValToDef(item);
+				AlxParamItem_SetValStr(item, val);
+				break;
+			}
+			default:
+				break;
+		}
+	}
+}
+static void AlxBench_ParamItem_Libc_Format(AlxParamItem* item, AlxParamItem_DataType dataType, char* str)
+{
+	// Reference, printf formatting, as used before allocation-free formatters
+	switch (dataType)
+	{
+		case AlxParamItem_Uint8: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%u", (unsigned int)AlxParamItem_GetValUint8(item)); break;
+		case AlxParamItem_Uint16: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%u", (unsigned int)AlxParamItem_GetValUint16(item)); break;
+		case AlxParamItem_Uint32: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%" PRIu32, AlxParamItem_GetValUint32(item)); break;
+		case AlxParamItem_Uint64: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%" PRIu64, AlxParamItem_GetValUint64(item)); break;
+		case AlxParamItem_Int8: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%d", (int)AlxParamItem_GetValInt8(item)); break;
+		case AlxParamItem_Int16: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%d", (int)AlxParamItem_GetValInt16(item)); break;
+		case AlxParamItem_Int32: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%" PRId32, AlxParamItem_GetValInt32(item)); break;
+		case AlxParamItem_Int64: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%" PRId64, AlxParamItem_GetValInt64(item)); break;
+		case AlxParamItem_Float: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%.9g", (double)AlxParamItem_GetValFloat(item)); break;
+		case AlxParamItem_Double: snprintf(str, ALX_BENCH_PARAM_ITEM_STR_LEN, "%.17g", AlxParamItem_GetValDouble(item)); break;
+		case AlxParamItem_Bool: strcpy(str, AlxParamItem_GetValBool(item) ? "true" : "false"); break;
+		case AlxParamItem_Str: AlxParamItem_GetValStr(item, str, ALX_BENCH_PARAM_ITEM_STR_LEN); break;
+		default: break;
+	}
+}
+static void AlxBench_ParamItem_Libc_Parse(AlxParamItem_DataType dataType, const char* str)
+{
+	// Reference, strto* parsing without range check
+	switch (dataType)
+	{
+		case AlxParamItem_Uint8:
+		case AlxParamItem_Uint16:
+		case AlxParamItem_Uint32:
+		case AlxParamItem_Uint64: sink = sink + strtoull(str, NULL, 10); break;
+		case AlxParamItem_Int8:
+		case AlxParamItem_Int16:
+		case AlxParamItem_Int32:
+		case AlxParamItem_Int64: sink = sink + (uint64_t)strtoll(str, NULL, 10); break;
+		case AlxParamItem_Float: sink = sink + (uint64_t)(strtof(str, NULL) != 0); break;
+		case AlxParamItem_Double: sink = sink + (uint64_t)(strtod(str, NULL) != 0); break;
+		case AlxParamItem_Bool: sink = sink + (uint64_t)(strcmp(str, "true") == 0); break;
+		case AlxParamItem_Str: sink = sink + strlen(str); break;
+		default: break;
+	}
+}
+
+
+//******************************************************************************
+// Benchmarks
+//******************************************************************************
+static void AlxBench_ParamItem_StrFormat(AlxParamItem_DataType dataType)
+{
+	// Setup
+	AlxBench_ParamItem_Setup(dataType);
+	uint32_t numOfOps = ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS * ALX_BENCH_PARAM_ITEM_NUM_OF_REPEATS;
+	uint64_t t_ns = 0;
+	double format_ns = 0;
+	double parse_ns = 0;
+	double libcFormat_ns = 0;
+	double libcParse_ns = 0;
+
+	// Arr has no string format, raw get & set is measured instead
+	if (dataType == AlxParamItem_Arr)
+	{
+		uint8_t val[ALX_BENCH_PARAM_ITEM_STR_LEN] = {};
+		t_ns = AlxTest_Bench_GetTime_ns();
+		for (uint32_t r = 0; r < ALX_BENCH_PARAM_ITEM_NUM_OF_REPEATS; r++)
+		{
+			for (uint32_t i = 0; i < ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS; i++)
+			{
+				AlxParamItem_GetValArr(&itemArr[i], val);
+				AlxParamItem_SetValArr(&itemArr[i], val);
+			}
+		}
+		printf("BENCH: ParamItem %-6s %-7s raw get & set %8.1f ns/op, no string format\r\n", AlxBench_ParamItem_GetDataTypeStr(dataType), "", (double)(AlxTest_Bench_GetTime_ns() - t_ns) / numOfOps);
+		return;
+	}
+
+	// Format
+	t_ns = AlxTest_Bench_GetTime_ns();
+	for (uint32_t r = 0; r < ALX_BENCH_PARAM_ITEM_NUM_OF_REPEATS; r++)
+	{
+		for (uint32_t i = 0; i < ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS; i++)
+		{
+			ALX_TEST_CHECK(AlxParamItem_GetVal_StrFormat(&itemArr[i], strArr[i], ALX_BENCH_PARAM_ITEM_STR_LEN) == Alx_Ok);
+		}
+	}
+	format_ns = (double)(AlxTest_Bench_GetTime_ns() - t_ns) / numOfOps;
+
+	// Parse, value is same, so only conversion & check is measured
+	t_ns = AlxTest_Bench_GetTime_ns();
+	for (uint32_t r = 0; r < ALX_BENCH_PARAM_ITEM_NUM_OF_REPEATS; r++)
+	{
+		for (uint32_t i = 0; i < ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS; i++)
+		{
+			ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&itemArr[i], strArr[i]) == Alx_Ok);
+		}
+	}
+	parse_ns = (double)(AlxTest_Bench_GetTime_ns() - t_ns) / numOfOps;
+
+	// Reference format
+	char str[ALX_BENCH_PARAM_ITEM_STR_LEN] = "";
+	t_ns = AlxTest_Bench_GetTime_ns();
+	for (uint32_t r = 0; r < ALX_BENCH_PARAM_ITEM_NUM_OF_REPEATS; r++)
+	{
+		for (uint32_t i = 0; i < ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS; i++)
+		{
+			AlxBench_ParamItem_Libc_Format(&itemArr[i], dataType, str);
+			sink = sink + (uint8_t)str[0];
+		}
+	}
+	libcFormat_ns = (double)(AlxTest_Bench_GetTime_ns() - t_ns) / numOfOps;
+
+	// Reference parse
+	t_ns = AlxTest_Bench_GetTime_ns();
+	for (uint32_t r = 0; r < ALX_BENCH_PARAM_ITEM_NUM_OF_REPEATS; r++)
+	{
+		for (uint32_t i = 0; i < ALX_BENCH_PARAM_ITEM_NUM_OF_ITEMS; i++)
+		{
+			AlxBench_ParamItem_Libc_Parse(dataType, strArr[i]);
+		}
+	}
+	libcParse_ns = (double)(AlxTest_Bench_GetTime_ns() - t_ns) / numOfOps;
+
+	// Print
+	printf("BENCH: ParamItem %-6s %-7s format %8.1f ns/op parse %8.1f ns/op, libc format %8.1f ns/op parse %8.1f ns/op\r\n", AlxBench_ParamItem_GetDataTypeStr(dataType), isValTypical ? "typical" : "", format_ns, parse_ns, libcFormat_ns, libcParse_ns);
+}
+static void AlxBench_ParamItem_StrFormat_All(void)
+{
+	for (uint32_t dataType = AlxParamItem_Uint8; dataType <= AlxParamItem_Str; dataType++)
+	{
+		AlxBench_ParamItem_StrFormat((AlxParamItem_DataType)dataType);
+	}
+
+	// Float & Double with typical values, random bits are mostly huge or tiny numbers with long shortest representation
+	isValTypical = true;
+	AlxBench_ParamItem_StrFormat(AlxParamItem_Float);
+	AlxBench_ParamItem_StrFormat(AlxParamItem_Double);
+	isValTypical = false;
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxBench_ParamItem_StrFormat_All);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
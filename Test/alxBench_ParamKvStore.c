@@ -0,0 +1,173 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxBench_ParamKvStore.c
+  * @brief		Auralix C Library - ALX Parameter Key-Value Store Module - Host Benchmark
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxParamKvStore.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Defines
+//******************************************************************************
+#define ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS 200
+#define ALX_BENCH_PARAM_KV_STORE_NUM_OF_UPDATES 1000
+#if defined(ALX_PARAM_KV_STORE_LOG)
+#define ALX_BENCH_PARAM_KV_STORE_BACKEND "log"
+#else
+#define ALX_BENCH_PARAM_KV_STORE_BACKEND "file per key"
+#endif
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxMmc alxMmc = {};
+static AlxFs alxFs = {};
+static AlxParamKvStore paramKvStore = {};
+#if defined(ALX_PARAM_KV_STORE_LOG)
+static AlxParamKvStore_LogIndexEntry logIndex[2 * ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS] = {};
+static uint8_t logBuff[256] = {};
+#endif
+static char keyArr[ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS][16] = {};
+static uint64_t t_ns = 0;
+static uint32_t numOfReadBlocks = 0;
+static uint32_t numOfWrittenBlocks = 0;
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxBench_ParamKvStore_Setup(void)
+{
+	AlxTest_Mmc_Clear();
+	AlxTest_OsMutex_Clear();
+	AlxFs_Ctor(&alxFs, AlxFs_Config_Fatfs_Mmc, &alxMmc, NULL, NULL, NULL, NULL, NULL);
+	ALX_TEST_CHECK(AlxFs_Format(&alxFs) == Alx_Ok);
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	AlxParamKvStore_Ctor(&paramKvStore, logIndex, ALX_ARR_LEN(logIndex), logBuff, sizeof(logBuff), &alxFs);
+	#else
+	AlxParamKvStore_Ctor(&paramKvStore, &alxFs);
+	#endif
+	ALX_TEST_CHECK(AlxParamKvStore_Init(&paramKvStore) == Alx_Ok);
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS; i++)
+	{
+		snprintf(keyArr[i], sizeof(keyArr[i]), "key%03u", (unsigned int)i);
+	}
+}
+static void AlxBench_ParamKvStore_Start(void)
+{
+	numOfReadBlocks = alxTest_mmc.numOfReadBlocks;
+	numOfWrittenBlocks = alxTest_mmc.numOfWrittenBlocks;
+	t_ns = AlxTest_Bench_GetTime_ns();
+}
+static void AlxBench_ParamKvStore_Stop(const char* name, uint32_t numOfOps)
+{
+	// Time is host RAM disk time, block counts are device independent
+	double t_us = (double)(AlxTest_Bench_GetTime_ns() - t_ns) / 1000.0;
+	printf("BENCH: ParamKvStore %-12s %-16s %9.2f us/op %8.2f blocks read/op %8.2f blocks written/op\r\n",
+		ALX_BENCH_PARAM_KV_STORE_BACKEND,
+		name,
+		t_us / numOfOps,
+		(double)(alxTest_mmc.numOfReadBlocks - numOfReadBlocks) / numOfOps,
+		(double)(alxTest_mmc.numOfWrittenBlocks - numOfWrittenBlocks) / numOfOps);
+}
+
+
+//******************************************************************************
+// Benchmarks
+//******************************************************************************
+static void AlxBench_ParamKvStore(void)
+{
+	// Setup
+	AlxBench_ParamKvStore_Setup();
+	uint32_t val = 0;
+	uint32_t lenActual = 0;
+
+	// Store all, as AlxParamMgmt_StoreVal_All does
+	AlxBench_ParamKvStore_Start();
+	ALX_TEST_CHECK(AlxParamKvStore_BeginBatch(&paramKvStore) == Alx_Ok);
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS; i++)
+	{
+		val = i;
+		ALX_TEST_CHECK(AlxParamKvStore_Set(&paramKvStore, keyArr[i], &val, sizeof(val)) == Alx_Ok);
+	}
+	ALX_TEST_CHECK(AlxParamKvStore_Commit(&paramKvStore) == Alx_Ok);
+	AlxBench_ParamKvStore_Stop("set all", ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS);
+
+	// Update single keys, as value changes are stored one by one
+	AlxBench_ParamKvStore_Start();
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_KV_STORE_NUM_OF_UPDATES; i++)
+	{
+		val = i;
+		ALX_TEST_CHECK(AlxParamKvStore_Set(&paramKvStore, keyArr[(i * 7) % ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS], &val, sizeof(val)) == Alx_Ok);
+	}
+	AlxBench_ParamKvStore_Stop("set one", ALX_BENCH_PARAM_KV_STORE_NUM_OF_UPDATES);
+
+	// Load all after reboot, init & get all
+	ALX_TEST_CHECK(AlxParamKvStore_DeInit(&paramKvStore) == Alx_Ok);
+	AlxBench_ParamKvStore_Start();
+	ALX_TEST_CHECK(AlxParamKvStore_Init(&paramKvStore) == Alx_Ok);
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS; i++)
+	{
+		ALX_TEST_CHECK(AlxParamKvStore_Get(&paramKvStore, keyArr[i], &val, sizeof(val), &lenActual) == Alx_Ok);
+	}
+	AlxBench_ParamKvStore_Stop("init & get all", ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS);
+
+	// Get single keys
+	AlxBench_ParamKvStore_Start();
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_KV_STORE_NUM_OF_UPDATES; i++)
+	{
+		ALX_TEST_CHECK(AlxParamKvStore_Get(&paramKvStore, keyArr[(i * 7) % ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS], &val, sizeof(val), &lenActual) == Alx_Ok);
+	}
+	AlxBench_ParamKvStore_Stop("get one", ALX_BENCH_PARAM_KV_STORE_NUM_OF_UPDATES);
+
+	// Check last update survived
+	uint32_t i = ALX_BENCH_PARAM_KV_STORE_NUM_OF_UPDATES - 1;
+	ALX_TEST_CHECK(AlxParamKvStore_Get(&paramKvStore, keyArr[(i * 7) % ALX_BENCH_PARAM_KV_STORE_NUM_OF_KEYS], &val, sizeof(val), &lenActual) == Alx_Ok);
+	ALX_TEST_CHECK(val == i);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxBench_ParamKvStore);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
@@ -0,0 +1,166 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxBench_ParamMgmt.c
+  * @brief		Auralix C Library - ALX Parameter Management Module - Host Benchmark
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxParamMgmt.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Defines
+//******************************************************************************
+#define ALX_BENCH_PARAM_MGMT_NUM_OF_ITEMS_MAX 2000
+#define ALX_BENCH_PARAM_MGMT_NUM_OF_LOOKUPS 200000
+#if defined(ALX_PARAM_MGMT_INDEX)
+#define ALX_BENCH_PARAM_MGMT_LOOKUP "index"
+#else
+#define ALX_BENCH_PARAM_MGMT_LOOKUP "linear"
+#endif
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxParamItem paramItemArr[ALX_BENCH_PARAM_MGMT_NUM_OF_ITEMS_MAX] = {};
+static char keyArr[ALX_BENCH_PARAM_MGMT_NUM_OF_ITEMS_MAX][16] = {};
+static uint32_t idArr[ALX_BENCH_PARAM_MGMT_NUM_OF_ITEMS_MAX] = {};
+static AlxParamMgmt paramMgmt = {};
+static uint32_t bitmap[ALX_PARAM_MGMT_BITMAP_LEN(ALX_BENCH_PARAM_MGMT_NUM_OF_ITEMS_MAX)] = {};
+#if defined(ALX_PARAM_MGMT_INDEX)
+static uint16_t idIndex[ALX_BENCH_PARAM_MGMT_NUM_OF_ITEMS_MAX] = {};
+static uint16_t keyIndex[2 * ALX_BENCH_PARAM_MGMT_NUM_OF_ITEMS_MAX] = {};
+#endif
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxBench_ParamMgmt_Setup(uint32_t numOfItems)
+{
+	// Ids are not ordered, 7919 is prime, so ids are permutation of 1..numOfItems
+	for (uint32_t i = 0; i < numOfItems; i++)
+	{
+		idArr[i] = 1 + ((i * 7919) % numOfItems);
+		snprintf(keyArr[i], sizeof(keyArr[i]), "group.param%04u", (unsigned int)i);
+		AlxParamItem_CtorUint32(&paramItemArr[i], NULL, AlxParamItem_Param, keyArr[i], idArr[i], "group", 1, 0, 0, 1000, AlxParamItem_Ignore, false, NULL, 0, "", false);
+		AlxParamItem_SetValToDef(&paramItemArr[i]);
+	}
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	AlxParamMgmt_Ctor(&paramMgmt, paramItemArr, idIndex, keyIndex, 2 * numOfItems, bitmap, numOfItems);
+	#else
+	AlxParamMgmt_Ctor(&paramMgmt, paramItemArr, bitmap, numOfItems);
+	#endif
+}
+static uint32_t AlxBench_ParamMgmt_Rand(uint32_t numOfItems)
+{
+	static uint32_t state = 12345;
+	state = (state * 1103515245) + 12345;
+	return (state >> 8) % numOfItems;
+}
+static void AlxBench_ParamMgmt_Print(const char* name, uint32_t numOfItems, uint64_t t_ns)
+{
+	printf("BENCH: ParamMgmt %-6s %-24s %4u items %9.1f ns/lookup\r\n", ALX_BENCH_PARAM_MGMT_LOOKUP, name, (unsigned int)numOfItems, (double)t_ns / ALX_BENCH_PARAM_MGMT_NUM_OF_LOOKUPS);
+}
+
+
+//******************************************************************************
+// Benchmarks
+//******************************************************************************
+static void AlxBench_ParamMgmt_Lookup(uint32_t numOfItems)
+{
+	// Setup
+	AlxBench_ParamMgmt_Setup(numOfItems);
+	uint32_t sum = 0;
+	uint32_t sumExpected = 0;
+	uint64_t t_ns = 0;
+
+	// By id, as binary protocol Get & Set do
+	t_ns = AlxTest_Bench_GetTime_ns();
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_MGMT_NUM_OF_LOOKUPS; i++)
+	{
+		uint32_t index = 0;
+		uint32_t j = AlxBench_ParamMgmt_Rand(numOfItems);
+		ALX_TEST_CHECK(AlxParamMgmt_ById_GetIndex(&paramMgmt, idArr[j], &index) == Alx_Ok);
+		sum = sum + index;
+		sumExpected = sumExpected + j;
+	}
+	AlxBench_ParamMgmt_Print("ById_GetIndex", numOfItems, AlxTest_Bench_GetTime_ns() - t_ns);
+
+	// By key, as CLI set-param does
+	t_ns = AlxTest_Bench_GetTime_ns();
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_MGMT_NUM_OF_LOOKUPS; i++)
+	{
+		uint32_t index = 0;
+		uint32_t j = AlxBench_ParamMgmt_Rand(numOfItems);
+		ALX_TEST_CHECK(AlxParamMgmt_ByKey_GetIndex(&paramMgmt, keyArr[j], &index) == Alx_Ok);
+		sum = sum + index;
+		sumExpected = sumExpected + j;
+	}
+	AlxBench_ParamMgmt_Print("ByKey_GetIndex", numOfItems, AlxTest_Bench_GetTime_ns() - t_ns);
+
+	// Missing id, worst case of linear scan
+	t_ns = AlxTest_Bench_GetTime_ns();
+	for (uint32_t i = 0; i < ALX_BENCH_PARAM_MGMT_NUM_OF_LOOKUPS; i++)
+	{
+		uint32_t index = 0;
+		ALX_TEST_CHECK(AlxParamMgmt_ById_GetIndex(&paramMgmt, numOfItems + 1, &index) != Alx_Ok);
+	}
+	AlxBench_ParamMgmt_Print("ById_GetIndex missing", numOfItems, AlxTest_Bench_GetTime_ns() - t_ns);
+
+	// Check every lookup found its item
+	ALX_TEST_CHECK(sum == sumExpected);
+}
+static void AlxBench_ParamMgmt_Lookup_500(void)
+{
+	AlxBench_ParamMgmt_Lookup(500);
+}
+static void AlxBench_ParamMgmt_Lookup_2000(void)
+{
+	AlxBench_ParamMgmt_Lookup(2000);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxBench_ParamMgmt_Lookup_500);
+	ALX_TEST_RUN(AlxBench_ParamMgmt_Lookup_2000);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
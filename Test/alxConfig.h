@@ -0,0 +1,135 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxConfig.h
+  * @brief		Auralix C Library - ALX Configuration File - Host Tests
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Include Guard
+//******************************************************************************
+#ifndef ALX_CONFIG_H
+#define ALX_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+//******************************************************************************
+// Configuration
+//******************************************************************************
+
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// Modules
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// ALX - Global
+//------------------------------------------------------------------------------
+#define ALX_PC
+
+
+//------------------------------------------------------------------------------
+// ALX - CLI
+//------------------------------------------------------------------------------
+#define ALX_CLI_BIN
+
+
+//------------------------------------------------------------------------------
+// ALX - FS, used by alxTest_Fs, which is built with ALX_FATFS on top of Mmc fake
+//------------------------------------------------------------------------------
+#define ALX_FS_FATFS_MMC_SECTOR_COUNT 70000	// FAT32 needs at least 65526 clusters, RAM disk of Mmc fake is ~34MB
+#define ALX_FS_FATFS_FAST_SEEK
+#define ALX_FS_FATFS_FAST_SEEK_CLMT_LEN 8	// Small, so fallback for fragmented file is tested
+#define ALX_FS_FATFS_DISK_CACHE	// Write cache is flushed by AlxFs_Maintenance
+#define ALX_FS_FATFS_DISCARD
+
+
+//------------------------------------------------------------------------------
+// ALX - FS SAFE
+//------------------------------------------------------------------------------
+#define ALX_FS_SAFE_GEN
+
+
+//------------------------------------------------------------------------------
+// ALX - MEM SAFE
+//------------------------------------------------------------------------------
+#define ALX_MEM_SAFE_WRITE_DELTA
+
+
+//------------------------------------------------------------------------------
+// ALX - PARAM GROUP
+//------------------------------------------------------------------------------
+#define ALX_PARAM_GROUP_VAL_CHANGED_EVENT
+
+
+//------------------------------------------------------------------------------
+// ALX - PARAM KV STORE
+//------------------------------------------------------------------------------
+#if !defined(ALX_TEST_PARAM_KV_STORE_FILE)	// File per key backend, used by alxBench_ParamKvStore_File
+#define ALX_PARAM_KV_STORE_LOG
+#endif
+#if !defined(ALX_PARAM_KV_STORE_LOG_LEN_MAX)
+#define ALX_PARAM_KV_STORE_LOG_LEN_MAX 4096	// Small, so that compaction is tested
+#endif
+
+
+
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// General
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// C/C++
+//------------------------------------------------------------------------------
+#define ALX_C_LIB
+
+
+//------------------------------------------------------------------------------
+// Assert - TRACE, failed assert is counted as failed check, see AlxAssert_Trace in alxTest.c
+//------------------------------------------------------------------------------
+#define ALX_CLI_ASSERT_TRACE_ENABLE
+#define ALX_FS_ASSERT_TRACE_ENABLE
+#define ALX_FS_SAFE_ASSERT_TRACE_ENABLE
+#define ALX_JSON_ASSERT_TRACE_ENABLE
+#define ALX_MEM_SAFE_ASSERT_TRACE_ENABLE
+#define ALX_PARAM_GROUP_ASSERT_TRACE_ENABLE
+#define ALX_PARAM_ITEM_ASSERT_TRACE_ENABLE
+#define ALX_PARAM_KV_STORE_ASSERT_TRACE_ENABLE
+#define ALX_PARAM_MGMT_ASSERT_TRACE_ENABLE
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// #ifndef ALX_CONFIG_H
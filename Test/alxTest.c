@@ -0,0 +1,653 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest.c
+  * @brief		Auralix C Library - ALX Host Test Module
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxId.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Variables
+//******************************************************************************
+uint32_t alxTest_numOfChecks = 0;
+uint32_t alxTest_numOfFails = 0;
+AlxTest_Fs alxTest_fs = {};
+AlxTest_MemRaw alxTest_memRaw = {};
+#if defined(ALX_FATFS)
+AlxTest_Mmc alxTest_mmc = {};
+#endif
+#if defined(ALX_TEST_OS_MUTEX)
+AlxTest_OsMutex alxTest_osMutex = {};
+#endif
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static uint8_t alxTest_serialPort_rxBuff[ALX_TEST_SERIAL_PORT_BUFF_LEN] = {};
+static uint32_t alxTest_serialPort_rxHead = 0;
+static uint32_t alxTest_serialPort_rxTail = 0;
+static char alxTest_serialPort_txBuff[ALX_TEST_SERIAL_PORT_BUFF_LEN] = {};
+static uint32_t alxTest_serialPort_txLen = 0;
+static struct
+{
+	AlxFs_File* file;
+	AlxTest_Fs_File* fsFile;
+	uint32_t position;
+} alxTest_fs_handleArr[ALX_TEST_FS_HANDLE_NUM_MAX] = {};
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static Alx_Status AlxTest_GetFault(Alx_Status* err);
+static uint32_t AlxTest_Fs_GetHandle(AlxFs_File* file);
+#if defined(ALX_TEST_OS_MUTEX)
+static uint32_t AlxTest_OsMutex_GetIndex(AlxOsMutex* mutex);
+#endif
+static int AlxTest_Bench_Compare(const void* a, const void* b);
+
+
+//******************************************************************************
+// Functions
+//******************************************************************************
+void AlxTest_Fail(const char* file, uint32_t line, const char* expr)
+{
+	alxTest_numOfFails++;
+	printf("FAIL: %s:%u %s\r\n", file, (unsigned int)line, expr);
+}
+int AlxTest_Result(void)
+{
+	printf("%s: %u failed\r\n", (alxTest_numOfFails == 0) ? "PASS" : "FAIL", (unsigned int)alxTest_numOfFails);
+	return (alxTest_numOfFails == 0) ? 0 : 1;
+}
+
+
+//------------------------------------------------------------------------------
+// Serial Port
+//------------------------------------------------------------------------------
+void AlxTest_SerialPort_Rx(const void* data, uint32_t len)
+{
+	memcpy(&alxTest_serialPort_rxBuff[alxTest_serialPort_rxTail], data, len);
+	alxTest_serialPort_rxTail = alxTest_serialPort_rxTail + len;
+}
+void AlxTest_SerialPort_RxStr(const char* str)
+{
+	AlxTest_SerialPort_Rx(str, strlen(str));
+}
+const char* AlxTest_SerialPort_GetTx(uint32_t* len)
+{
+	if (len != NULL)
+	{
+		*len = alxTest_serialPort_txLen;
+	}
+	return alxTest_serialPort_txBuff;
+}
+void AlxTest_SerialPort_Clear(void)
+{
+	alxTest_serialPort_rxHead = 0;
+	alxTest_serialPort_rxTail = 0;
+	memset(alxTest_serialPort_txBuff, 0, sizeof(alxTest_serialPort_txBuff));
+	alxTest_serialPort_txLen = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// FS
+//------------------------------------------------------------------------------
+void AlxTest_Fs_Clear(void)
+{
+	memset(&alxTest_fs, 0, sizeof(alxTest_fs));
+	memset(alxTest_fs_handleArr, 0, sizeof(alxTest_fs_handleArr));
+}
+AlxTest_Fs_File* AlxTest_Fs_GetFile(const char* path)
+{
+	for (uint32_t i = 0; i < ALX_TEST_FS_FILE_NUM_MAX; i++)
+	{
+		if (alxTest_fs.fileArr[i].isUsed && (strcmp(alxTest_fs.fileArr[i].path, path) == 0))
+		{
+			return &alxTest_fs.fileArr[i];
+		}
+	}
+	return NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// Mem Raw
+//------------------------------------------------------------------------------
+void AlxTest_MemRaw_Clear(void)
+{
+	memset(&alxTest_memRaw, 0, sizeof(alxTest_memRaw));
+}
+
+
+//------------------------------------------------------------------------------
+// Mmc
+//------------------------------------------------------------------------------
+#if defined(ALX_FATFS)
+void AlxTest_Mmc_Clear(void)
+{
+	memset(&alxTest_mmc, 0, sizeof(alxTest_mmc));
+}
+#endif
+
+
+//------------------------------------------------------------------------------
+// Os Mutex
+//------------------------------------------------------------------------------
+#if defined(ALX_TEST_OS_MUTEX)
+void AlxTest_OsMutex_Clear(void)
+{
+	memset(&alxTest_osMutex, 0, sizeof(alxTest_osMutex));
+}
+bool AlxTest_OsMutex_IsLocked(AlxOsMutex* mutex)
+{
+	return alxTest_osMutex.isLockedArr[AlxTest_OsMutex_GetIndex(mutex)];
+}
+#endif
+
+
+//------------------------------------------------------------------------------
+// Bench
+//------------------------------------------------------------------------------
+uint64_t AlxTest_Bench_GetTime_ns(void)
+{
+	struct timespec t = {};
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return ((uint64_t)t.tv_sec * 1000000000ULL) + (uint64_t)t.tv_nsec;
+}
+uint32_t AlxTest_Bench_Percentile(uint32_t* arr, uint32_t len, uint32_t percent)
+{
+	qsort(arr, len, sizeof(arr[0]), AlxTest_Bench_Compare);
+	uint32_t i = (uint32_t)(((uint64_t)len * percent) / 100);
+	return arr[(i < len) ? i : len - 1];
+}
+
+
+//******************************************************************************
+// Fakes - Assert, Id, IoPin
+//******************************************************************************
+void AlxAssert_Trace(const char* file, uint32_t line, const char* fun)
+{
+	AlxTest_Fail(file, line, fun);
+}
+void NVIC_SystemReset(void) {}
+bool AlxId_GetFwIsBootUsed(AlxId* me) { (void)me; return false; }
+const char* AlxId_GetFwArtf(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetFwName(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetFwVerStr(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetFwBinStr(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetFwBootArtf(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetFwBootName(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetFwBootVerStr(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetFwBootBinStr(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetHwPcbArtf(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetHwPcbName(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetHwPcbVerStr(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetHwBomArtf(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetHwBomName(AlxId* me) { (void)me; return ""; }
+const char* AlxId_GetHwBomVerStr(AlxId* me) { (void)me; return ""; }
+uint8_t AlxId_GetHwId(AlxId* me) { (void)me; return 0; }
+const char* AlxId_GetHwMcuUniqueIdStr(AlxId* me) { (void)me; return ""; }
+void AlxIoPin_Set(AlxIoPin* me) { (void)me; }
+void AlxIoPin_Reset(AlxIoPin* me) { (void)me; }
+
+
+//******************************************************************************
+// Fakes - Serial Port, RX from AlxTest_SerialPort_Rx, TX to buffer
+//******************************************************************************
+Alx_Status AlxSerialPort_Read(AlxSerialPort* me, uint8_t* data, uint32_t len)
+{
+	(void)me;
+	if ((alxTest_serialPort_rxTail - alxTest_serialPort_rxHead) < len)
+	{
+		return Alx_Err;
+	}
+	memcpy(data, &alxTest_serialPort_rxBuff[alxTest_serialPort_rxHead], len);
+	alxTest_serialPort_rxHead = alxTest_serialPort_rxHead + len;
+	return Alx_Ok;
+}
+Alx_Status AlxSerialPort_ReadStrUntil(AlxSerialPort* me, char* str, const char* delim, uint32_t maxLen, uint32_t* numRead)
+{
+	(void)me;
+	uint32_t delimLen = strlen(delim);
+	for (uint32_t i = alxTest_serialPort_rxHead; (i + delimLen) <= alxTest_serialPort_rxTail; i++)
+	{
+		if (memcmp(&alxTest_serialPort_rxBuff[i], delim, delimLen) == 0)
+		{
+			uint32_t len = i - alxTest_serialPort_rxHead;
+			if (len >= maxLen)
+			{
+				return Alx_Err;
+			}
+			memcpy(str, &alxTest_serialPort_rxBuff[alxTest_serialPort_rxHead], len);
+			str[len] = '\0';
+			alxTest_serialPort_rxHead = i + delimLen;
+			*numRead = len;
+			return Alx_Ok;
+		}
+	}
+	return Alx_Err;
+}
+Alx_Status AlxSerialPort_Write(AlxSerialPort* me, const uint8_t* data, uint32_t len)
+{
+	(void)me;
+	if ((alxTest_serialPort_txLen + len) >= sizeof(alxTest_serialPort_txBuff))
+	{
+		return Alx_Err;
+	}
+	memcpy(&alxTest_serialPort_txBuff[alxTest_serialPort_txLen], data, len);
+	alxTest_serialPort_txLen = alxTest_serialPort_txLen + len;
+	return Alx_Ok;
+}
+Alx_Status AlxSerialPort_WriteStr(AlxSerialPort* me, const char* str)
+{
+	return AlxSerialPort_Write(me, (const uint8_t*)str, strlen(str));
+}
+void AlxSerialPort_FlushRxFifo(AlxSerialPort* me)
+{
+	(void)me;
+	alxTest_serialPort_rxHead = alxTest_serialPort_rxTail;
+}
+
+
+//******************************************************************************
+// Fakes - FS, files in RAM, with fault injection, with FatFs real AlxFs is used on top of Mmc fake below
+//******************************************************************************
+#if !defined(ALX_FATFS)
+Alx_Status AlxFs_Mount(AlxFs* me) { (void)me; return Alx_Ok; }
+Alx_Status AlxFs_UnMount(AlxFs* me) { (void)me; return Alx_Ok; }
+Alx_Status AlxFs_Format(AlxFs* me) { (void)me; AlxTest_Fs_Clear(); return Alx_Ok; }
+Alx_Status AlxFs_Remove(AlxFs* me, const char* path)
+{
+	(void)me;
+	AlxTest_Fs_File* fsFile = AlxTest_Fs_GetFile(path);
+	if (fsFile == NULL)
+	{
+		return AlxFs_ErrNoFile;
+	}
+	memset(fsFile, 0, sizeof(*fsFile));
+	return Alx_Ok;
+}
+Alx_Status AlxFs_Rename(AlxFs* me, const char* pathOld, const char* pathNew)
+{
+	(void)me;
+	AlxTest_Fs_File* fsFile = AlxTest_Fs_GetFile(pathOld);
+	if (fsFile == NULL)
+	{
+		return AlxFs_ErrNoFile;
+	}
+	AlxTest_Fs_File* fsFileNew = AlxTest_Fs_GetFile(pathNew);
+	if (fsFileNew != NULL)
+	{
+		memset(fsFileNew, 0, sizeof(*fsFileNew));
+	}
+	strcpy(fsFile->path, pathNew);
+	return Alx_Ok;
+}
+Alx_Status AlxFs_File_Open(AlxFs* me, AlxFs_File* file, const char* path, const char* mode)
+{
+	(void)me;
+	Alx_Status status = AlxTest_GetFault(&alxTest_fs.errFileOpen);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+
+	// File
+	AlxTest_Fs_File* fsFile = AlxTest_Fs_GetFile(path);
+	if ((fsFile == NULL) && (mode[0] == 'r'))
+	{
+		return AlxFs_ErrNoFile;
+	}
+	if (fsFile == NULL)
+	{
+		for (uint32_t i = 0; (fsFile == NULL) && (i < ALX_TEST_FS_FILE_NUM_MAX); i++)
+		{
+			if (alxTest_fs.fileArr[i].isUsed == false)
+			{
+				fsFile = &alxTest_fs.fileArr[i];
+			}
+		}
+		if (fsFile == NULL)
+		{
+			return Alx_Err;
+		}
+		strcpy(fsFile->path, path);
+		fsFile->isUsed = true;
+	}
+	if (mode[0] == 'w')
+	{
+		fsFile->len = 0;
+	}
+
+	// Handle
+	for (uint32_t i = 0; i < ALX_TEST_FS_HANDLE_NUM_MAX; i++)
+	{
+		if (alxTest_fs_handleArr[i].file == NULL)
+		{
+			alxTest_fs_handleArr[i].file = file;
+			alxTest_fs_handleArr[i].fsFile = fsFile;
+			alxTest_fs_handleArr[i].position = (mode[0] == 'a') ? fsFile->len : 0;
+			return Alx_Ok;
+		}
+	}
+	return Alx_Err;
+}
+Alx_Status AlxFs_File_Close(AlxFs* me, AlxFs_File* file)
+{
+	(void)me;
+	uint32_t i = AlxTest_Fs_GetHandle(file);
+	memset(&alxTest_fs_handleArr[i], 0, sizeof(alxTest_fs_handleArr[i]));
+	return Alx_Ok;
+}
+Alx_Status AlxFs_File_Read(AlxFs* me, AlxFs_File* file, void* data, uint32_t len, uint32_t* lenActual)
+{
+	(void)me;
+	uint32_t i = AlxTest_Fs_GetHandle(file);
+	AlxTest_Fs_File* fsFile = alxTest_fs_handleArr[i].fsFile;
+	uint32_t position = alxTest_fs_handleArr[i].position;
+	uint32_t lenRead = (position < fsFile->len) ? fsFile->len - position : 0;
+	lenRead = (lenRead < len) ? lenRead : len;
+	memcpy(data, &fsFile->data[position], lenRead);
+	alxTest_fs_handleArr[i].position = position + lenRead;
+	*lenActual = lenRead;
+	return Alx_Ok;
+}
+Alx_Status AlxFs_File_Write(AlxFs* me, AlxFs_File* file, void* data, uint32_t len)
+{
+	(void)me;
+	Alx_Status status = AlxTest_GetFault(&alxTest_fs.errFileWrite);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+	uint32_t i = AlxTest_Fs_GetHandle(file);
+	AlxTest_Fs_File* fsFile = alxTest_fs_handleArr[i].fsFile;
+	uint32_t position = alxTest_fs_handleArr[i].position;
+	if ((position + len) > ALX_TEST_FS_FILE_LEN_MAX)
+	{
+		return Alx_Err;
+	}
+	memcpy(&fsFile->data[position], data, len);
+	alxTest_fs_handleArr[i].position = position + len;
+	if (fsFile->len < (position + len))
+	{
+		fsFile->len = position + len;
+	}
+	return Alx_Ok;
+}
+Alx_Status AlxFs_File_Sync(AlxFs* me, AlxFs_File* file)
+{
+	(void)me;
+	(void)file;
+	return AlxTest_GetFault(&alxTest_fs.errFileSync);
+}
+Alx_Status AlxFs_File_Seek(AlxFs* me, AlxFs_File* file, int32_t offset, AlxFs_File_Seek_Origin origin, uint32_t* positionNew)
+{
+	(void)me;
+	uint32_t i = AlxTest_Fs_GetHandle(file);
+	int32_t position = offset;
+	if (origin == AlxFs_File_Seek_Origin_Cur)
+	{
+		position = (int32_t)alxTest_fs_handleArr[i].position + offset;
+	}
+	else if (origin == AlxFs_File_Seek_Origin_End)
+	{
+		position = (int32_t)alxTest_fs_handleArr[i].fsFile->len + offset;
+	}
+	if (position < 0)
+	{
+		return Alx_Err;
+	}
+	alxTest_fs_handleArr[i].position = (uint32_t)position;
+	if (positionNew != NULL)
+	{
+		*positionNew = (uint32_t)position;
+	}
+	return Alx_Ok;
+}
+Alx_Status AlxFs_File_Size(AlxFs* me, AlxFs_File* file, uint32_t* size)
+{
+	(void)me;
+	uint32_t i = AlxTest_Fs_GetHandle(file);
+	*size = alxTest_fs_handleArr[i].fsFile->len;
+	return Alx_Ok;
+}
+Alx_Status AlxFs_File_Truncate(AlxFs* me, AlxFs_File* file, uint32_t size)
+{
+	(void)me;
+	uint32_t i = AlxTest_Fs_GetHandle(file);
+	if (alxTest_fs_handleArr[i].fsFile->len > size)
+	{
+		alxTest_fs_handleArr[i].fsFile->len = size;
+	}
+	return Alx_Ok;
+}
+#endif
+
+
+//******************************************************************************
+// Fakes - Mem Raw, memory in RAM, with write counters & fault injection
+//******************************************************************************
+void AlxMemRaw_Ctor(AlxMemRaw* me) { me->wasCtorCalled = true; me->isInit = false; }
+Alx_Status AlxMemRaw_Init(AlxMemRaw* me) { me->isInit = true; return Alx_Ok; }
+Alx_Status AlxMemRaw_DeInit(AlxMemRaw* me) { me->isInit = false; return Alx_Ok; }
+Alx_Status AlxMemRaw_Read(AlxMemRaw* me, uint32_t addr, uint8_t* data, uint32_t len, uint8_t numOfTries, uint16_t timeout_ms)
+{
+	(void)numOfTries;
+	(void)timeout_ms;
+	ALX_TEST_CHECK(me->isInit);
+	ALX_TEST_CHECK((addr + len) <= ALX_TEST_MEM_RAW_LEN);
+	Alx_Status status = AlxTest_GetFault(&alxTest_memRaw.errRead);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+	memcpy(data, &alxTest_memRaw.data[addr], len);
+	return Alx_Ok;
+}
+Alx_Status AlxMemRaw_Write(AlxMemRaw* me, uint32_t addr, uint8_t* data, uint32_t len, bool checkWithReadEnable, uint8_t numOfTries, uint16_t timeout_ms)
+{
+	(void)checkWithReadEnable;
+	(void)numOfTries;
+	(void)timeout_ms;
+	ALX_TEST_CHECK(me->isInit);
+	ALX_TEST_CHECK((addr + len) <= ALX_TEST_MEM_RAW_LEN);
+	Alx_Status status = AlxTest_GetFault(&alxTest_memRaw.errWrite);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+	memcpy(&alxTest_memRaw.data[addr], data, len);
+	alxTest_memRaw.numOfWrites++;
+	alxTest_memRaw.numOfWrittenBytes = alxTest_memRaw.numOfWrittenBytes + len;
+	return Alx_Ok;
+}
+
+
+//******************************************************************************
+// Fakes - Mmc, RAM disk, with counters & fault injection
+//******************************************************************************
+#if defined(ALX_FATFS)
+Alx_Status AlxMmc_ReadBlock(AlxMmc* me, uint32_t numOfBlocks, uint32_t addr, uint8_t* data, uint32_t len, uint8_t numOfTries, uint16_t newTryWaitTime_ms)
+{
+	(void)me;
+	(void)numOfTries;
+	(void)newTryWaitTime_ms;
+	ALX_TEST_CHECK((addr + numOfBlocks) <= ALX_TEST_MMC_BLOCK_NUM);
+	ALX_TEST_CHECK(len == numOfBlocks * ALX_TEST_MMC_BLOCK_LEN);
+	Alx_Status status = AlxTest_GetFault(&alxTest_mmc.errRead);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+	#if defined(ALX_TEST_OS_MUTEX)
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocked > 0);	// Block is accessed only while volume is locked
+	#endif
+	memcpy(data, alxTest_mmc.data[addr], len);
+	alxTest_mmc.numOfReadBlocks = alxTest_mmc.numOfReadBlocks + numOfBlocks;
+	return Alx_Ok;
+}
+Alx_Status AlxMmc_WriteBlock(AlxMmc* me, uint32_t numOfBlocks, uint32_t addr, uint8_t* data, uint32_t len, uint8_t numOfTries, uint16_t newTryWaitTime_ms)
+{
+	(void)me;
+	(void)numOfTries;
+	(void)newTryWaitTime_ms;
+	ALX_TEST_CHECK((addr + numOfBlocks) <= ALX_TEST_MMC_BLOCK_NUM);
+	ALX_TEST_CHECK(len == numOfBlocks * ALX_TEST_MMC_BLOCK_LEN);
+	Alx_Status status = AlxTest_GetFault(&alxTest_mmc.errWrite);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+	#if defined(ALX_TEST_OS_MUTEX)
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocked > 0);	// Block is accessed only while volume is locked
+	#endif
+	memcpy(alxTest_mmc.data[addr], data, len);
+	alxTest_mmc.numOfWrites++;
+	alxTest_mmc.numOfWrittenBlocks = alxTest_mmc.numOfWrittenBlocks + numOfBlocks;
+	return Alx_Ok;
+}
+Alx_Status AlxMmc_EraseBlock(AlxMmc* me, uint32_t numOfBlocks, uint32_t addr, uint8_t numOfTries, uint16_t newTryWaitTime_ms)
+{
+	(void)me;
+	(void)numOfTries;
+	(void)newTryWaitTime_ms;
+	ALX_TEST_CHECK((addr + numOfBlocks) <= ALX_TEST_MMC_BLOCK_NUM);
+	Alx_Status status = AlxTest_GetFault(&alxTest_mmc.errErase);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+	#if defined(ALX_TEST_OS_MUTEX)
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocked > 0);	// Block is accessed only while volume is locked
+	#endif
+	alxTest_mmc.numOfErasedBlocks = alxTest_mmc.numOfErasedBlocks + numOfBlocks;
+	return Alx_Ok;
+}
+Alx_Status AlxMmc_WaitForTransferState(AlxMmc* me) { (void)me; return Alx_Ok; }
+#endif
+
+
+//******************************************************************************
+// Fakes - Os Mutex, single thread, lock of locked mutex would block forever, so it is failed check
+//******************************************************************************
+#if defined(ALX_TEST_OS_MUTEX)
+void AlxOsMutex_Ctor(AlxOsMutex* me)
+{
+	for (uint32_t i = 0; i < ALX_TEST_OS_MUTEX_NUM_MAX; i++)
+	{
+		if ((alxTest_osMutex.mutexArr[i] == me) || (alxTest_osMutex.mutexArr[i] == NULL))
+		{
+			alxTest_osMutex.mutexArr[i] = me;
+			alxTest_osMutex.isLockedArr[i] = false;
+			me->wasCtorCalled = true;
+			return;
+		}
+	}
+	ALX_TEST_CHECK(false);	// Too many mutexes
+}
+void AlxOsMutex_CtorPrioInherit(AlxOsMutex* me)
+{
+	AlxOsMutex_Ctor(me);
+}
+void AlxOsMutex_Lock(AlxOsMutex* me)
+{
+	uint32_t i = AlxTest_OsMutex_GetIndex(me);
+	ALX_TEST_CHECK(alxTest_osMutex.isLockedArr[i] == false);
+	alxTest_osMutex.isLockedArr[i] = true;
+	alxTest_osMutex.numOfLocked++;
+	alxTest_osMutex.numOfLocks++;
+}
+void AlxOsMutex_Unlock(AlxOsMutex* me)
+{
+	uint32_t i = AlxTest_OsMutex_GetIndex(me);
+	ALX_TEST_CHECK(alxTest_osMutex.isLockedArr[i] == true);
+	alxTest_osMutex.isLockedArr[i] = false;
+	alxTest_osMutex.numOfLocked--;
+}
+bool AlxOsMutex_IsUnlocked(AlxOsMutex* me)
+{
+	return AlxTest_OsMutex_IsLocked(me) == false;
+}
+#endif
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static Alx_Status AlxTest_GetFault(Alx_Status* err)
+{
+	Alx_Status status = *err;
+	*err = Alx_Ok;
+	return status;
+}
+static uint32_t AlxTest_Fs_GetHandle(AlxFs_File* file)
+{
+	for (uint32_t i = 0; i < ALX_TEST_FS_HANDLE_NUM_MAX; i++)
+	{
+		if (alxTest_fs_handleArr[i].file == file)
+		{
+			return i;
+		}
+	}
+	ALX_TEST_CHECK(false);	// File is not open
+	return 0;
+}
+#if defined(ALX_TEST_OS_MUTEX)
+static uint32_t AlxTest_OsMutex_GetIndex(AlxOsMutex* mutex)
+{
+	for (uint32_t i = 0; i < ALX_TEST_OS_MUTEX_NUM_MAX; i++)
+	{
+		if (alxTest_osMutex.mutexArr[i] == mutex)
+		{
+			return i;
+		}
+	}
+	ALX_TEST_CHECK(false);	// Mutex is not constructed
+	return 0;
+}
+#endif
+static int AlxTest_Bench_Compare(const void* a, const void* b)
+{
+	uint32_t valA = *(const uint32_t*)a;
+	uint32_t valB = *(const uint32_t*)b;
+	return (valA > valB) - (valA < valB);
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
@@ -0,0 +1,203 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest.h
+  * @brief		Auralix C Library - ALX Host Test Module
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Include Guard
+//******************************************************************************
+#ifndef ALX_TEST_H
+#define ALX_TEST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxGlobal.h"
+#include "alxSerialPort.h"
+#include "alxFs.h"
+#include "alxMemRaw.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Preprocessor
+//******************************************************************************
+#define ALX_TEST_CHECK(expr) if (expr) {} else { AlxTest_Fail(__FILE__, __LINE__, #expr); }
+#define ALX_TEST_RUN(fun) do { printf("RUN: %s\r\n", #fun); fun(); } while (false)
+
+
+//******************************************************************************
+// Defines
+//******************************************************************************
+#define ALX_TEST_SERIAL_PORT_BUFF_LEN 4096
+#define ALX_TEST_FS_FILE_NUM_MAX 4
+#define ALX_TEST_FS_FILE_LEN_MAX 8192
+#define ALX_TEST_FS_HANDLE_NUM_MAX 4
+#define ALX_TEST_MEM_RAW_LEN 256
+#if defined(ALX_FATFS)
+#define ALX_TEST_MMC_BLOCK_LEN 512
+#define ALX_TEST_MMC_BLOCK_NUM ALX_FS_FATFS_MMC_SECTOR_COUNT
+#endif
+#if defined(ALX_TEST_OS_MUTEX)
+#define ALX_TEST_OS_MUTEX_NUM_MAX 8
+#endif
+
+
+//******************************************************************************
+// Types
+//******************************************************************************
+typedef struct
+{
+	char path[64];
+	uint8_t data[ALX_TEST_FS_FILE_LEN_MAX];
+	uint32_t len;
+	bool isUsed;
+} AlxTest_Fs_File;
+
+typedef struct
+{
+	// Files
+	AlxTest_Fs_File fileArr[ALX_TEST_FS_FILE_NUM_MAX];
+
+	// Fault injection, status is returned by next call of function, Alx_Ok means no fault
+	Alx_Status errFileOpen;
+	Alx_Status errFileWrite;
+	Alx_Status errFileSync;
+} AlxTest_Fs;
+
+typedef struct
+{
+	// Memory
+	uint8_t data[ALX_TEST_MEM_RAW_LEN];
+
+	// Counters
+	uint32_t numOfWrites;
+	uint32_t numOfWrittenBytes;
+
+	// Fault injection, status is returned by next call of function, Alx_Ok means no fault
+	Alx_Status errRead;
+	Alx_Status errWrite;
+} AlxTest_MemRaw;
+
+#if defined(ALX_FATFS)
+typedef struct
+{
+	// Memory
+	uint8_t data[ALX_TEST_MMC_BLOCK_NUM][ALX_TEST_MMC_BLOCK_LEN];
+
+	// Counters
+	uint32_t numOfReadBlocks;
+	uint32_t numOfWrites;
+	uint32_t numOfWrittenBlocks;
+	uint32_t numOfErasedBlocks;
+
+	// Fault injection, status is returned by next call of function, Alx_Ok means no fault
+	Alx_Status errRead;
+	Alx_Status errWrite;
+	Alx_Status errErase;
+} AlxTest_Mmc;
+#endif
+
+#if defined(ALX_TEST_OS_MUTEX)
+typedef struct
+{
+	// Mutexes
+	AlxOsMutex* mutexArr[ALX_TEST_OS_MUTEX_NUM_MAX];
+	bool isLockedArr[ALX_TEST_OS_MUTEX_NUM_MAX];
+
+	// Counters
+	uint32_t numOfLocked;	// Number of currently locked mutexes
+	uint32_t numOfLocks;
+} AlxTest_OsMutex;
+#endif
+
+
+//******************************************************************************
+// Variables
+//******************************************************************************
+extern uint32_t alxTest_numOfChecks;
+extern uint32_t alxTest_numOfFails;
+extern AlxTest_Fs alxTest_fs;
+extern AlxTest_MemRaw alxTest_memRaw;
+#if defined(ALX_FATFS)
+extern AlxTest_Mmc alxTest_mmc;
+#endif
+#if defined(ALX_TEST_OS_MUTEX)
+extern AlxTest_OsMutex alxTest_osMutex;
+#endif
+
+
+//******************************************************************************
+// Functions
+//******************************************************************************
+void AlxTest_Fail(const char* file, uint32_t line, const char* expr);
+int AlxTest_Result(void);
+
+// Serial Port
+void AlxTest_SerialPort_Rx(const void* data, uint32_t len);
+void AlxTest_SerialPort_RxStr(const char* str);
+const char* AlxTest_SerialPort_GetTx(uint32_t* len);
+void AlxTest_SerialPort_Clear(void);
+
+// FS
+void AlxTest_Fs_Clear(void);
+AlxTest_Fs_File* AlxTest_Fs_GetFile(const char* path);
+
+// Mem Raw
+void AlxTest_MemRaw_Clear(void);
+
+// Mmc
+#if defined(ALX_FATFS)
+void AlxTest_Mmc_Clear(void);
+#endif
+
+// Os Mutex
+#if defined(ALX_TEST_OS_MUTEX)
+void AlxTest_OsMutex_Clear(void);
+bool AlxTest_OsMutex_IsLocked(AlxOsMutex* mutex);
+#endif
+
+// Bench
+uint64_t AlxTest_Bench_GetTime_ns(void);
+uint32_t AlxTest_Bench_Percentile(uint32_t* arr, uint32_t len, uint32_t percent);	// Sorts arr
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// #ifndef ALX_TEST_H
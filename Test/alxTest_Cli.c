@@ -0,0 +1,185 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest_Cli.c
+  * @brief		Auralix C Library - ALX CLI Module - Host Test
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxCli.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxParamItem paramItemArr[3] = {};
+static uint8_t paramItemStrBuff[ALX_PARAM_ITEM_BUFF_LEN] = {};
+static AlxParamMgmt paramMgmt = {};
+static uint32_t bitmap[ALX_PARAM_MGMT_BITMAP_LEN(3)] = {};
+static AlxCli cli = {};
+static char cliBuff[512] = {};
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxTest_Cli_Setup(void)
+{
+	AlxTest_SerialPort_Clear();
+	AlxParamItem_CtorBool(&paramItemArr[0], NULL, AlxParamItem_Param, "PRETTY_JSON_EN", 1, "group", 1, false, "", false);
+	AlxParamItem_CtorStr(&paramItemArr[1], NULL, AlxParamItem_Param, "name", 2, "group", 1, "default", AlxParamItem_Ignore, "", false, paramItemStrBuff, sizeof(paramItemStrBuff));
+	AlxParamItem_CtorUint16(&paramItemArr[2], NULL, AlxParamItem_Var, "cnt", 3, "group", 1, 0, 0, 1000, AlxParamItem_Assert, false, NULL, 0, "", false);
+	for (uint32_t i = 0; i < ALX_ARR_LEN(paramItemArr); i++)
+	{
+		AlxParamItem_SetValToDef(&paramItemArr[i]);
+	}
+	AlxParamMgmt_Ctor(&paramMgmt, paramItemArr, bitmap, ALX_ARR_LEN(paramItemArr));
+	AlxCli_Ctor(&cli, NULL, NULL, &paramMgmt, &paramItemArr[0], cliBuff, sizeof(cliBuff));
+}
+static const char* AlxTest_Cli_Cmd(const char* cmd)
+{
+	AlxTest_SerialPort_Clear();
+	AlxTest_SerialPort_RxStr(cmd);
+	AlxTest_SerialPort_RxStr("\r\n");
+	AlxCli_Handle(&cli);
+	return AlxTest_SerialPort_GetTx(NULL);
+}
+
+
+//******************************************************************************
+// Tests
+//******************************************************************************
+static void AlxTest_Cli_SetParam_LongLine(void)
+{
+	// Prepare, longest Str value, so that line is longer than ALX_CLI_BUFF_LEN
+	char val[ALX_PARAM_ITEM_BUFF_LEN] = "";
+	memset(val, 'a', sizeof(val) - 1);
+	char cmd[256] = "";
+	snprintf(cmd, sizeof(cmd), "set-param --key name --val %s", val);
+	ALX_TEST_CHECK(strlen(cmd) >= ALX_CLI_BUFF_LEN);
+
+	// Set
+	AlxTest_Cli_Setup();
+	const char* resp = AlxTest_Cli_Cmd(cmd);
+	ALX_TEST_CHECK(strstr(resp, "\"success\"") != NULL);
+
+	// Check
+	char valActual[ALX_PARAM_ITEM_BUFF_LEN] = "";
+	ALX_TEST_CHECK(AlxParamItem_GetValStr(&paramItemArr[1], valActual, sizeof(valActual)) == Alx_Ok);
+	ALX_TEST_CHECK(strcmp(valActual, val) == 0);
+}
+static void AlxTest_Cli_SetParam_TooLongVal(void)
+{
+	// Prepare, Str value longer than item buffer
+	char val[ALX_PARAM_ITEM_BUFF_LEN + 1] = "";
+	memset(val, 'b', sizeof(val) - 1);
+	char cmd[256] = "";
+	snprintf(cmd, sizeof(cmd), "set-param --key name --val %s", val);
+
+	// Set, value is rejected & unchanged
+	AlxTest_Cli_Setup();
+	const char* resp = AlxTest_Cli_Cmd(cmd);
+	ALX_TEST_CHECK(strstr(resp, "\"error\"") != NULL);
+	char valActual[ALX_PARAM_ITEM_BUFF_LEN] = "";
+	ALX_TEST_CHECK(AlxParamItem_GetValStr(&paramItemArr[1], valActual, sizeof(valActual)) == Alx_Ok);
+	ALX_TEST_CHECK(strcmp(valActual, "default") == 0);
+}
+
+static void AlxTest_Cli_Subscribe_Period(void)
+{
+	// Setup
+	AlxTest_Cli_Setup();
+
+	// Sign, whitespace, out of range & not a number are rejected
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period -1 --items cnt"), "\"error\"") != NULL);
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period +10 --items cnt"), "\"error\"") != NULL);
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period 0 --items cnt"), "\"error\"") != NULL);
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period 65536 --items cnt"), "\"error\"") != NULL);
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period 18446744073709551617 --items cnt"), "\"error\"") != NULL);
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period 10ms --items cnt"), "\"error\"") != NULL);
+	ALX_TEST_CHECK(cli.subNumOfItems == 0);
+
+	// Valid, by key & by id
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period 65535 --items cnt,2"), "\"success\"") != NULL);
+	ALX_TEST_CHECK(cli.subNumOfItems == 2);
+	ALX_TEST_CHECK(cli.subPeriod_ms == 65535);
+
+	// Id with sign is NOT an id, so it is looked up as key
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period 10 --items -2"), "\"error\"") != NULL);
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("unsubscribe"), "\"success\"") != NULL);
+	ALX_TEST_CHECK(cli.subNumOfItems == 0);
+}
+static void AlxTest_Cli_Subscribe_NumOfItems(void)
+{
+	// Setup
+	AlxTest_Cli_Setup();
+
+	// Max number of items
+	char cmd[256] = "subscribe --period 10 --items cnt";
+	for (uint32_t i = 1; i < ALX_CLI_SUB_NUM_MAX; i++)
+	{
+		strcat(cmd, ",cnt");
+	}
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd(cmd), "\"success\"") != NULL);
+	ALX_TEST_CHECK(cli.subNumOfItems == ALX_CLI_SUB_NUM_MAX);
+
+	// One more is rejected
+	strcat(cmd, ",cnt");
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd(cmd), "\"error\"") != NULL);
+}
+static void AlxTest_Cli_Subscribe_StrLenMax(void)
+{
+	// Setup, Str value is short
+	AlxTest_Cli_Setup();
+
+	// Str is sized by buffer len, NOT by current value len, because value can grow after subscribe
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period 10 --items name"), "\"success\"") != NULL);
+	ALX_TEST_CHECK(strstr(AlxTest_Cli_Cmd("subscribe --period 10 --items name,name"), "\"error\"") != NULL);
+	ALX_TEST_CHECK(cli.subNumOfItems == 1);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxTest_Cli_SetParam_LongLine);
+	ALX_TEST_RUN(AlxTest_Cli_SetParam_TooLongVal);
+	ALX_TEST_RUN(AlxTest_Cli_Subscribe_Period);
+	ALX_TEST_RUN(AlxTest_Cli_Subscribe_NumOfItems);
+	ALX_TEST_RUN(AlxTest_Cli_Subscribe_StrLenMax);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
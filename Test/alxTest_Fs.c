@@ -0,0 +1,442 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest_Fs.c
+  * @brief		Auralix C Library - ALX File System Module - Host Test
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Defines
+//******************************************************************************
+#define ALX_TEST_FS_LEN (1024 * 1024)	// File spans 2048 clusters, so its FAT chain spans 16 FAT sectors, more than disk read cache holds
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxMmc alxMmc = {};
+static AlxFs alxFs = {};
+static uint8_t buff[4096] = {};
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxTest_Fs_Setup(void)
+{
+	AlxTest_Mmc_Clear();
+	AlxTest_OsMutex_Clear();
+	AlxFs_Ctor(&alxFs, AlxFs_Config_Fatfs_Mmc, &alxMmc, NULL, NULL, NULL, NULL, NULL);
+	ALX_TEST_CHECK(AlxFs_Format(&alxFs) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_Mount(&alxFs) == Alx_Ok);
+}
+static uint8_t AlxTest_Fs_GetByte(uint32_t position)
+{
+	return (uint8_t)((position * 7) ^ (position >> 9));
+}
+static void AlxTest_Fs_FillBuff(uint32_t position, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++)
+	{
+		buff[i] = AlxTest_Fs_GetByte(position + i);
+	}
+}
+static void AlxTest_Fs_WriteFile(const char* path, uint32_t len)
+{
+	AlxFs_File file = {};
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, path, "w") == Alx_Ok);
+	for (uint32_t position = 0; position < len; position = position + sizeof(buff))
+	{
+		AlxTest_Fs_FillBuff(position, sizeof(buff));
+		ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &file, buff, sizeof(buff)) == Alx_Ok);
+	}
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+}
+static void AlxTest_Fs_SeekRead(AlxFs_File* file, uint32_t position)
+{
+	uint32_t positionNew = 0;
+	uint32_t lenActual = 0;
+	uint8_t data[16] = {};
+	ALX_TEST_CHECK(AlxFs_File_Seek(&alxFs, file, (int32_t)position, AlxFs_File_Seek_Origin_Set, &positionNew) == Alx_Ok);
+	ALX_TEST_CHECK(positionNew == position);
+	ALX_TEST_CHECK(AlxFs_File_Read(&alxFs, file, data, sizeof(data), &lenActual) == Alx_Ok);
+	ALX_TEST_CHECK(lenActual == sizeof(data));
+	for (uint32_t i = 0; i < sizeof(data); i++)
+	{
+		ALX_TEST_CHECK(data[i] == AlxTest_Fs_GetByte(position + i));
+	}
+}
+static void AlxTest_Fs_CheckLockReleased(uint32_t* numOfLocks)
+{
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocks > *numOfLocks);	// Volume was locked
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocked == 0);	// Volume was released
+	*numOfLocks = alxTest_osMutex.numOfLocks;
+}
+static Alx_Status AlxTest_Fs_ChunkRead_Callback(void* ctx, void* chunkData, uint32_t chunkLenActual)
+{
+	uint32_t* position = (uint32_t*)ctx;
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocked == 0);	// Volume & caller mutex are not held, so callback can use volume
+	for (uint32_t i = 0; i < chunkLenActual; i++)
+	{
+		ALX_TEST_CHECK(((uint8_t*)chunkData)[i] == AlxTest_Fs_GetByte(*position + i));
+	}
+	*position = *position + chunkLenActual;
+	return Alx_Ok;
+}
+
+
+//******************************************************************************
+// Tests
+//******************************************************************************
+static void AlxTest_Fs_FastSeek_ReadOnly(void)
+{
+	// Setup
+	AlxTest_Fs_Setup();
+	AlxTest_Fs_WriteFile("file.bin", ALX_TEST_FS_LEN);
+
+	// Open, cluster link map table is created
+	AlxFs_File file = {};
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "r") == Alx_Ok);
+	ALX_TEST_CHECK(file.fatfsFile.cltbl == file.fatfsClmt);
+
+	// Seek forward & backward across FAT sectors, cluster is taken from table, so only data sector at new position is read, FAT is not read
+	uint32_t positionArr[] = { ALX_TEST_FS_LEN - 100, 1000, ALX_TEST_FS_LEN / 2 + 3, 0, 200 * 1024 };
+	for (uint32_t i = 0; i < ALX_ARR_LEN(positionArr); i++)
+	{
+		uint32_t positionNew = 0;
+		uint32_t numOfReadBlocks = alxTest_mmc.numOfReadBlocks;
+		ALX_TEST_CHECK(AlxFs_File_Seek(&alxFs, &file, (int32_t)positionArr[i], AlxFs_File_Seek_Origin_Set, &positionNew) == Alx_Ok);
+		ALX_TEST_CHECK(alxTest_mmc.numOfReadBlocks <= numOfReadBlocks + 1);
+		AlxTest_Fs_SeekRead(&file, positionArr[i]);
+	}
+
+	// Close
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+}
+static void AlxTest_Fs_FastSeek_Write(void)
+{
+	// Setup
+	AlxTest_Fs_Setup();
+	AlxTest_Fs_WriteFile("file.bin", ALX_TEST_FS_LEN);
+
+	// Open for read & write, file can be expanded, so normal seek is used
+	AlxFs_File file = {};
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "r+") == Alx_Ok);
+	ALX_TEST_CHECK(file.fatfsFile.cltbl == NULL);
+	AlxTest_Fs_SeekRead(&file, 200 * 1024);
+	AlxTest_Fs_SeekRead(&file, 1000);
+
+	// Expand
+	uint32_t positionNew = 0;
+	uint32_t size = 0;
+	ALX_TEST_CHECK(AlxFs_File_Seek(&alxFs, &file, 0, AlxFs_File_Seek_Origin_End, &positionNew) == Alx_Ok);
+	AlxTest_Fs_FillBuff(ALX_TEST_FS_LEN, 100);
+	ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &file, buff, 100) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_File_Size(&alxFs, &file, &size) == Alx_Ok);
+	ALX_TEST_CHECK(size == ALX_TEST_FS_LEN + 100);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+
+	// Read expanded file with fast seek
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "r") == Alx_Ok);
+	ALX_TEST_CHECK(file.fatfsFile.cltbl == file.fatfsClmt);
+	AlxTest_Fs_SeekRead(&file, ALX_TEST_FS_LEN + 100 - 16);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+}
+static void AlxTest_Fs_FastSeek_Fragmented(void)
+{
+	// Setup, interleaved writes, so each file has fragment per cluster
+	AlxTest_Fs_Setup();
+	AlxFs_File fileA = {};
+	AlxFs_File fileB = {};
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &fileA, "a.bin", "w") == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &fileB, "b.bin", "w") == Alx_Ok);
+	for (uint32_t position = 0; position < 16 * 512; position = position + 512)
+	{
+		AlxTest_Fs_FillBuff(position, 512);
+		ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &fileA, buff, 512) == Alx_Ok);
+		ALX_TEST_CHECK(AlxFs_File_Sync(&alxFs, &fileA) == Alx_Ok);
+		ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &fileB, buff, 512) == Alx_Ok);
+		ALX_TEST_CHECK(AlxFs_File_Sync(&alxFs, &fileB) == Alx_Ok);
+	}
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &fileA) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &fileB) == Alx_Ok);
+
+	// Open, too many fragments for cluster link map table, normal seek is used
+	AlxFs_File file = {};
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "a.bin", "r") == Alx_Ok);
+	ALX_TEST_CHECK(file.fatfsFile.cltbl == NULL);
+	AlxTest_Fs_SeekRead(&file, 15 * 512 + 100);
+	AlxTest_Fs_SeekRead(&file, 3 * 512 - 8);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+}
+static void AlxTest_Fs_Mutex_LockReleased(void)
+{
+	// Setup, every block access is also checked to be done with volume locked, see Mmc fake
+	AlxTest_Fs_Setup();
+	AlxFs_File file = {};
+	AlxFs_Dir dir = {};
+	AlxFs_Info info = {};
+	char str[16] = {};
+	uint32_t lenActual = 0;
+	uint32_t position = 0;
+	uint32_t numOfLocks = alxTest_osMutex.numOfLocks;
+
+	// Dir
+	ALX_TEST_CHECK(AlxFs_Dir_Make(&alxFs, "dir") == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_Dir_Make(&alxFs, "dir") != Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Write
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "dir/file.txt", "w") == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_WriteStr(&alxFs, &file, "line1\nline2\n") == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Sync(&alxFs, &file) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Preallocate(&alxFs, &file, 4096, true) != Alx_Ok);	// File is not empty
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Preallocate(&alxFs, &file, 4096, false) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Truncate(&alxFs, &file, 12) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Tell(&alxFs, &file, &position) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	alxTest_mmc.errWrite = Alx_Err;
+	ALX_TEST_CHECK(AlxFs_File_Sync(&alxFs, &file) != Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Read
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "missing.txt", "r") != Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "dir/file.txt", "r") == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_ReadStrUntil(&alxFs, &file, str, "\n", sizeof(str), &lenActual) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(strcmp(str, "line1\n") == 0);
+	ALX_TEST_CHECK(AlxFs_File_Rewind(&alxFs, &file) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Read(&alxFs, &file, str, 5, &lenActual) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Trace(&alxFs, "dir/file.txt", false) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Read error
+	AlxTest_Fs_WriteFile("file.bin", ALX_TEST_FS_LEN);
+	numOfLocks = alxTest_osMutex.numOfLocks;
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "r") == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	alxTest_mmc.errRead = Alx_Err;
+	ALX_TEST_CHECK(AlxFs_File_Read(&alxFs, &file, buff, sizeof(buff), &lenActual) != Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Dir read
+	ALX_TEST_CHECK(AlxFs_Dir_Open(&alxFs, &dir, "missing") != Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_Dir_Open(&alxFs, &dir, "dir") == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_Dir_Read(&alxFs, &dir, &info) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(strcmp(info.fatfsInfo.fname, "file.txt") == 0);
+	ALX_TEST_CHECK(AlxFs_Dir_Close(&alxFs, &dir) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_Dir_Trace(&alxFs, "dir", true, false) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Rename & remove
+	ALX_TEST_CHECK(AlxFs_Rename(&alxFs, "missing.txt", "new.txt") != Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_Rename(&alxFs, "dir/file.txt", "dir/new.txt") == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_Remove(&alxFs, "dir/new.txt") == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_Remove(&alxFs, "dir/new.txt") != Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Mount
+	ALX_TEST_CHECK(AlxFs_UnMount(&alxFs) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_MountFormat(&alxFs) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+}
+static void AlxTest_Fs_Mutex_ReadInChunks(void)
+{
+	// Setup
+	AlxTest_Fs_Setup();
+	AlxTest_Fs_WriteFile("file.bin", ALX_TEST_FS_LEN);
+	AlxOsMutex alxOsMutex = {};
+	AlxOsMutex_Ctor(&alxOsMutex);
+	static uint8_t chunkBuffA[1000] = {};
+	static uint8_t chunkBuffB[1000] = {};
+	uint32_t position = 0;
+	uint32_t readLen = 0;
+
+	// Read, callback is called with volume & caller mutex released
+	ALX_TEST_CHECK(AlxFs_File_ReadInChunks(&alxFs, "file.bin", chunkBuffA, sizeof(chunkBuffA), AlxTest_Fs_ChunkRead_Callback, &position, &readLen, &alxOsMutex) == Alx_Ok);
+	ALX_TEST_CHECK(readLen == ALX_TEST_FS_LEN);
+	ALX_TEST_CHECK(position == ALX_TEST_FS_LEN);
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocked == 0);
+
+	// Read pipelined
+	position = 0;
+	readLen = 0;
+	ALX_TEST_CHECK(AlxFs_File_ReadInChunks_Pipelined(&alxFs, "file.bin", chunkBuffA, chunkBuffB, sizeof(chunkBuffA), AlxTest_Fs_ChunkRead_Callback, &position, &readLen, &alxOsMutex, NULL) == Alx_Ok);
+	ALX_TEST_CHECK(readLen == ALX_TEST_FS_LEN);
+	ALX_TEST_CHECK(position == ALX_TEST_FS_LEN);
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocked == 0);
+
+	// Read missing file
+	ALX_TEST_CHECK(AlxFs_File_ReadInChunks(&alxFs, "missing.bin", chunkBuffA, sizeof(chunkBuffA), AlxTest_Fs_ChunkRead_Callback, &position, &readLen, &alxOsMutex) != Alx_Ok);
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocked == 0);
+}
+static void AlxTest_Fs_Maintenance_FlushWriteCache(void)
+{
+	// Setup, 3 sectors are written, they are collected in write cache
+	AlxTest_Fs_Setup();
+	AlxFs_File file = {};
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "w") == Alx_Ok);
+	AlxTest_Fs_FillBuff(0, 3 * 512);
+	ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &file, buff, 3 * 512) == Alx_Ok);
+	uint32_t numOfWrites = alxTest_mmc.numOfWrites;
+	uint32_t numOfWrittenBlocks = alxTest_mmc.numOfWrittenBlocks;
+	uint32_t numOfLocks = alxTest_osMutex.numOfLocks;
+
+	// Maintenance without time budget, nothing is done
+	ALX_TEST_CHECK(AlxFs_Maintenance(&alxFs, 0) == Alx_Ok);
+	ALX_TEST_CHECK(alxTest_mmc.numOfWrites == numOfWrites);
+	ALX_TEST_CHECK(alxTest_osMutex.numOfLocks == numOfLocks);
+
+	// Maintenance, collected sectors are written with single multi-block write
+	ALX_TEST_CHECK(AlxFs_Maintenance(&alxFs, 10) == Alx_Ok);
+	ALX_TEST_CHECK(alxTest_mmc.numOfWrites == numOfWrites + 1);
+	ALX_TEST_CHECK(alxTest_mmc.numOfWrittenBlocks >= numOfWrittenBlocks + 3);	// Data sectors, contiguous directory sector can also be collected
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Maintenance, nothing left to flush
+	ALX_TEST_CHECK(AlxFs_Maintenance(&alxFs, 10) == Alx_Ok);
+	ALX_TEST_CHECK(alxTest_mmc.numOfWrites == numOfWrites + 1);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Close & read
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "r") == Alx_Ok);
+	AlxTest_Fs_SeekRead(&file, 2 * 512 + 100);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+}
+static void AlxTest_Fs_Maintenance_Err(void)
+{
+	// Setup
+	AlxTest_Fs_Setup();
+	AlxFs_File file = {};
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "w") == Alx_Ok);
+	AlxTest_Fs_FillBuff(0, 3 * 512);
+	ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &file, buff, 3 * 512) == Alx_Ok);
+	uint32_t numOfLocks = alxTest_osMutex.numOfLocks;
+
+	// Maintenance, write error is returned & volume is released
+	alxTest_mmc.errWrite = Alx_Err;
+	ALX_TEST_CHECK(AlxFs_Maintenance(&alxFs, 10) != Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+
+	// Maintenance, failed sectors are dropped, FatFs reports error on file
+	ALX_TEST_CHECK(AlxFs_Maintenance(&alxFs, 10) == Alx_Ok);
+	AlxTest_Fs_CheckLockReleased(&numOfLocks);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+}
+static void AlxTest_Fs_Discard_ErrIgnored(void)
+{
+	// Setup
+	AlxTest_Fs_Setup();
+	AlxTest_Fs_WriteFile("old.bin", 64 * 1024);
+	uint32_t numOfErasedBlocks = alxTest_mmc.numOfErasedBlocks;
+
+	// Remove, clusters are trimmed on sync, discard fails, remove still succeeds
+	alxTest_mmc.errErase = Alx_Err;
+	ALX_TEST_CHECK(AlxFs_Remove(&alxFs, "old.bin") == Alx_Ok);
+	ALX_TEST_CHECK(alxTest_mmc.errErase == Alx_Ok);	// Fault was consumed by discard
+	ALX_TEST_CHECK(alxTest_mmc.numOfErasedBlocks == numOfErasedBlocks);
+
+	// Truncate, clusters are trimmed before next data write, discard fails, write & sync still succeed
+	AlxFs_File file = {};
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "w") == Alx_Ok);
+	AlxTest_Fs_FillBuff(0, sizeof(buff));
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &file, buff, sizeof(buff)) == Alx_Ok);
+	}
+	ALX_TEST_CHECK(AlxFs_File_Sync(&alxFs, &file) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_File_Rewind(&alxFs, &file) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_File_Truncate(&alxFs, &file, 0) == Alx_Ok);
+	alxTest_mmc.errErase = Alx_Err;
+	ALX_TEST_CHECK(AlxFs_File_Write(&alxFs, &file, buff, sizeof(buff)) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_File_Sync(&alxFs, &file) == Alx_Ok);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+	ALX_TEST_CHECK(alxTest_mmc.errErase == Alx_Ok);
+	ALX_TEST_CHECK(alxTest_mmc.numOfErasedBlocks == numOfErasedBlocks);
+
+	// Read
+	ALX_TEST_CHECK(AlxFs_File_Open(&alxFs, &file, "file.bin", "r") == Alx_Ok);
+	AlxTest_Fs_SeekRead(&file, 1000);
+	ALX_TEST_CHECK(AlxFs_File_Close(&alxFs, &file) == Alx_Ok);
+
+	// Remove, discard succeeds
+	ALX_TEST_CHECK(AlxFs_Remove(&alxFs, "file.bin") == Alx_Ok);
+	ALX_TEST_CHECK(alxTest_mmc.numOfErasedBlocks > numOfErasedBlocks);
+}
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxTest_Fs_FastSeek_ReadOnly);
+	ALX_TEST_RUN(AlxTest_Fs_FastSeek_Write);
+	ALX_TEST_RUN(AlxTest_Fs_FastSeek_Fragmented);
+	ALX_TEST_RUN(AlxTest_Fs_Mutex_LockReleased);
+	ALX_TEST_RUN(AlxTest_Fs_Mutex_ReadInChunks);
+	ALX_TEST_RUN(AlxTest_Fs_Maintenance_FlushWriteCache);
+	ALX_TEST_RUN(AlxTest_Fs_Maintenance_Err);
+	ALX_TEST_RUN(AlxTest_Fs_Discard_ErrIgnored);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
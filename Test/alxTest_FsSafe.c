@@ -0,0 +1,231 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest_FsSafe.c
+  * @brief		Auralix C Library - ALX File System Safe Module - Host Test
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxFsSafe.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Defines
+//******************************************************************************
+#define ALX_TEST_FS_SAFE_LEN 300
+#define ALX_TEST_FS_SAFE_BUFF_LEN 64
+#define ALX_TEST_FS_SAFE_READ_LEN 32
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxFs alxFs = {};
+static AlxFsSafe alxFsSafe = {};
+static uint8_t buffOrig[ALX_TEST_FS_SAFE_BUFF_LEN] = {};
+static uint8_t buffA[ALX_TEST_FS_SAFE_BUFF_LEN] = {};
+static uint8_t buffB[ALX_TEST_FS_SAFE_BUFF_LEN] = {};
+static uint8_t readData[ALX_TEST_FS_SAFE_LEN] = {};
+static uint32_t readLen = 0;
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static Alx_Status AlxTest_FsSafe_ChunkWrite_Callback(void* ctx, uint32_t offset, void* chunkData, uint32_t chunkLen)
+{
+	uint8_t seed = *(uint8_t*)ctx;
+	for (uint32_t i = 0; i < chunkLen; i++)
+	{
+		((uint8_t*)chunkData)[i] = (uint8_t)((offset + i) * 7 + seed);
+	}
+	return Alx_Ok;
+}
+static Alx_Status AlxTest_FsSafe_ChunkRead_Callback(void* ctx, void* chunkData, uint32_t chunkLenActual)
+{
+	(void)ctx;
+	ALX_TEST_CHECK(readLen + chunkLenActual <= sizeof(readData));
+	memcpy(&readData[readLen], chunkData, chunkLenActual);
+	readLen = readLen + chunkLenActual;
+	return Alx_Ok;
+}
+static bool AlxTest_FsSafe_IsReadData(uint8_t seed)
+{
+	if (readLen != ALX_TEST_FS_SAFE_LEN)
+	{
+		return false;
+	}
+	for (uint32_t i = 0; i < ALX_TEST_FS_SAFE_LEN; i++)
+	{
+		if (readData[i] != (uint8_t)(i * 7 + seed))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+static void AlxTest_FsSafe_Setup(void)
+{
+	uint8_t seed = 1;
+	AlxTest_Fs_Clear();
+	AlxFsSafe_Ctor(&alxFsSafe, &alxFs, false, buffOrig, buffA, buffB, sizeof(buffA));
+	ALX_TEST_CHECK(AlxFsSafe_File_WriteStream(&alxFsSafe, "/data.bin", ALX_TEST_FS_SAFE_LEN, AlxTest_FsSafe_ChunkWrite_Callback, &seed) == Alx_Ok);
+	readLen = 0;
+}
+
+
+//******************************************************************************
+// Tests
+//******************************************************************************
+static void AlxTest_FsSafe_Read_Setup(uint8_t* data)
+{
+	AlxTest_Fs_Clear();
+	AlxFsSafe_Ctor(&alxFsSafe, &alxFs, false, buffOrig, buffA, buffB, sizeof(buffA));
+	for (uint32_t i = 0; i < ALX_TEST_FS_SAFE_READ_LEN; i++)
+	{
+		data[i] = (uint8_t)(i * 7 + 1);
+	}
+	ALX_TEST_CHECK(AlxFsSafe_File_Write(&alxFsSafe, "/data.bin", data, ALX_TEST_FS_SAFE_READ_LEN) == Alx_Ok);
+}
+static void AlxTest_FsSafe_Read_CopyBGenDiff(void)
+{
+	// Setup, corrupt generation of CopyB, so fast path falls back to full reconciliation with CopyA already read
+	uint8_t dataWrite[ALX_TEST_FS_SAFE_READ_LEN] = {};
+	AlxTest_FsSafe_Read_Setup(dataWrite);
+	AlxTest_Fs_GetFile("/dataB.bin")->data[ALX_TEST_FS_SAFE_READ_LEN] ^= 0x01;
+
+	// Read, CopyA is used & CopyB is updated with CopyA
+	uint8_t data[ALX_TEST_FS_SAFE_READ_LEN] = {};
+	Alx_Status status = AlxFsSafe_File_Read(&alxFsSafe, "/data.bin", data, sizeof(data));
+	ALX_TEST_CHECK(status == AlxSafe_CopyAOkCopyBErr_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(memcmp(data, dataWrite, sizeof(data)) == 0);
+
+	// Read again, fast path
+	memset(data, 0, sizeof(data));
+	status = AlxFsSafe_File_Read(&alxFsSafe, "/data.bin", data, sizeof(data));
+	ALX_TEST_CHECK(status == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(memcmp(data, dataWrite, sizeof(data)) == 0);
+}
+static void AlxTest_FsSafe_Read_CopyACorrupted(void)
+{
+	// Setup, corrupt data of CopyA
+	uint8_t dataWrite[ALX_TEST_FS_SAFE_READ_LEN] = {};
+	AlxTest_FsSafe_Read_Setup(dataWrite);
+	AlxTest_Fs_GetFile("/data.bin")->data[10] ^= 0x01;
+
+	// Read, CopyB is used & CopyA is updated with CopyB
+	uint8_t data[ALX_TEST_FS_SAFE_READ_LEN] = {};
+	Alx_Status status = AlxFsSafe_File_Read(&alxFsSafe, "/data.bin", data, sizeof(data));
+	ALX_TEST_CHECK(status == AlxSafe_CopyAErrCopyBOk_OrigDontCare_UseCopyB);
+	ALX_TEST_CHECK(memcmp(data, dataWrite, sizeof(data)) == 0);
+
+	// Read again, fast path
+	memset(data, 0, sizeof(data));
+	status = AlxFsSafe_File_Read(&alxFsSafe, "/data.bin", data, sizeof(data));
+	ALX_TEST_CHECK(status == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(memcmp(data, dataWrite, sizeof(data)) == 0);
+}
+static void AlxTest_FsSafe_Stream_RoundTrip(void)
+{
+	// Setup
+	AlxTest_FsSafe_Setup();
+
+	// Read, both copies are same, so CopyA is used & read only once
+	Alx_Status status = AlxFsSafe_File_ReadStream(&alxFsSafe, "/data.bin", ALX_TEST_FS_SAFE_LEN, AlxTest_FsSafe_ChunkRead_Callback, NULL);
+	ALX_TEST_CHECK(status == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(AlxTest_FsSafe_IsReadData(1));
+
+	// Write again, copies get next generation & new data
+	uint8_t seed = 2;
+	ALX_TEST_CHECK(AlxFsSafe_File_WriteStream(&alxFsSafe, "/data.bin", ALX_TEST_FS_SAFE_LEN, AlxTest_FsSafe_ChunkWrite_Callback, &seed) == Alx_Ok);
+	readLen = 0;
+	status = AlxFsSafe_File_ReadStream(&alxFsSafe, "/data.bin", ALX_TEST_FS_SAFE_LEN, AlxTest_FsSafe_ChunkRead_Callback, NULL);
+	ALX_TEST_CHECK(status == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(AlxTest_FsSafe_IsReadData(2));
+}
+static void AlxTest_FsSafe_Stream_CopyACorrupted(void)
+{
+	// Setup, corrupt data of CopyA, trailer stays same
+	AlxTest_FsSafe_Setup();
+	AlxTest_Fs_GetFile("/data.bin")->data[100] ^= 0x01;
+
+	// Read, fast path passes corrupted chunks to callback & detects CRC error at end, so error is returned & CopyA is repaired from CopyB
+	Alx_Status status = AlxFsSafe_File_ReadStream(&alxFsSafe, "/data.bin", ALX_TEST_FS_SAFE_LEN, AlxTest_FsSafe_ChunkRead_Callback, NULL);
+	ALX_TEST_CHECK(status == Alx_Err);
+
+	// Read again, CopyA is OK
+	readLen = 0;
+	status = AlxFsSafe_File_ReadStream(&alxFsSafe, "/data.bin", ALX_TEST_FS_SAFE_LEN, AlxTest_FsSafe_ChunkRead_Callback, NULL);
+	ALX_TEST_CHECK(status == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(AlxTest_FsSafe_IsReadData(1));
+}
+static void AlxTest_FsSafe_Stream_CopyATrailerCorrupted(void)
+{
+	// Setup, corrupt generation of CopyA, so fast path is not used
+	AlxTest_FsSafe_Setup();
+	AlxTest_Fs_GetFile("/data.bin")->data[ALX_TEST_FS_SAFE_LEN] ^= 0x01;
+
+	// Read, CopyB is used & verified again while chunks are passed to callback
+	Alx_Status status = AlxFsSafe_File_ReadStream(&alxFsSafe, "/data.bin", ALX_TEST_FS_SAFE_LEN, AlxTest_FsSafe_ChunkRead_Callback, NULL);
+	ALX_TEST_CHECK(status == AlxSafe_CopyAErrCopyBOk_OrigDontCare_UseCopyB);
+	ALX_TEST_CHECK(AlxTest_FsSafe_IsReadData(1));
+}
+static void AlxTest_FsSafe_Stream_BothCopyCorrupted(void)
+{
+	// Setup, corrupt data of both copies
+	AlxTest_FsSafe_Setup();
+	AlxTest_Fs_GetFile("/data.bin")->data[10] ^= 0x01;
+	AlxTest_Fs_GetFile("/dataB.bin")->data[10] ^= 0x01;
+
+	// Read, error
+	Alx_Status status = AlxFsSafe_File_ReadStream(&alxFsSafe, "/data.bin", ALX_TEST_FS_SAFE_LEN, AlxTest_FsSafe_ChunkRead_Callback, NULL);
+	ALX_TEST_CHECK(status != Alx_Ok);
+	ALX_TEST_CHECK(status != AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxTest_FsSafe_Read_CopyBGenDiff);
+	ALX_TEST_RUN(AlxTest_FsSafe_Read_CopyACorrupted);
+	ALX_TEST_RUN(AlxTest_FsSafe_Stream_RoundTrip);
+	ALX_TEST_RUN(AlxTest_FsSafe_Stream_CopyACorrupted);
+	ALX_TEST_RUN(AlxTest_FsSafe_Stream_CopyATrailerCorrupted);
+	ALX_TEST_RUN(AlxTest_FsSafe_Stream_BothCopyCorrupted);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
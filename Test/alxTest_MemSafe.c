@@ -0,0 +1,325 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest_MemSafe.c
+  * @brief		Auralix C Library - ALX Memory Safe Module - Host Test
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxMemSafe.h"
+#include "alxParamGroup.h"
+#include "alxParamStore.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Defines
+//******************************************************************************
+#define ALX_TEST_MEM_SAFE_ADDR_A 0
+#define ALX_TEST_MEM_SAFE_ADDR_B 64
+#define ALX_TEST_MEM_SAFE_LEN 40
+#define ALX_TEST_MEM_SAFE_HANDLE_NUM_MAX 1000
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxMemRaw memRaw = {};
+static AlxCrc crc = {};
+static AlxMemSafe memSafe = {};
+static uint8_t buff1[ALX_TEST_MEM_SAFE_LEN + 2] = {};
+static uint8_t buff2[ALX_TEST_MEM_SAFE_LEN + 2] = {};
+static uint8_t dataWrite[ALX_TEST_MEM_SAFE_LEN] = {};
+static uint8_t dataRead[ALX_TEST_MEM_SAFE_LEN] = {};
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxTest_MemSafe_Setup(bool nonBlockingEnable, uint32_t len)
+{
+	AlxTest_MemRaw_Clear();
+	AlxMemRaw_Ctor(&memRaw);
+	AlxCrc_Ctor(&crc, AlxCrc_Config_Ccitt);
+	AlxMemSafe_Ctor(&memSafe, &memRaw, &crc, ALX_TEST_MEM_SAFE_ADDR_A, ALX_TEST_MEM_SAFE_ADDR_B, len, nonBlockingEnable, 3, 1, 10, buff1, sizeof(buff1), buff2, sizeof(buff2));
+	for (uint32_t i = 0; i < sizeof(dataWrite); i++)
+	{
+		dataWrite[i] = (uint8_t)(i * 7 + 1);
+	}
+	memset(dataRead, 0, sizeof(dataRead));
+}
+static uint32_t AlxTest_MemSafe_Handle(void)
+{
+	uint32_t numOfSteps = 0;
+	while (AlxMemSafe_IsBusy(&memSafe) && (numOfSteps < ALX_TEST_MEM_SAFE_HANDLE_NUM_MAX))
+	{
+		AlxMemSafe_Handle(&memSafe);
+		numOfSteps++;
+	}
+	ALX_TEST_CHECK(AlxMemSafe_IsBusy(&memSafe) == false);
+	return numOfSteps;
+}
+static void AlxTest_MemSafe_WriteNonBlocking(void)
+{
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, dataWrite, ALX_TEST_MEM_SAFE_LEN) == Alx_Ok);
+	AlxTest_MemSafe_Handle();
+	ALX_TEST_CHECK(AlxMemSafe_IsWriteDone(&memSafe));
+	ALX_TEST_CHECK(AlxMemSafe_IsWriteErr(&memSafe) == false);
+}
+static Alx_Status AlxTest_MemSafe_ReadNonBlocking(void)
+{
+	ALX_TEST_CHECK(AlxMemSafe_Read(&memSafe, dataRead, ALX_TEST_MEM_SAFE_LEN) == Alx_Ok);
+	AlxTest_MemSafe_Handle();
+	ALX_TEST_CHECK(AlxMemSafe_IsReadDone(&memSafe));
+	return AlxMemSafe_GetReadStatus(&memSafe);
+}
+
+
+//******************************************************************************
+// Tests
+//******************************************************************************
+static void AlxTest_MemSafe_NonBlocking_WriteRead(void)
+{
+	// Setup
+	AlxTest_MemSafe_Setup(true, ALX_TEST_MEM_SAFE_LEN);
+
+	// Write, started only, both copies are written in chunks by handle
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, dataWrite, ALX_TEST_MEM_SAFE_LEN) == Alx_Ok);
+	ALX_TEST_CHECK(AlxMemSafe_IsBusy(&memSafe));
+	ALX_TEST_CHECK(alxTest_memRaw.numOfWrites == 0);
+	ALX_TEST_CHECK(AlxTest_MemSafe_Handle() == 4);	// 2 chunks per copy
+	ALX_TEST_CHECK(AlxMemSafe_IsWriteDone(&memSafe));
+	ALX_TEST_CHECK(memcmp(&alxTest_memRaw.data[ALX_TEST_MEM_SAFE_ADDR_A], dataWrite, ALX_TEST_MEM_SAFE_LEN) == 0);
+	ALX_TEST_CHECK(memcmp(&alxTest_memRaw.data[ALX_TEST_MEM_SAFE_ADDR_B], dataWrite, ALX_TEST_MEM_SAFE_LEN) == 0);
+
+	// Read
+	ALX_TEST_CHECK(AlxTest_MemSafe_ReadNonBlocking() == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(memcmp(dataRead, dataWrite, ALX_TEST_MEM_SAFE_LEN) == 0);
+}
+static void AlxTest_MemSafe_NonBlocking_Busy(void)
+{
+	// Setup
+	AlxTest_MemSafe_Setup(true, ALX_TEST_MEM_SAFE_LEN);
+
+	// Read & write are rejected while write is in progress
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, dataWrite, ALX_TEST_MEM_SAFE_LEN) == Alx_Ok);
+	ALX_TEST_CHECK(AlxMemSafe_Read(&memSafe, dataRead, ALX_TEST_MEM_SAFE_LEN) == Alx_Err);
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, dataWrite, ALX_TEST_MEM_SAFE_LEN) == Alx_Err);
+	AlxTest_MemSafe_Handle();
+
+	// Read is accepted when idle
+	ALX_TEST_CHECK(AlxTest_MemSafe_ReadNonBlocking() == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+}
+static void AlxTest_MemSafe_NonBlocking_CopyACorrupted(void)
+{
+	// Setup
+	AlxTest_MemSafe_Setup(true, ALX_TEST_MEM_SAFE_LEN);
+	AlxTest_MemSafe_WriteNonBlocking();
+	alxTest_memRaw.data[ALX_TEST_MEM_SAFE_ADDR_A + 5] ^= 0x01;
+
+	// Read, CopyB is used & CopyA is updated with CopyB
+	ALX_TEST_CHECK(AlxTest_MemSafe_ReadNonBlocking() == AlxSafe_CopyAErrCopyBOk_OrigDontCare_UseCopyB);
+	ALX_TEST_CHECK(memcmp(dataRead, dataWrite, ALX_TEST_MEM_SAFE_LEN) == 0);
+	ALX_TEST_CHECK(memcmp(&alxTest_memRaw.data[ALX_TEST_MEM_SAFE_ADDR_A], &alxTest_memRaw.data[ALX_TEST_MEM_SAFE_ADDR_B], ALX_TEST_MEM_SAFE_LEN + 2) == 0);
+}
+static void AlxTest_MemSafe_NonBlocking_BothCopyErr(void)
+{
+	// Setup, nothing written
+	AlxTest_MemSafe_Setup(true, ALX_TEST_MEM_SAFE_LEN);
+
+	// Read
+	ALX_TEST_CHECK(AlxTest_MemSafe_ReadNonBlocking() == AlxSafe_BothCopyErr_OrigErr);
+}
+static void AlxTest_MemSafe_NonBlocking_ReadRetry(void)
+{
+	// Setup
+	AlxTest_MemSafe_Setup(true, ALX_TEST_MEM_SAFE_LEN);
+	AlxTest_MemSafe_WriteNonBlocking();
+
+	// Read, first memory read fails, read is retried from CopyA
+	alxTest_memRaw.errRead = Alx_Err;
+	ALX_TEST_CHECK(AlxTest_MemSafe_ReadNonBlocking() == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(memcmp(dataRead, dataWrite, ALX_TEST_MEM_SAFE_LEN) == 0);
+	ALX_TEST_CHECK(AlxMemSafe_IsReadErr(&memSafe) == false);
+}
+static void AlxTest_MemSafe_NonBlocking_WriteErr(void)
+{
+	// Setup, write fails on every try
+	AlxTest_MemSafe_Setup(true, ALX_TEST_MEM_SAFE_LEN);
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, dataWrite, ALX_TEST_MEM_SAFE_LEN) == Alx_Ok);
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		alxTest_memRaw.errWrite = Alx_Err;
+		AlxMemSafe_Handle(&memSafe);
+	}
+
+	// Check
+	ALX_TEST_CHECK(AlxMemSafe_IsBusy(&memSafe) == false);
+	ALX_TEST_CHECK(AlxMemSafe_IsWriteDone(&memSafe) == false);
+	ALX_TEST_CHECK(AlxMemSafe_IsWriteErr(&memSafe));
+}
+static void AlxTest_MemSafe_Delta(bool nonBlockingEnable)
+{
+	// Setup
+	AlxTest_MemSafe_Setup(nonBlockingEnable, ALX_TEST_MEM_SAFE_LEN);
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, dataWrite, ALX_TEST_MEM_SAFE_LEN) == Alx_Ok);
+	AlxTest_MemSafe_Handle();
+	ALX_TEST_CHECK(alxTest_memRaw.numOfWrites == 4);	// 2 pages per copy
+
+	// Write same data, nothing is written
+	alxTest_memRaw.numOfWrites = 0;
+	alxTest_memRaw.numOfWrittenBytes = 0;
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, dataWrite, ALX_TEST_MEM_SAFE_LEN) == Alx_Ok);
+	AlxTest_MemSafe_Handle();
+	ALX_TEST_CHECK(AlxMemSafe_IsWriteDone(&memSafe));
+	ALX_TEST_CHECK(alxTest_memRaw.numOfWrites == 0);
+
+	// Change byte in second page, only second page of each copy is written, CRC is in second page too
+	dataWrite[35] ^= 0xFF;
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, dataWrite, ALX_TEST_MEM_SAFE_LEN) == Alx_Ok);
+	AlxTest_MemSafe_Handle();
+	ALX_TEST_CHECK(AlxMemSafe_IsWriteDone(&memSafe));
+	ALX_TEST_CHECK(alxTest_memRaw.numOfWrites == 2);
+	ALX_TEST_CHECK(alxTest_memRaw.numOfWrittenBytes == 2 * (ALX_TEST_MEM_SAFE_LEN + 2 - ALX_MEM_SAFE_WRITE_DELTA_PAGE_LEN));
+
+	// Read
+	if (nonBlockingEnable)
+	{
+		ALX_TEST_CHECK(AlxTest_MemSafe_ReadNonBlocking() == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	}
+	else
+	{
+		ALX_TEST_CHECK(AlxMemSafe_Read(&memSafe, dataRead, ALX_TEST_MEM_SAFE_LEN) == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	}
+	ALX_TEST_CHECK(memcmp(dataRead, dataWrite, ALX_TEST_MEM_SAFE_LEN) == 0);
+}
+static void AlxTest_MemSafe_Delta_Blocking(void)
+{
+	AlxTest_MemSafe_Delta(false);
+}
+static void AlxTest_MemSafe_Delta_NonBlocking(void)
+{
+	AlxTest_MemSafe_Delta(true);
+}
+static void AlxTest_MemSafe_ParamGroup_Init_FreshRead(void)
+{
+	// Setup, group with 2 items
+	AlxParamItem paramItemArr[2] = {};
+	AlxParamItem* paramItemPtrArr[2] = { &paramItemArr[0], &paramItemArr[1] };
+	uint8_t valBuff[4] = {};
+	uint8_t valStoredBuff[4] = {};
+	uint8_t valToStoreBuff[4] = {};
+	AlxParamGroup paramGroup = {};
+	AlxParamItem_CtorUint16(&paramItemArr[0], NULL, AlxParamItem_Param, "a", 1, "group", 1, 0, 0, 0xFFFF, AlxParamItem_Ignore, false, NULL, 0, "", false);
+	AlxParamItem_CtorUint16(&paramItemArr[1], NULL, AlxParamItem_Param, "b", 2, "group", 1, 0, 0, 0xFFFF, AlxParamItem_Ignore, false, NULL, 0, "", false);
+	AlxTest_MemSafe_Setup(true, sizeof(valBuff));
+	AlxParamGroup_Ctor(&paramGroup, &memSafe, "group", sizeof(valBuff), valBuff, valStoredBuff, valToStoreBuff, paramItemPtrArr, ALX_ARR_LEN(paramItemPtrArr), 3);
+
+	// Old values are written & read, so that old read status is OK
+	uint16_t valOld[2] = { 0x1111, 0x2222 };
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, (uint8_t*)valOld, sizeof(valOld)) == Alx_Ok);
+	AlxTest_MemSafe_Handle();
+	ALX_TEST_CHECK(AlxMemSafe_Read(&memSafe, dataRead, sizeof(valOld)) == Alx_Ok);
+	AlxTest_MemSafe_Handle();
+
+	// New values write is started, but NOT handled
+	uint16_t valNew[2] = { 0x3333, 0x4444 };
+	ALX_TEST_CHECK(AlxMemSafe_Write(&memSafe, (uint8_t*)valNew, sizeof(valNew)) == Alx_Ok);
+
+	// Init, write in progress is finished first, then new values are read
+	ALX_TEST_CHECK(AlxParamGroup_Init(&paramGroup) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValUint16(&paramItemArr[0]) == 0x3333);
+	ALX_TEST_CHECK(AlxParamItem_GetValUint16(&paramItemArr[1]) == 0x4444);
+}
+static void AlxTest_MemSafe_ParamStore_BoundValStored(void)
+{
+	// Setup, group with 2 items, values are bound to 0..100
+	AlxParamItem paramItemArr[2] = {};
+	AlxParamItem* paramItemPtrArr[2] = { &paramItemArr[0], &paramItemArr[1] };
+	uint8_t valBuff[4] = {};
+	uint8_t valStoredBuff[4] = {};
+	uint8_t valToStoreBuff[4] = {};
+	AlxParamGroup paramGroup = {};
+	AlxParamGroup* paramGroupPtrArr[1] = { &paramGroup };
+	AlxParamStore paramStore = {};
+	Alx_Status statusParamGroup[1] = {};
+	AlxParamItem_CtorUint16(&paramItemArr[0], NULL, AlxParamItem_Param, "a", 1, "group", 1, 10, 0, 100, AlxParamItem_Bound, false, NULL, 0, "", false);
+	AlxParamItem_CtorUint16(&paramItemArr[1], NULL, AlxParamItem_Param, "b", 2, "group", 1, 20, 0, 100, AlxParamItem_Bound, false, NULL, 0, "", false);
+	AlxTest_MemSafe_Setup(true, sizeof(valBuff));
+	AlxParamGroup_Ctor(&paramGroup, &memSafe, "group", sizeof(valBuff), valBuff, valStoredBuff, valToStoreBuff, paramItemPtrArr, ALX_ARR_LEN(paramItemPtrArr), 3);
+	AlxParamStore_Ctor(&paramStore, paramGroupPtrArr, ALX_ARR_LEN(paramGroupPtrArr));
+	ALX_TEST_CHECK(AlxParamStore_Init(&paramStore, statusParamGroup, ALX_ARR_LEN(paramGroupPtrArr)) == Alx_Ok);
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		AlxParamStore_Handle(&paramStore);
+	}
+
+	// Set above max, value is bound, bound status is returned, but value is changed
+	ALX_TEST_CHECK(AlxParamItem_SetValUint16(&paramItemArr[0], 500) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValUint16(&paramItemArr[0]) == 100);
+	ALX_TEST_CHECK(AlxParamGroup_IsValChanged(&paramGroup));
+
+	// Handle, bound value is stored
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		AlxParamStore_Handle(&paramStore);
+	}
+	ALX_TEST_CHECK(AlxParamStore_IsErr(&paramStore) == false);
+	ALX_TEST_CHECK(AlxMemSafe_IsBusy(&memSafe) == false);
+	uint16_t valStored[2] = {};
+	ALX_TEST_CHECK(AlxMemSafe_Read(&memSafe, (uint8_t*)valStored, sizeof(valStored)) == Alx_Ok);
+	AlxTest_MemSafe_Handle();
+	ALX_TEST_CHECK(AlxMemSafe_GetReadStatus(&memSafe) == AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA);
+	ALX_TEST_CHECK(valStored[0] == 100);
+	ALX_TEST_CHECK(valStored[1] == 20);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxTest_MemSafe_NonBlocking_WriteRead);
+	ALX_TEST_RUN(AlxTest_MemSafe_NonBlocking_Busy);
+	ALX_TEST_RUN(AlxTest_MemSafe_NonBlocking_CopyACorrupted);
+	ALX_TEST_RUN(AlxTest_MemSafe_NonBlocking_BothCopyErr);
+	ALX_TEST_RUN(AlxTest_MemSafe_NonBlocking_ReadRetry);
+	ALX_TEST_RUN(AlxTest_MemSafe_NonBlocking_WriteErr);
+	ALX_TEST_RUN(AlxTest_MemSafe_Delta_Blocking);
+	ALX_TEST_RUN(AlxTest_MemSafe_Delta_NonBlocking);
+	ALX_TEST_RUN(AlxTest_MemSafe_ParamGroup_Init_FreshRead);
+	ALX_TEST_RUN(AlxTest_MemSafe_ParamStore_BoundValStored);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
@@ -0,0 +1,331 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest_ParamItem.c
+  * @brief		Auralix C Library - ALX Parameter Item Module - Host Test
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxParamItem.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static uint8_t valChanged_valOld[64] = {};
+static uint8_t valChanged_valNew[64] = {};
+static bool valChanged_isValOld = false;
+static uint32_t valChanged_numOfCalls = 0;
+static uint32_t valChanged_len = 0;
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxTest_ParamItem_ValChanged_Callback(void* ctx, uint32_t index, void* valOld)
+{
+	AlxParamItem* item = (AlxParamItem*)ctx;
+	uint32_t len = valChanged_len;
+	ALX_TEST_CHECK(index == 3);
+	valChanged_numOfCalls++;
+	valChanged_isValOld = (valOld != NULL);
+	if (valOld != NULL)
+	{
+		memcpy(valChanged_valOld, valOld, len);
+	}
+	memcpy(valChanged_valNew, AlxParamItem_GetValPtr(item), len);
+}
+static uint64_t AlxTest_ParamItem_Rand(void)
+{
+	static uint64_t state = 0x9E3779B97F4A7C15;
+	state = state ^ (state << 13);
+	state = state ^ (state >> 7);
+	state = state ^ (state << 17);
+	return state;
+}
+static uint32_t AlxTest_ParamItem_NumOfDigits(const char* str)
+{
+	// Count significant digits of formatted value
+	uint32_t numOfDigits = 0;
+	uint32_t numOfZeros = 0;
+	for (; (*str != '\0') && (*str != 'e'); str++)
+	{
+		if ((*str >= '1') && (*str <= '9'))
+		{
+			numOfDigits = numOfDigits + numOfZeros + 1;
+			numOfZeros = 0;
+		}
+		else if ((*str == '0') && (numOfDigits > 0))
+		{
+			numOfZeros++;
+		}
+	}
+	return numOfDigits;
+}
+static uint32_t AlxTest_ParamItem_NumOfDigitsShortest(double val, bool isFloat)
+{
+	// Reference, shortest precision, which converts back with C library
+	char str[64] = "";
+	for (uint32_t precision = 1; precision < 17; precision++)
+	{
+		snprintf(str, sizeof(str), "%.*e", (int)precision - 1, val);
+		if (isFloat ? (strtof(str, NULL) == (float)val) : (strtod(str, NULL) == val))
+		{
+			return precision;
+		}
+	}
+	return 17;
+}
+static void AlxTest_ParamItem_CheckDouble(AlxParamItem* item, double val)
+{
+	// Format, must be shortest & convert back exactly with C library
+	char str[64] = "";
+	ALX_TEST_CHECK(AlxParamItem_SetValDouble(item, val) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetVal_StrFormat(item, str, sizeof(str)) == Alx_Ok);
+	ALX_TEST_CHECK(strtod(str, NULL) == val);
+	ALX_TEST_CHECK(AlxTest_ParamItem_NumOfDigits(str) == AlxTest_ParamItem_NumOfDigitsShortest(val, false));
+
+	// Parse back, must be exact
+	ALX_TEST_CHECK(AlxParamItem_SetValDouble(item, 0) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(item, str) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(item) == val);
+}
+static void AlxTest_ParamItem_CheckFloat(AlxParamItem* item, float val)
+{
+	// Format, must be shortest & convert back exactly with C library
+	char str[64] = "";
+	ALX_TEST_CHECK(AlxParamItem_SetValFloat(item, val) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetVal_StrFormat(item, str, sizeof(str)) == Alx_Ok);
+	ALX_TEST_CHECK(strtof(str, NULL) == val);
+	ALX_TEST_CHECK(AlxTest_ParamItem_NumOfDigits(str) == AlxTest_ParamItem_NumOfDigitsShortest(val, true));
+
+	// Parse back, must be exact
+	ALX_TEST_CHECK(AlxParamItem_SetValFloat(item, 0) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(item, str) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValFloat(item) == val);
+}
+
+
+//******************************************************************************
+// Tests
+//******************************************************************************
+static void AlxTest_ParamItem_ValChanged_ValOld_Arr(void)
+{
+	// Setup, Arr longer than AlxParamItem_Val
+	AlxParamItem item = {};
+	uint8_t valDef[32] = { 1, 2, 3 };
+	uint8_t valBuff[32] = {};
+	uint8_t valDefBuff[32] = {};
+	uint32_t bitmap[1] = {};
+	AlxParamItem_Owner owner = { .pendingStoreBitmap = bitmap, .valChanged = AlxTest_ParamItem_ValChanged_Callback, .valChanged_Ctx = &item };
+	AlxParamItem_CtorArr(&item, NULL, AlxParamItem_Param, "arr", 1, "group", 1, valDef, valBuff, valDefBuff, sizeof(valBuff), AlxParamItem_Ignore, "", false);
+	AlxParamItem_SetOwner(&item, &owner, 3);
+	valChanged_numOfCalls = 0;
+	valChanged_len = sizeof(valBuff);
+
+	// Set, callback gets old & new value
+	uint8_t val[32] = {};
+	memset(val, 0xA5, sizeof(val));
+	AlxParamItem_SetValArr(&item, val);
+	ALX_TEST_CHECK(valChanged_numOfCalls == 1);
+	ALX_TEST_CHECK(valChanged_isValOld == true);
+	ALX_TEST_CHECK(memcmp(valChanged_valOld, valDef, sizeof(valDef)) == 0);
+	ALX_TEST_CHECK(memcmp(valChanged_valNew, val, sizeof(val)) == 0);
+
+	// Item flags pending store in owner bitmap & raises value changed
+	ALX_TEST_CHECK(bitmap[0] == (1u << 3));
+	ALX_TEST_CHECK(AlxParamItem_IsValChanged(&item) == true);
+	AlxParamItem_ClearValChanged(&item);
+	ALX_TEST_CHECK(AlxParamItem_IsValChanged(&item) == false);
+
+	// Set same, no callback
+	AlxParamItem_SetValArr(&item, val);
+	ALX_TEST_CHECK(valChanged_numOfCalls == 1);
+	ALX_TEST_CHECK(AlxParamItem_IsValChanged(&item) == false);
+}
+static void AlxTest_ParamItem_ValChanged_ValOld_Str(void)
+{
+	// Setup, Str longer than AlxParamItem_Val
+	AlxParamItem item = {};
+	uint8_t buff[32] = {};
+	AlxParamItem_CtorStr(&item, NULL, AlxParamItem_Param, "str", 1, "group", 1, "default_longer_than_8", AlxParamItem_Ignore, "", false, buff, sizeof(buff));
+	AlxParamItem_SetValToDef(&item);
+	uint32_t bitmap[1] = {};
+	AlxParamItem_Owner owner = { .pendingStoreBitmap = bitmap, .valChanged = AlxTest_ParamItem_ValChanged_Callback, .valChanged_Ctx = &item };
+	AlxParamItem_SetOwner(&item, &owner, 3);
+	valChanged_numOfCalls = 0;
+	valChanged_len = sizeof(buff);
+
+	// Set raw, same length as current value, callback gets old value
+	char val[32] = "changed_longer_than_8";
+	AlxParamItem_SetValRaw(&item, val);
+	ALX_TEST_CHECK(valChanged_numOfCalls == 1);
+	ALX_TEST_CHECK(valChanged_isValOld == true);
+	ALX_TEST_CHECK(strcmp((char*)valChanged_valOld, "default_longer_than_8") == 0);
+	ALX_TEST_CHECK(strcmp((char*)valChanged_valNew, "changed_longer_than_8") == 0);
+
+	// Set Str, callback gets old value
+	AlxParamItem_SetValStr(&item, "str_set_longer_than_8");
+	ALX_TEST_CHECK(valChanged_numOfCalls == 2);
+	ALX_TEST_CHECK(valChanged_isValOld == true);
+	ALX_TEST_CHECK(strcmp((char*)valChanged_valOld, "changed_longer_than_8") == 0);
+}
+static void AlxTest_ParamItem_StrFormat_Double_RoundTrip(void)
+{
+	// Setup
+	AlxParamItem item = {};
+	AlxParamItem_CtorDouble(&item, NULL, AlxParamItem_Param, "double", 1, "group", 1, 0, -DBL_MAX, DBL_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+	AlxParamItem_SetValToDef(&item);
+
+	// Values in [0, 1000)
+	for (uint32_t i = 0; i < 100000; i++)
+	{
+		double val = (double)(AlxTest_ParamItem_Rand() >> 11) / 9007199254740992.0 * 1000;
+		AlxTest_ParamItem_CheckDouble(&item, val);
+	}
+
+	// Random finite values over whole range, including denormals
+	for (uint32_t i = 0; i < 100000; i++)
+	{
+		uint64_t bits = AlxTest_ParamItem_Rand() & 0xFFEFFFFFFFFFFFFF;	// Exponent below inf/nan
+		double val = 0;
+		memcpy(&val, &bits, sizeof(val));
+		AlxTest_ParamItem_CheckDouble(&item, val);
+	}
+
+	// Edge values
+	AlxTest_ParamItem_CheckDouble(&item, DBL_MAX);
+	AlxTest_ParamItem_CheckDouble(&item, -DBL_MAX);
+	AlxTest_ParamItem_CheckDouble(&item, DBL_MIN);
+	AlxTest_ParamItem_CheckDouble(&item, 4.9406564584124654e-324);
+	AlxTest_ParamItem_CheckDouble(&item, 0.1);
+	AlxTest_ParamItem_CheckDouble(&item, 1e23);
+	AlxTest_ParamItem_CheckDouble(&item, 9007199254740993.0);
+	AlxTest_ParamItem_CheckDouble(&item, 5e-324 * 3);
+}
+static void AlxTest_ParamItem_StrFormat_Double_Parse(void)
+{
+	// Setup, max is largest value, which is allowed
+	AlxParamItem item = {};
+	AlxParamItem_CtorDouble(&item, NULL, AlxParamItem_Param, "double", 1, "group", 1, 0, 0, 1e300, AlxParamItem_Ignore, false, NULL, 0, "", false);
+	AlxParamItem_SetValToDef(&item);
+
+	// Large exponents are parsed exactly, max is reachable
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "1e200") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(&item) == 1e200);
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "1e300") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(&item) == 1e300);
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "1.000000000000001e300") != Alx_Ok);
+
+	// More digits than uint64_t, halfway between 1 and next double is rounded to even, anything above is rounded up
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "1.00000000000000011102230246251565404236316680908203125") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(&item) == 1.0);
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "1.00000000000000011102230246251565404236316680908203126") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(&item) == strtod("1.00000000000000011102230246251565404236316680908203126", NULL));
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "1.00000000000000011102230246251565404236316680908203124999") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(&item) == 1.0);
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "0.000000000000000000000000000000000000000000000000000000000000001234567890123456789012345e300") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(&item) == 1.234567890123456789012345e237);
+
+	// Random decimal strings match C library
+	for (uint32_t i = 0; i < 100000; i++)
+	{
+		char str[64] = "";
+		uint64_t rand = AlxTest_ParamItem_Rand();
+		snprintf(str, sizeof(str), "%llue%d", (unsigned long long)(rand >> (rand & 0x3F)), (int)(rand % 600) - 320);
+		double val = strtod(str, NULL);
+		if (val <= 1e300)
+		{
+			ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, str) == Alx_Ok);
+			ALX_TEST_CHECK(AlxParamItem_GetValDouble(&item) == val);
+		}
+	}
+
+	// Invalid format
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "1e") != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, ".") != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, "1.5x") != Alx_Ok);
+}
+static void AlxTest_ParamItem_StrFormat_Float_RoundTrip(void)
+{
+	// Setup
+	AlxParamItem item = {};
+	AlxParamItem_CtorFloat(&item, NULL, AlxParamItem_Param, "float", 1, "group", 1, 0, -FLT_MAX, FLT_MAX, AlxParamItem_Ignore, false, NULL, 0, "", false);
+	AlxParamItem_SetValToDef(&item);
+
+	// Random finite values over whole range, including denormals
+	for (uint32_t i = 0; i < 100000; i++)
+	{
+		uint32_t bits = (uint32_t)AlxTest_ParamItem_Rand() & 0xFF7FFFFF;	// Exponent below inf/nan
+		float val = 0;
+		memcpy(&val, &bits, sizeof(val));
+		AlxTest_ParamItem_CheckFloat(&item, val);
+	}
+
+	// Random decimal strings match C library
+	for (uint32_t i = 0; i < 100000; i++)
+	{
+		char str[64] = "";
+		uint64_t rand = AlxTest_ParamItem_Rand();
+		snprintf(str, sizeof(str), "%llue%d", (unsigned long long)(rand >> (rand & 0x3F)), (int)(rand % 100) - 60);
+		float val = strtof(str, NULL);
+		if (val <= FLT_MAX)
+		{
+			ALX_TEST_CHECK(AlxParamItem_SetVal_StrFormat(&item, str) == Alx_Ok);
+			ALX_TEST_CHECK(AlxParamItem_GetValFloat(&item) == val);
+		}
+	}
+
+	// Edge values
+	AlxTest_ParamItem_CheckFloat(&item, FLT_MAX);
+	AlxTest_ParamItem_CheckFloat(&item, FLT_MIN);
+	AlxTest_ParamItem_CheckFloat(&item, 1.4e-45f);
+	AlxTest_ParamItem_CheckFloat(&item, 0.1f);
+	AlxTest_ParamItem_CheckFloat(&item, 16777217.0f);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxTest_ParamItem_ValChanged_ValOld_Arr);
+	ALX_TEST_RUN(AlxTest_ParamItem_ValChanged_ValOld_Str);
+	ALX_TEST_RUN(AlxTest_ParamItem_StrFormat_Double_RoundTrip);
+	ALX_TEST_RUN(AlxTest_ParamItem_StrFormat_Double_Parse);
+	ALX_TEST_RUN(AlxTest_ParamItem_StrFormat_Float_RoundTrip);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
@@ -0,0 +1,301 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest_ParamKvStore.c
+  * @brief		Auralix C Library - ALX Parameter Key-Value Store Module - Host Test
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxParamKvStore.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxFs alxFs = {};
+static AlxParamKvStore_LogIndexEntry logIndex[8] = {};
+static uint8_t logBuff[64] = {};
+static AlxParamKvStore paramKvStore = {};
+static AlxTest_Fs alxTest_fsSaved = {};
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxTest_ParamKvStore_Init(void)
+{
+	AlxParamKvStore_Ctor(&paramKvStore, logIndex, ALX_ARR_LEN(logIndex), logBuff, sizeof(logBuff), &alxFs);
+	ALX_TEST_CHECK(AlxParamKvStore_Init(&paramKvStore) == Alx_Ok);
+}
+static void AlxTest_ParamKvStore_Setup(void)
+{
+	AlxTest_Fs_Clear();
+	AlxTest_ParamKvStore_Init();
+}
+static void AlxTest_ParamKvStore_PowerLoss(void)
+{
+	// Files are kept, open handles & store state are lost
+	alxTest_fsSaved = alxTest_fs;
+	AlxTest_Fs_Clear();
+	alxTest_fs = alxTest_fsSaved;
+}
+static void AlxTest_ParamKvStore_Set(const char* key, uint32_t val)
+{
+	ALX_TEST_CHECK(AlxParamKvStore_Set(&paramKvStore, key, &val, sizeof(val)) == Alx_Ok);
+}
+static void AlxTest_ParamKvStore_CheckVal(const char* key, uint32_t valExpected)
+{
+	uint32_t val = 0;
+	uint32_t lenActual = 0;
+	ALX_TEST_CHECK(AlxParamKvStore_Get(&paramKvStore, key, &val, sizeof(val), &lenActual) == Alx_Ok);
+	ALX_TEST_CHECK(lenActual == sizeof(val));
+	ALX_TEST_CHECK(val == valExpected);
+}
+static void AlxTest_ParamKvStore_CheckNoVal(const char* key)
+{
+	uint32_t val = 0;
+	uint32_t lenActual = 0;
+	ALX_TEST_CHECK(AlxParamKvStore_Get(&paramKvStore, key, &val, sizeof(val), &lenActual) != Alx_Ok);
+}
+static uint32_t AlxTest_ParamKvStore_GetLogLen(void)
+{
+	AlxTest_Fs_File* fsFile = AlxTest_Fs_GetFile(ALX_PARAM_KV_STORE_LOG_PATH);
+	ALX_TEST_CHECK(fsFile != NULL);
+	return (fsFile != NULL) ? fsFile->len : 0;
+}
+
+
+//******************************************************************************
+// Tests
+//******************************************************************************
+static void AlxTest_ParamKvStore_SetGet_Reload(void)
+{
+	// Setup, more keys than half of index, so probing is used
+	AlxTest_ParamKvStore_Setup();
+	AlxTest_ParamKvStore_CheckNoVal("a");
+
+	// Set
+	const char* keyArr[] = { "a", "b", "c", "d", "e", "f" };
+	for (uint32_t i = 0; i < ALX_ARR_LEN(keyArr); i++)
+	{
+		AlxTest_ParamKvStore_Set(keyArr[i], i);
+	}
+	AlxTest_ParamKvStore_Set("c", 100);
+
+	// Get
+	AlxTest_ParamKvStore_CheckVal("a", 0);
+	AlxTest_ParamKvStore_CheckVal("c", 100);
+	AlxTest_ParamKvStore_CheckVal("f", 5);
+
+	// Reload, index is rebuilt from log, latest record wins
+	ALX_TEST_CHECK(AlxParamKvStore_DeInit(&paramKvStore) == Alx_Ok);
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 0);
+	AlxTest_ParamKvStore_CheckVal("c", 100);
+	AlxTest_ParamKvStore_CheckVal("f", 5);
+	AlxTest_ParamKvStore_CheckNoVal("g");
+}
+static void AlxTest_ParamKvStore_Remove(void)
+{
+	// Setup
+	AlxTest_ParamKvStore_Setup();
+	AlxTest_ParamKvStore_Set("a", 1);
+	AlxTest_ParamKvStore_Set("b", 2);
+
+	// Remove
+	ALX_TEST_CHECK(AlxParamKvStore_Remove(&paramKvStore, "a") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamKvStore_Remove(&paramKvStore, "a") != Alx_Ok);
+	AlxTest_ParamKvStore_CheckNoVal("a");
+
+	// Reload
+	AlxTest_ParamKvStore_PowerLoss();
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckNoVal("a");
+	AlxTest_ParamKvStore_CheckVal("b", 2);
+}
+static void AlxTest_ParamKvStore_TornTail(void)
+{
+	// Setup, last record is only partially written
+	AlxTest_ParamKvStore_Setup();
+	AlxTest_ParamKvStore_Set("a", 1);
+	uint32_t logLenValid = AlxTest_ParamKvStore_GetLogLen();
+	AlxTest_ParamKvStore_Set("a", 2);
+	AlxTest_ParamKvStore_PowerLoss();
+	AlxTest_Fs_GetFile(ALX_PARAM_KV_STORE_LOG_PATH)->len -= 3;
+
+	// Reload, torn record is truncated away
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 1);
+	ALX_TEST_CHECK(AlxTest_ParamKvStore_GetLogLen() == logLenValid);
+
+	// Set, appended after valid records
+	AlxTest_ParamKvStore_Set("a", 3);
+	AlxTest_ParamKvStore_PowerLoss();
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 3);
+}
+static void AlxTest_ParamKvStore_CrcErr(void)
+{
+	// Setup, value byte of last record is corrupted
+	AlxTest_ParamKvStore_Setup();
+	AlxTest_ParamKvStore_Set("a", 1);
+	uint32_t logLenValid = AlxTest_ParamKvStore_GetLogLen();
+	AlxTest_ParamKvStore_Set("b", 2);
+	AlxTest_ParamKvStore_PowerLoss();
+	AlxTest_Fs_GetFile(ALX_PARAM_KV_STORE_LOG_PATH)->data[logLenValid + ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + 1] ^= 0x01;
+
+	// Reload, scan stops at corrupted record
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 1);
+	AlxTest_ParamKvStore_CheckNoVal("b");
+	ALX_TEST_CHECK(AlxTest_ParamKvStore_GetLogLen() == logLenValid);
+}
+static void AlxTest_ParamKvStore_Batch(void)
+{
+	// Setup
+	AlxTest_ParamKvStore_Setup();
+	AlxTest_ParamKvStore_Set("a", 1);
+
+	// Commit, batch records are visible only after commit
+	ALX_TEST_CHECK(AlxParamKvStore_BeginBatch(&paramKvStore) == Alx_Ok);
+	AlxTest_ParamKvStore_Set("a", 2);
+	AlxTest_ParamKvStore_Set("b", 3);
+	AlxTest_ParamKvStore_CheckVal("a", 1);
+	ALX_TEST_CHECK(AlxParamKvStore_Commit(&paramKvStore) == Alx_Ok);
+	AlxTest_ParamKvStore_CheckVal("a", 2);
+	AlxTest_ParamKvStore_CheckVal("b", 3);
+
+	// Abort, batch records are discarded
+	uint32_t logLen = AlxTest_ParamKvStore_GetLogLen();
+	ALX_TEST_CHECK(AlxParamKvStore_BeginBatch(&paramKvStore) == Alx_Ok);
+	AlxTest_ParamKvStore_Set("a", 4);
+	ALX_TEST_CHECK(AlxParamKvStore_AbortBatch(&paramKvStore) == Alx_Ok);
+	AlxTest_ParamKvStore_CheckVal("a", 2);
+	ALX_TEST_CHECK(AlxTest_ParamKvStore_GetLogLen() == logLen);
+
+	// Interrupted batch, records without commit record are dropped on reload
+	ALX_TEST_CHECK(AlxParamKvStore_BeginBatch(&paramKvStore) == Alx_Ok);
+	AlxTest_ParamKvStore_Set("a", 5);
+	AlxTest_ParamKvStore_Set("c", 6);
+	AlxTest_ParamKvStore_PowerLoss();
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 2);
+	AlxTest_ParamKvStore_CheckVal("b", 3);
+	AlxTest_ParamKvStore_CheckNoVal("c");
+	ALX_TEST_CHECK(AlxTest_ParamKvStore_GetLogLen() == logLen);
+
+	// Reload, committed batch is applied
+	AlxTest_ParamKvStore_PowerLoss();
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 2);
+	AlxTest_ParamKvStore_CheckVal("b", 3);
+}
+static void AlxTest_ParamKvStore_Compact(void)
+{
+	// Setup
+	AlxTest_ParamKvStore_Setup();
+	ALX_TEST_CHECK(AlxParamKvStore_BeginBatch(&paramKvStore) == Alx_Ok);
+	AlxTest_ParamKvStore_Set("batch", 7);
+	ALX_TEST_CHECK(AlxParamKvStore_Commit(&paramKvStore) == Alx_Ok);
+	AlxTest_ParamKvStore_Set("removed", 8);
+	ALX_TEST_CHECK(AlxParamKvStore_Remove(&paramKvStore, "removed") == Alx_Ok);
+
+	// Set many times, log is compacted, so it never exceeds max length
+	for (uint32_t i = 0; i < 1000; i++)
+	{
+		AlxTest_ParamKvStore_Set((i % 2) ? "a" : "b", i);
+		ALX_TEST_CHECK(AlxTest_ParamKvStore_GetLogLen() <= ALX_PARAM_KV_STORE_LOG_LEN_MAX);
+	}
+	ALX_TEST_CHECK(AlxTest_Fs_GetFile(ALX_PARAM_KV_STORE_LOG_PATH_TMP) == NULL);
+
+	// Reload, latest values are kept, committed batch record survives compaction
+	AlxTest_ParamKvStore_PowerLoss();
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 999);
+	AlxTest_ParamKvStore_CheckVal("b", 998);
+	AlxTest_ParamKvStore_CheckVal("batch", 7);
+	AlxTest_ParamKvStore_CheckNoVal("removed");
+}
+static void AlxTest_ParamKvStore_Compact_Interrupted(void)
+{
+	// Setup, compaction was interrupted after old log was removed, before tmp log was renamed
+	AlxTest_ParamKvStore_Setup();
+	AlxTest_ParamKvStore_Set("a", 1);
+	AlxTest_ParamKvStore_Set("b", 2);
+	AlxTest_ParamKvStore_PowerLoss();
+	AlxTest_Fs_File* fsFile = AlxTest_Fs_GetFile(ALX_PARAM_KV_STORE_LOG_PATH);
+	strcpy(fsFile->path, ALX_PARAM_KV_STORE_LOG_PATH_TMP);
+
+	// Reload, tmp log is renamed
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 1);
+	AlxTest_ParamKvStore_CheckVal("b", 2);
+	ALX_TEST_CHECK(AlxTest_Fs_GetFile(ALX_PARAM_KV_STORE_LOG_PATH_TMP) == NULL);
+}
+static void AlxTest_ParamKvStore_OpenErr(void)
+{
+	// Setup
+	AlxTest_ParamKvStore_Setup();
+	AlxTest_ParamKvStore_Set("a", 1);
+	uint32_t logLen = AlxTest_ParamKvStore_GetLogLen();
+	AlxTest_ParamKvStore_PowerLoss();
+
+	// Init, open error other than missing file is returned, log is not recreated
+	alxTest_fs.errFileOpen = Alx_Err;
+	AlxParamKvStore_Ctor(&paramKvStore, logIndex, ALX_ARR_LEN(logIndex), logBuff, sizeof(logBuff), &alxFs);
+	ALX_TEST_CHECK(AlxParamKvStore_Init(&paramKvStore) == Alx_Err);
+	ALX_TEST_CHECK(AlxTest_ParamKvStore_GetLogLen() == logLen);
+
+	// Init
+	AlxTest_ParamKvStore_Init();
+	AlxTest_ParamKvStore_CheckVal("a", 1);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxTest_ParamKvStore_SetGet_Reload);
+	ALX_TEST_RUN(AlxTest_ParamKvStore_Remove);
+	ALX_TEST_RUN(AlxTest_ParamKvStore_TornTail);
+	ALX_TEST_RUN(AlxTest_ParamKvStore_CrcErr);
+	ALX_TEST_RUN(AlxTest_ParamKvStore_Batch);
+	ALX_TEST_RUN(AlxTest_ParamKvStore_Compact);
+	ALX_TEST_RUN(AlxTest_ParamKvStore_Compact_Interrupted);
+	ALX_TEST_RUN(AlxTest_ParamKvStore_OpenErr);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
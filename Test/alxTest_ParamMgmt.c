@@ -0,0 +1,374 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxTest_ParamMgmt.c
+  * @brief		Auralix C Library - ALX Parameter Management Module - Host Test
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxTest.h"
+#include "alxParamMgmt.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB) && defined(ALX_PC)
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxFs alxFs = {};
+static AlxParamKvStore_LogIndexEntry logIndex[8] = {};
+static uint8_t logBuff[256] = {};
+static AlxParamKvStore paramKvStore = {};
+static AlxParamItem paramItemArr[4] = {};
+static uint8_t paramItemStrBuff[ALX_PARAM_ITEM_BUFF_LEN] = {};
+static AlxParamMgmt paramMgmt = {};
+static uint32_t bitmap[ALX_PARAM_MGMT_BITMAP_LEN(40)] = {};
+#if defined(ALX_PARAM_MGMT_INDEX)
+static uint16_t idIndex[40] = {};
+static uint16_t keyIndex[80] = {};
+#endif
+static uint8_t snapshot[128] = {};
+static uint32_t snapshotLen = 0;
+static uint32_t valChanged_lastId = 0;
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxTest_ParamMgmt_Setup(void)
+{
+	AlxTest_Fs_Clear();
+	AlxParamKvStore_Ctor(&paramKvStore, logIndex, ALX_ARR_LEN(logIndex), logBuff, sizeof(logBuff), &alxFs);
+	ALX_TEST_CHECK(AlxParamKvStore_Init(&paramKvStore) == Alx_Ok);
+	AlxParamItem_CtorUint16(&paramItemArr[0], &paramKvStore, AlxParamItem_Param, "cnt", 1, "group", 1, 10, 0, 1000, AlxParamItem_Ignore, false, NULL, 0, "", false);
+	AlxParamItem_CtorDouble(&paramItemArr[1], &paramKvStore, AlxParamItem_Param, "gain", 2, "group", 1, 1.0, -100.0, 100.0, AlxParamItem_Ignore, false, NULL, 0, "", false);
+	AlxParamItem_CtorStr(&paramItemArr[2], &paramKvStore, AlxParamItem_Param, "name", 3, "group", 1, "default", AlxParamItem_Ignore, "", false, paramItemStrBuff, sizeof(paramItemStrBuff));
+	AlxParamItem_CtorUint16(&paramItemArr[3], &paramKvStore, AlxParamItem_Var, "state", 4, "group", 1, 0, 0, 1000, AlxParamItem_Ignore, false, NULL, 0, "", false);
+	for (uint32_t i = 0; i < ALX_ARR_LEN(paramItemArr); i++)
+	{
+		AlxParamItem_SetValToDef(&paramItemArr[i]);
+	}
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	AlxParamMgmt_Ctor(&paramMgmt, paramItemArr, idIndex, keyIndex, ALX_ARR_LEN(keyIndex), bitmap, ALX_ARR_LEN(paramItemArr));
+	#else
+	AlxParamMgmt_Ctor(&paramMgmt, paramItemArr, bitmap, ALX_ARR_LEN(paramItemArr));
+	#endif
+}
+static void AlxTest_ParamMgmt_Export(void)
+{
+	ALX_TEST_CHECK(AlxParamItem_SetValUint16(&paramItemArr[0], 0x0123) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_SetValDouble(&paramItemArr[1], -2.5) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_SetValStr(&paramItemArr[2], "abc") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamMgmt_ExportSnapshot(&paramMgmt, snapshot, sizeof(snapshot), &snapshotLen) == Alx_Ok);
+}
+static void AlxTest_ParamMgmt_ValChanged_Callback(void* ctx, uint32_t id, void* valOld, void* valNew)
+{
+	(void)valOld;
+	(void)valNew;
+	(*(uint32_t*)ctx)++;
+	valChanged_lastId = id;
+}
+static void AlxTest_ParamMgmt_UpdateCrc(void)
+{
+	AlxCrc alxCrc = {};
+	AlxCrc_Ctor(&alxCrc, AlxCrc_Config_Ccitt);
+	uint32_t crc = AlxCrc_Calc(&alxCrc, snapshot, snapshotLen - 2);
+	snapshot[snapshotLen - 2] = (uint8_t)crc;
+	snapshot[snapshotLen - 1] = (uint8_t)(crc >> 8);
+}
+
+
+//******************************************************************************
+// Tests
+//******************************************************************************
+static void AlxTest_ParamMgmt_Snapshot_LittleEndian(void)
+{
+	// Setup
+	AlxTest_ParamMgmt_Setup();
+	AlxTest_ParamMgmt_Export();
+
+	// Header, ver & numOfRecs, Var item is NOT exported
+	ALX_TEST_CHECK(snapshot[0] == ALX_PARAM_MGMT_SNAPSHOT_VER && snapshot[1] == 0);
+	ALX_TEST_CHECK(snapshot[2] == 3 && snapshot[3] == 0);
+
+	// Uint16 record, id, dataType, valLen & val
+	const uint8_t rec0[] = { 0x01, 0x00, 0x00, 0x00, AlxParamItem_Uint16, 0x02, 0x00, 0x23, 0x01 };
+	ALX_TEST_CHECK(memcmp(&snapshot[4], rec0, sizeof(rec0)) == 0);
+
+	// Double record, -2.5 is 0xC004000000000000
+	const uint8_t rec1[] = { 0x02, 0x00, 0x00, 0x00, AlxParamItem_Double, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC0 };
+	ALX_TEST_CHECK(memcmp(&snapshot[13], rec1, sizeof(rec1)) == 0);
+
+	// Str record, with null terminator
+	const uint8_t rec2[] = { 0x03, 0x00, 0x00, 0x00, AlxParamItem_Str, 0x04, 0x00, 'a', 'b', 'c', '\0' };
+	ALX_TEST_CHECK(memcmp(&snapshot[28], rec2, sizeof(rec2)) == 0);
+	ALX_TEST_CHECK(snapshotLen == 28 + sizeof(rec2) + 2);
+}
+static void AlxTest_ParamMgmt_Snapshot_RoundTrip(void)
+{
+	// Setup
+	AlxTest_ParamMgmt_Setup();
+	AlxTest_ParamMgmt_Export();
+
+	// Reset & import
+	for (uint32_t i = 0; i < ALX_ARR_LEN(paramItemArr); i++)
+	{
+		AlxParamItem_SetValToDef(&paramItemArr[i]);
+	}
+	ALX_TEST_CHECK(AlxParamMgmt_ImportSnapshot(&paramMgmt, snapshot, snapshotLen) == Alx_Ok);
+
+	// Check
+	char str[ALX_PARAM_ITEM_BUFF_LEN] = "";
+	ALX_TEST_CHECK(AlxParamItem_GetValUint16(&paramItemArr[0]) == 0x0123);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(&paramItemArr[1]) == -2.5);
+	ALX_TEST_CHECK(AlxParamItem_GetValStr(&paramItemArr[2], str, sizeof(str)) == Alx_Ok);
+	ALX_TEST_CHECK(strcmp(str, "abc") == 0);
+
+	// Check that changed values were stored
+	uint16_t valStored = 0;
+	uint32_t lenActual = 0;
+	ALX_TEST_CHECK(AlxParamKvStore_Get(&paramKvStore, "cnt", &valStored, sizeof(valStored), &lenActual) == Alx_Ok);
+	ALX_TEST_CHECK(valStored == 0x0123);
+}
+static void AlxTest_ParamMgmt_Snapshot_Atomic(void)
+{
+	// Setup, Double record value out of range, CRC is OK
+	AlxTest_ParamMgmt_Setup();
+	AlxTest_ParamMgmt_Export();
+	snapshot[13 + 7 + 7] = 0x7F;	// Double sign & exponent MSB, way above valMax
+	AlxTest_ParamMgmt_UpdateCrc();
+	AlxParamItem_SetValToDef(&paramItemArr[0]);
+
+	// Import, rejected & NO item is changed, also not the ones before invalid record
+	ALX_TEST_CHECK(AlxParamMgmt_ImportSnapshot(&paramMgmt, snapshot, snapshotLen) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValUint16(&paramItemArr[0]) == 10);
+	ALX_TEST_CHECK(AlxParamItem_GetValDouble(&paramItemArr[1]) == -2.5);
+}
+static void AlxTest_ParamMgmt_Snapshot_RepeatedId(void)
+{
+	// Setup, two valid Uint16 records with same id, CRC is OK
+	AlxTest_ParamMgmt_Setup();
+	const uint8_t data[] =
+	{
+		ALX_PARAM_MGMT_SNAPSHOT_VER, 0x00, 0x02, 0x00,
+		0x01, 0x00, 0x00, 0x00, AlxParamItem_Uint16, 0x02, 0x00, 0x05, 0x00,
+		0x01, 0x00, 0x00, 0x00, AlxParamItem_Uint16, 0x02, 0x00, 0x06, 0x00,
+		0x00, 0x00
+	};
+	memcpy(snapshot, data, sizeof(data));
+	snapshotLen = sizeof(data);
+	AlxTest_ParamMgmt_UpdateCrc();
+
+	// Import, rejected
+	ALX_TEST_CHECK(AlxParamMgmt_ImportSnapshot(&paramMgmt, snapshot, snapshotLen) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValUint16(&paramItemArr[0]) == 10);
+
+	// Only first record, accepted
+	snapshot[2] = 0x01;
+	snapshotLen = 4 + 9 + 2;
+	AlxTest_ParamMgmt_UpdateCrc();
+	ALX_TEST_CHECK(AlxParamMgmt_ImportSnapshot(&paramMgmt, snapshot, snapshotLen) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValUint16(&paramItemArr[0]) == 5);
+}
+static void AlxTest_ParamMgmt_Snapshot_Crc(void)
+{
+	// Setup, value changed without CRC update
+	AlxTest_ParamMgmt_Setup();
+	AlxTest_ParamMgmt_Export();
+	snapshot[11] = 0x05;
+	AlxParamItem_SetValToDef(&paramItemArr[0]);
+
+	// Import, rejected
+	ALX_TEST_CHECK(AlxParamMgmt_ImportSnapshot(&paramMgmt, snapshot, snapshotLen) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_GetValUint16(&paramItemArr[0]) == 10);
+}
+static void AlxTest_ParamMgmt_Lookup(void)
+{
+	// Setup, ids are not ordered, so id index has to be sorted
+	static AlxParamItem lookupItemArr[20] = {};
+	static char lookupKeyArr[20][8] = {};
+	AlxParamMgmt lookupMgmt = {};
+	AlxTest_Fs_Clear();
+	for (uint32_t i = 0; i < ALX_ARR_LEN(lookupItemArr); i++)
+	{
+		sprintf(lookupKeyArr[i], "key%u", (unsigned int)i);
+		AlxParamItem_CtorUint16(&lookupItemArr[i], &paramKvStore, AlxParamItem_Param, lookupKeyArr[i], 100 + (i * 7) % 20, "group", 1, 0, 0, 1000, AlxParamItem_Ignore, false, NULL, 0, "", false);
+		AlxParamItem_SetValToDef(&lookupItemArr[i]);
+	}
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	AlxParamMgmt_Ctor(&lookupMgmt, lookupItemArr, idIndex, keyIndex, ALX_ARR_LEN(keyIndex), bitmap, ALX_ARR_LEN(lookupItemArr));
+	#else
+	AlxParamMgmt_Ctor(&lookupMgmt, lookupItemArr, bitmap, ALX_ARR_LEN(lookupItemArr));
+	#endif
+
+	// Find every item by id & key
+	for (uint32_t i = 0; i < ALX_ARR_LEN(lookupItemArr); i++)
+	{
+		uint32_t index = 0xFFFFFFFF;
+		ALX_TEST_CHECK(AlxParamMgmt_ById_GetIndex(&lookupMgmt, 100 + (i * 7) % 20, &index) == Alx_Ok);
+		ALX_TEST_CHECK(index == i);
+		index = 0xFFFFFFFF;
+		ALX_TEST_CHECK(AlxParamMgmt_ByKey_GetIndex(&lookupMgmt, lookupKeyArr[i], &index) == Alx_Ok);
+		ALX_TEST_CHECK(index == i);
+	}
+
+	// Missing id & key
+	uint32_t index = 0;
+	ALX_TEST_CHECK(AlxParamMgmt_ById_GetIndex(&lookupMgmt, 0, &index) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamMgmt_ById_GetIndex(&lookupMgmt, 99, &index) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamMgmt_ById_GetIndex(&lookupMgmt, 120, &index) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamMgmt_ByKey_GetIndex(&lookupMgmt, "key20", &index) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamMgmt_ByKey_GetIndex(&lookupMgmt, "key", &index) != Alx_Ok);
+	ALX_TEST_CHECK(AlxParamMgmt_ByKey_GetIndex(&lookupMgmt, "", &index) != Alx_Ok);
+
+	// Set by key, get by id
+	uint16_t val = 0;
+	ALX_TEST_CHECK(AlxParamMgmt_ByKey_SetVal_StrFormat(&lookupMgmt, "key5", "123") == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamMgmt_ById_Get(&lookupMgmt, 100 + (5 * 7) % 20, &val, sizeof(val)) == Alx_Ok);
+	ALX_TEST_CHECK(val == 123);
+	ALX_TEST_CHECK(AlxParamMgmt_ByKey_SetVal_StrFormat(&lookupMgmt, "key99", "123") != Alx_Ok);
+}
+static void AlxTest_ParamMgmt_StoreVal_TwoKvStores(void)
+{
+	// Setup, items of two KV stores alternate, so that pending items of both stores are in each bitmap word
+	static AlxParamKvStore_LogIndexEntry storeLogIndexArr[2][24] = {};
+	static uint8_t storeLogBuffArr[2][256] = {};
+	static AlxParamKvStore storeArr[2] = {};
+	static AlxParamItem storeItemArr[40] = {};
+	static char storeKeyArr[40][8] = {};
+	AlxParamMgmt storeMgmt = {};
+	AlxTest_Fs_Clear();
+	for (uint32_t i = 0; i < ALX_ARR_LEN(storeArr); i++)
+	{
+		AlxParamKvStore_Ctor(&storeArr[i], storeLogIndexArr[i], ALX_ARR_LEN(storeLogIndexArr[i]), storeLogBuffArr[i], sizeof(storeLogBuffArr[i]), &alxFs);
+		ALX_TEST_CHECK(AlxParamKvStore_Init(&storeArr[i]) == Alx_Ok);
+	}
+	for (uint32_t i = 0; i < ALX_ARR_LEN(storeItemArr); i++)
+	{
+		sprintf(storeKeyArr[i], "key%u", (unsigned int)i);
+		AlxParamItem_CtorUint16(&storeItemArr[i], &storeArr[i % 2], AlxParamItem_Param, storeKeyArr[i], i + 1, "group", 1 + i / 20, 0, 0, 1000, AlxParamItem_Ignore, false, NULL, 0, "", false);
+		AlxParamItem_SetValToDef(&storeItemArr[i]);
+		AlxParamItem_SetPendingStore(&storeItemArr[i], false);
+	}
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	AlxParamMgmt_Ctor(&storeMgmt, storeItemArr, idIndex, keyIndex, ALX_ARR_LEN(keyIndex), bitmap, ALX_ARR_LEN(storeItemArr));
+	#else
+	AlxParamMgmt_Ctor(&storeMgmt, storeItemArr, bitmap, ALX_ARR_LEN(storeItemArr));
+	#endif
+
+	// Set items of both stores, also in last bitmap word
+	uint32_t indexArr[] = { 2, 5, 31, 32, 38, 39 };
+	for (uint32_t i = 0; i < ALX_ARR_LEN(indexArr); i++)
+	{
+		ALX_TEST_CHECK(AlxParamItem_SetValUint16(&storeItemArr[indexArr[i]], 100 + indexArr[i]) == Alx_Ok);
+		ALX_TEST_CHECK(storeItemArr[indexArr[i]].pendingStore);
+	}
+
+	// Store group 2, only items of group 2 are stored, items of group 1 stay pending
+	ALX_TEST_CHECK(AlxParamMgmt_StoreVal_Group(&storeMgmt, 2) == Alx_Ok);
+	for (uint32_t i = 0; i < ALX_ARR_LEN(indexArr); i++)
+	{
+		ALX_TEST_CHECK(storeItemArr[indexArr[i]].pendingStore == (indexArr[i] < 20));
+	}
+
+	// Commit fails, pending store of all items in batch is restored
+	ALX_TEST_CHECK(AlxParamItem_SetValUint16(&storeItemArr[4], 104) == Alx_Ok);
+	ALX_TEST_CHECK(AlxParamItem_SetValUint16(&storeItemArr[33], 133) == Alx_Ok);
+	alxTest_fs.errFileSync = Alx_Err;
+	ALX_TEST_CHECK(AlxParamMgmt_StoreVal_All(&storeMgmt) != Alx_Ok);
+	ALX_TEST_CHECK(alxTest_fs.errFileSync == Alx_Ok);
+	ALX_TEST_CHECK(storeItemArr[2].pendingStore && storeItemArr[4].pendingStore && storeItemArr[5].pendingStore && storeItemArr[33].pendingStore);
+
+	// Store all, each store is committed once, items of other store do not cause another pass
+	ALX_TEST_CHECK(AlxParamMgmt_StoreVal_All(&storeMgmt) == Alx_Ok);
+	for (uint32_t i = 0; i < ALX_ARR_LEN(storeItemArr); i++)
+	{
+		ALX_TEST_CHECK(storeItemArr[i].pendingStore == false);
+	}
+
+	// Load, stored values are read back from each store
+	uint16_t val = 0;
+	uint32_t actualValLen = 0;
+	ALX_TEST_CHECK(AlxParamKvStore_Get(&storeArr[1], "key5", &val, sizeof(val), &actualValLen) == Alx_Ok);
+	ALX_TEST_CHECK(val == 105);
+	ALX_TEST_CHECK(AlxParamKvStore_Get(&storeArr[0], "key38", &val, sizeof(val), &actualValLen) == Alx_Ok);
+	ALX_TEST_CHECK(val == 138);
+}
+
+static void AlxTest_ParamMgmt_ValChanged_Sub(void)
+{
+	// Setup, items are in group 1
+	AlxTest_ParamMgmt_Setup();
+	uint32_t numOfCalls_Group1 = 0;
+	uint32_t numOfCalls_Group2 = 0;
+	uint32_t numOfCalls_All = 0;
+	AlxParamMgmt_SetValChangedCallback_Group(&paramMgmt, 1, AlxTest_ParamMgmt_ValChanged_Callback, &numOfCalls_Group1);
+	AlxParamMgmt_SetValChangedCallback_Group(&paramMgmt, 2, AlxTest_ParamMgmt_ValChanged_Callback, &numOfCalls_Group2);
+	AlxParamMgmt_SetValChangedCallback_All(&paramMgmt, AlxTest_ParamMgmt_ValChanged_Callback, &numOfCalls_All);
+
+	// Set, item group & global subscriptions are called, other group not
+	ALX_TEST_CHECK(AlxParamItem_SetValDouble(&paramItemArr[1], 3.0) == Alx_Ok);
+	ALX_TEST_CHECK(numOfCalls_Group1 == 1 && numOfCalls_Group2 == 0 && numOfCalls_All == 1);
+	ALX_TEST_CHECK(valChanged_lastId == 2);
+	ALX_TEST_CHECK(AlxParamItem_IsValChanged(&paramItemArr[1]) == true);
+
+	// Set same, no call
+	ALX_TEST_CHECK(AlxParamItem_SetValDouble(&paramItemArr[1], 3.0) == Alx_Ok);
+	ALX_TEST_CHECK(numOfCalls_Group1 == 1 && numOfCalls_All == 1);
+
+	// Unsubscribe group, its slot is freed & reused
+	AlxParamMgmt_SetValChangedCallback_Group(&paramMgmt, 1, NULL, NULL);
+	for (uint32_t groupId = 10; groupId < 10 + ALX_PARAM_MGMT_VAL_CHANGED_SUB_LEN - 2; groupId++)
+	{
+		AlxParamMgmt_SetValChangedCallback_Group(&paramMgmt, groupId, AlxTest_ParamMgmt_ValChanged_Callback, &numOfCalls_Group2);
+	}
+	ALX_TEST_CHECK(AlxParamItem_SetValUint16(&paramItemArr[0], 20) == Alx_Ok);
+	ALX_TEST_CHECK(numOfCalls_Group1 == 1 && numOfCalls_Group2 == 0 && numOfCalls_All == 2);
+	ALX_TEST_CHECK(valChanged_lastId == 1);
+}
+
+
+//******************************************************************************
+// Main
+//******************************************************************************
+int main(void)
+{
+	ALX_TEST_RUN(AlxTest_ParamMgmt_Snapshot_LittleEndian);
+	ALX_TEST_RUN(AlxTest_ParamMgmt_Snapshot_RoundTrip);
+	ALX_TEST_RUN(AlxTest_ParamMgmt_Snapshot_Atomic);
+	ALX_TEST_RUN(AlxTest_ParamMgmt_Snapshot_RepeatedId);
+	ALX_TEST_RUN(AlxTest_ParamMgmt_Snapshot_Crc);
+	ALX_TEST_RUN(AlxTest_ParamMgmt_Lookup);
+	ALX_TEST_RUN(AlxTest_ParamMgmt_StoreVal_TwoKvStores);
+	ALX_TEST_RUN(AlxTest_ParamMgmt_ValChanged_Sub);
+	return AlxTest_Result();
+}
+
+
+#endif	// #if defined(ALX_C_LIB) && defined(ALX_PC)
@@ -41,6 +41,36 @@
 // Private Functions
 //******************************************************************************
 static void AlxCli_Get(AlxCli* me, bool paramTypeCheck, AlxParamItem_ParamType paramType);
+#if defined(ALX_FS_STATS)
+static void AlxCli_FsStats(AlxCli* me);
+#endif
+static Alx_Status AlxCli_Sub_Start(AlxCli* me, uint32_t period_ms, const uint16_t* indexArr, uint32_t numOfItems);
+static void AlxCli_Sub_Handle(AlxCli* me);
+static Alx_Status AlxCli_Json_Write_Callback(void* ctx, const uint8_t* data, uint32_t len);
+static uint32_t AlxCli_Tokenize(char* line, char** tokenArr, uint32_t tokenArrLen, char sep);
+static const AlxCli_Cmd* AlxCli_FindCmd(AlxCli* me, const char* name);
+static void AlxCli_Cmd_Help(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+static void AlxCli_Cmd_Reset(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+static void AlxCli_Cmd_Id(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+static void AlxCli_Cmd_Get(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+#if defined(ALX_FS_STATS)
+static void AlxCli_Cmd_FsStats(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+static void AlxCli_Cmd_FsStatsReset(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+#endif
+static void AlxCli_Cmd_SetParam(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+static void AlxCli_Cmd_Subscribe(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+static void AlxCli_Cmd_Unsubscribe(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+#if defined(ALX_CLI_BIN)
+static void AlxCli_Cmd_Bin(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);
+static void AlxCli_Bin_Handle(AlxCli* me);
+static void AlxCli_Bin_HandleFrame(AlxCli* me);
+static AlxCli_ResponseType AlxCli_Bin_Describe(AlxCli* me, uint8_t* body, uint32_t bodyLen, uint8_t* respBody, uint32_t* respBodyLen);
+static AlxCli_ResponseType AlxCli_Bin_Get(AlxCli* me, uint8_t* body, uint32_t bodyLen, uint8_t* respBody, uint32_t* respBodyLen);
+static AlxCli_ResponseType AlxCli_Bin_Set(AlxCli* me, uint8_t* body, uint32_t bodyLen, bool apply);
+static AlxCli_ResponseType AlxCli_Bin_Subscribe(AlxCli* me, uint8_t* body, uint32_t bodyLen);
+static void AlxCli_Bin_Sample(AlxCli* me, uint32_t t_ms);
+static void AlxCli_Bin_Send(AlxCli* me, uint8_t msgId, uint8_t seq, AlxCli_ResponseType status, uint32_t respBodyLen);
+#endif
 
 
 //******************************************************************************
@@ -50,6 +80,37 @@ bool AlxCli_Handle_Callback(AlxCli* me);
 bool AlxCli_Help_Callback(AlxCli* me);
 
 
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static AlxParamItem_ParamType alxCli_paramTypeArr[] = { AlxParamItem_Param, AlxParamItem_Var, AlxParamItem_Flag, AlxParamItem_Const, AlxParamItem_Trig };
+static const AlxCli_Cmd alxCli_cmdArr[] =
+{
+	{ .name = "help", .help = "Help Command - Gets CLI help info", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Help, .ctx = NULL },
+	{ .name = "reset", .help = "Reset Command - Triggers device reset", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Reset, .ctx = NULL },
+	{ .name = "id", .help = "ID Command - Gets device ID info", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Id, .ctx = NULL },
+	{ .name = "get", .help = "Get Command - Gets device properties", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Get, .ctx = NULL },
+	{ .name = "get-param", .help = "Get Parameters Command - Gets device parameters", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Get, .ctx = &alxCli_paramTypeArr[0] },
+	{ .name = "get-var", .help = "Get Variables Command - Gets device variables", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Get, .ctx = &alxCli_paramTypeArr[1] },
+	{ .name = "get-flag", .help = "Get Flags Command - Gets device flags", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Get, .ctx = &alxCli_paramTypeArr[2] },
+	{ .name = "get-const", .help = "Get Constants Command - Gets device constants", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Get, .ctx = &alxCli_paramTypeArr[3] },
+	{ .name = "get-trig", .help = "Get Triggers Command - Gets device triggers", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Get, .ctx = &alxCli_paramTypeArr[4] },
+	{ .name = "set-param", .help = "Set Parameter Command - Sets specified device parameter value: set-param --key <param_key> --val <param_val_to_set>", .numOfArgsMin = 4, .numOfArgsMax = 4, .handle = AlxCli_Cmd_SetParam, .ctx = NULL },
+	{ .name = "subscribe", .help = "Subscribe Command - Pushes specified device properties every period, until unsubscribed: subscribe --period <period_ms> --items <key_or_id>[,<key_or_id>...]", .numOfArgsMin = 4, .numOfArgsMax = 4, .handle = AlxCli_Cmd_Subscribe, .ctx = NULL },
+	{ .name = "unsubscribe", .help = "Unsubscribe Command - Stops pushing subscribed device properties", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Unsubscribe, .ctx = NULL },
+	#if defined(ALX_CLI_BIN)
+	{ .name = "bin", .help = "Binary Mode Command - Switches CLI to COBS framed binary protocol, until exit message is received", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_Bin, .ctx = NULL }
+	#endif
+};
+#if defined(ALX_FS_STATS)
+static const AlxCli_Cmd alxCli_cmdFsArr[] =
+{
+	{ .name = "fs-stats", .help = "File System Stats Command - Gets file system I/O counters & latency histograms", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_FsStats, .ctx = NULL },
+	{ .name = "fs-stats-reset", .help = "File System Stats Reset Command - Resets file system I/O counters & latency histograms", .numOfArgsMin = 0, .numOfArgsMax = 0, .handle = AlxCli_Cmd_FsStatsReset, .ctx = NULL }
+};
+#endif
+
+
 //******************************************************************************
 // Constructor
 //******************************************************************************
@@ -74,9 +135,37 @@ void AlxCli_Ctor
 
 	// Variables
 	me->buffLenUsed = 0;
+	me->alxFs = NULL;
+	memset(me->cmdArr, 0, sizeof(me->cmdArr));
+	memset(me->cmdHash, ALX_CLI_CMD_HASH_EMPTY, sizeof(me->cmdHash));
+	me->numOfCmd = 0;
+	AlxJson_Ctor(&me->alxJson, AlxCli_Json_Write_Callback, alxSerialPort, buff, buffLen);	// Shares buff, JSON responses are written directly to serial port in buffLen chunks
+	memset(me->subIndexArr, 0, sizeof(me->subIndexArr));
+	me->subNumOfItems = 0;
+	me->subPeriod_ms = 0;
+	me->subNext_ms = 0;
+	AlxTimSw_Ctor(&me->subTimSw, false);
+	#if defined(ALX_CLI_BIN)
+	ALX_CLI_ASSERT(buffLen > ALX_CLI_BIN_FRAME_LEN);	// Encoded binary response with delimiter is prepared in buff
+	me->isBinMode = false;
+	me->binRxLen = 0;
+	me->binRxIsOverflow = false;
+	AlxCrc_Ctor(&me->binCrc, AlxCrc_Config_Ccitt);
+	me->binSampleSeq = 0;
+	#endif
 
 	// Info
 	me->wasCtorCalled = true;
+
+	// Register built-in commands
+	ALX_CLI_ASSERT(ALX_CLI_CMD_NUM_MAX < ALX_CLI_CMD_HASH_EMPTY);
+	ALX_CLI_ASSERT(ALX_CLI_CMD_HASH_LEN > ALX_CLI_CMD_NUM_MAX);
+	for (uint32_t i = 0; i < ALX_ARR_LEN(alxCli_cmdArr); i++)
+	{
+		Alx_Status status = AlxCli_RegisterCmd(me, &alxCli_cmdArr[i]);
+		ALX_CLI_ASSERT(status == Alx_Ok);
+		(void)status;
+	}
 }
 
 
@@ -103,7 +192,9 @@ void AlxCli_Handle(AlxCli* me)
 	if (me->buffLenUsed > 0)
 	{
 		// Write
-		ALX_CLI_ASSERT(AlxSerialPort_Write(me->alxSerialPort, me->buff, me->buffLenUsed) == Alx_Ok);
+		Alx_Status status = AlxSerialPort_Write(me->alxSerialPort, me->buff, me->buffLenUsed);
+		ALX_CLI_ASSERT(status == Alx_Ok);
+		(void)status;
 
 		// Clear
 		memset(me->buff, 0, me->buffLen);
@@ -115,455 +206,98 @@ void AlxCli_Handle(AlxCli* me)
 
 	//------------------------------------------------------------------------------
 	//------------------------------------------------------------------------------
-	// Handle Read Command
+	// Handle Subscription
 	//------------------------------------------------------------------------------
 	//------------------------------------------------------------------------------
-	uint32_t cmdLen = 0;
-	if (AlxSerialPort_ReadStrUntil(me->alxSerialPort, me->buff, "\r\n", me->buffLen, &cmdLen) == Alx_Ok)
-	{
-		while (1)
-		{
-			//------------------------------------------------------------------------------
-			// Append \r\n
-			//------------------------------------------------------------------------------
-			strcat(me->buff, "\r\n");
-
-
-			//------------------------------------------------------------------------------
-			// Help Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "help\r\n") == 0)
-			{
-				//------------------------------------------------------------------------------
-				// JSON Header
-				//------------------------------------------------------------------------------
-				strcpy
-				(
-					me->buff,
-					"{\r\n"
-					"    \"status\":\"success\",\r\n"
-					"    \"data\":\r\n"
-					"    {\r\n"
-				);
-
-
-				//------------------------------------------------------------------------------
-				// JSON Body
-				//------------------------------------------------------------------------------
-				strcat(me->buff, "        \"help\":\"Help Command - Gets CLI help info\",\r\n");
-				strcat(me->buff, "        \"reset\":\"Reset Command - Triggers device reset\",\r\n");
-				strcat(me->buff, "        \"id\":\"ID Command - Gets device ID info\",\r\n");
-				strcat(me->buff, "        \"get\":\"Get Command - Gets device properties\",\r\n");
-				strcat(me->buff, "        \"get-param\":\"Get Parameters Command - Gets device parameters\",\r\n");
-				strcat(me->buff, "        \"get-var\":\"Get Variables Command - Gets device variables\",\r\n");
-				strcat(me->buff, "        \"get-flag\":\"Get Flags Command - Gets device flags\",\r\n");
-				strcat(me->buff, "        \"get-const\":\"Get Constants Command - Gets device constants\",\r\n");
-				strcat(me->buff, "        \"get-trig\":\"Get Triggers Command - Gets device triggers\",\r\n");
-				strcat(me->buff, "        \"set-param\":\"Set Parameter Command - Sets specified device parameter value: set-param --key <param_key> --val <param_val_to_set>\"");
-				bool isImplemented = AlxCli_Help_Callback(me);
-				if (isImplemented == false)
-				{
-					strcat(me->buff, "\r\n");
-				}
-
-
-				//------------------------------------------------------------------------------
-				// JSON Footer
-				//------------------------------------------------------------------------------
-				strcat
-				(
-					me->buff,
-					"    }\r\n"
-					"}\r\n"
-				);
-
-
-				//------------------------------------------------------------------------------
-				// Send Response
-				//------------------------------------------------------------------------------
-				ALX_CLI_ASSERT(AlxSerialPort_WriteStr(me->alxSerialPort, me->buff) == Alx_Ok);
-
-
-				//------------------------------------------------------------------------------
-				// Break
-				//------------------------------------------------------------------------------
-				break;
-			}
-
-
-			//------------------------------------------------------------------------------
-			// Reset Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "reset\r\n") == 0)
-			{
-				// Prepare response
-				AlxCli_PrepareResponse(me, AlxCli_ResponseType_Success);
-
-				// Send response
-				ALX_CLI_ASSERT(AlxSerialPort_WriteStr(me->alxSerialPort, me->buff) == Alx_Ok);
-
-				// Reset MCU
-				NVIC_SystemReset();
+	AlxCli_Sub_Handle(me);
 
-				// Break
-				break;
-			}
-
-
-			//------------------------------------------------------------------------------
-			// ID Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "id\r\n") == 0)
-			{
-				// Get
-				bool fwIsBootUsed = AlxId_GetFwIsBootUsed(me->alxId);
-
-				const char* fwArtf = AlxId_GetFwArtf(me->alxId);
-				const char* fwName = AlxId_GetFwName(me->alxId);
-				const char* fwVerStr = AlxId_GetFwVerStr(me->alxId);
-				const char* fwBinStr = AlxId_GetFwBinStr(me->alxId);
-
-				const char* fwBootArtf = AlxId_GetFwBootArtf(me->alxId);
-				const char* fwBootName = AlxId_GetFwBootName(me->alxId);
-				const char* fwBootVerStr = AlxId_GetFwBootVerStr(me->alxId);
-				const char* fwBootBinStr = AlxId_GetFwBootBinStr(me->alxId);
-
-				const char* hwPcbArtf = AlxId_GetHwPcbArtf(me->alxId);
-				const char* hwPcbName = AlxId_GetHwPcbName(me->alxId);
-				const char* hwPcbVerStr = AlxId_GetHwPcbVerStr(me->alxId);
-
-				const char* hwBomArtf = AlxId_GetHwBomArtf(me->alxId);
-				const char* hwBomName = AlxId_GetHwBomName(me->alxId);
-				const char* hwBomVerStr = AlxId_GetHwBomVerStr(me->alxId);
-
-				uint8_t hwId = AlxId_GetHwId(me->alxId);
-				const char* hwMcuUniqueIdStr = AlxId_GetHwMcuUniqueIdStr(me->alxId);
-
-				// Prepare response
-				if (AlxParamItem_GetValBool(me->PRETTY_JSON_EN))
-				{
-					if (fwIsBootUsed)
-					{
-						sprintf
-						(
-							me->buff,
-							"{\r\n"
-							"    \"status\":\"success\",\r\n"
-							"    \"data\":\r\n"
-							"    {\r\n"
-							"        \"fwArtf\":\"%s\",\r\n"
-							"        \"fwName\":\"%s\",\r\n"
-							"        \"fwVerStr\":\"%s\",\r\n"
-							"        \"fwBinStr\":\"%s\",\r\n"
-							"        \"fwBootArtf\":\"%s\",\r\n"
-							"        \"fwBootName\":\"%s\",\r\n"
-							"        \"fwBootVerStr\":\"%s\",\r\n"
-							"        \"fwBootBinStr\":\"%s\",\r\n"
-							"        \"hwPcbArtf\":\"%s\",\r\n"
-							"        \"hwPcbName\":\"%s\",\r\n"
-							"        \"hwPcbVerStr\":\"%s\",\r\n"
-							"        \"hwBomArtf\":\"%s\",\r\n"
-							"        \"hwBomName\":\"%s\",\r\n"
-							"        \"hwBomVerStr\":\"%s\",\r\n"
-							"        \"hwId\":%u,\r\n"
-							"        \"hwMcuUniqueIdStr\":\"%s\"\r\n"
-							"    }\r\n"
-							"}\r\n",
-							fwArtf,
-							fwName,
-							fwVerStr,
-							fwBinStr,
-							fwBootArtf,
-							fwBootName,
-							fwBootVerStr,
-							fwBootBinStr,
-							hwPcbArtf,
-							hwPcbName,
-							hwPcbVerStr,
-							hwBomArtf,
-							hwBomName,
-							hwBomVerStr,
-							hwId,
-							hwMcuUniqueIdStr
-						);
-					}
-					else
-					{
-						sprintf
-						(
-							me->buff,
-							"{\r\n"
-							"    \"status\":\"success\",\r\n"
-							"    \"data\":\r\n"
-							"    {\r\n"
-							"        \"fwArtf\":\"%s\",\r\n"
-							"        \"fwName\":\"%s\",\r\n"
-							"        \"fwVerStr\":\"%s\",\r\n"
-							"        \"fwBinStr\":\"%s\",\r\n"
-							"        \"hwPcbArtf\":\"%s\",\r\n"
-							"        \"hwPcbName\":\"%s\",\r\n"
-							"        \"hwPcbVerStr\":\"%s\",\r\n"
-							"        \"hwBomArtf\":\"%s\",\r\n"
-							"        \"hwBomName\":\"%s\",\r\n"
-							"        \"hwBomVerStr\":\"%s\",\r\n"
-							"        \"hwId\":%u,\r\n"
-							"        \"hwMcuUniqueIdStr\":\"%s\"\r\n"
-							"    }\r\n"
-							"}\r\n",
-							fwArtf,
-							fwName,
-							fwVerStr,
-							fwBinStr,
-							hwPcbArtf,
-							hwPcbName,
-							hwPcbVerStr,
-							hwBomArtf,
-							hwBomName,
-							hwBomVerStr,
-							hwId,
-							hwMcuUniqueIdStr
-						);
-					}
-				}
-				else
-				{
-					if (fwIsBootUsed)
-					{
-						sprintf
-						(
-							me->buff,
-							"{"
-								"\"status\":\"success\","
-								"\"data\":"
-								"{"
-									"\"fwArtf\":\"%s\","
-									"\"fwName\":\"%s\","
-									"\"fwVerStr\":\"%s\","
-									"\"fwBinStr\":\"%s\","
-									"\"fwBootArtf\":\"%s\","
-									"\"fwBootName\":\"%s\","
-									"\"fwBootVerStr\":\"%s\","
-									"\"fwBootBinStr\":\"%s\","
-									"\"hwPcbArtf\":\"%s\","
-									"\"hwPcbName\":\"%s\","
-									"\"hwPcbVerStr\":\"%s\","
-									"\"hwBomArtf\":\"%s\","
-									"\"hwBomName\":\"%s\","
-									"\"hwBomVerStr\":\"%s\","
-									"\"hwId\":%u,"
-									"\"hwMcuUniqueIdStr\":\"%s\""
-								"}"
-							"}\r\n",
-							fwArtf,
-							fwName,
-							fwVerStr,
-							fwBinStr,
-							fwBootArtf,
-							fwBootName,
-							fwBootVerStr,
-							fwBootBinStr,
-							hwPcbArtf,
-							hwPcbName,
-							hwPcbVerStr,
-							hwBomArtf,
-							hwBomName,
-							hwBomVerStr,
-							hwId,
-							hwMcuUniqueIdStr
-						);
-					}
-					else
-					{
-						sprintf
-						(
-							me->buff,
-							"{"
-								"\"status\":\"success\","
-								"\"data\":"
-								"{"
-									"\"fwArtf\":\"%s\","
-									"\"fwName\":\"%s\","
-									"\"fwVerStr\":\"%s\","
-									"\"fwBinStr\":\"%s\","
-									"\"hwPcbArtf\":\"%s\","
-									"\"hwPcbName\":\"%s\","
-									"\"hwPcbVerStr\":\"%s\","
-									"\"hwBomArtf\":\"%s\","
-									"\"hwBomName\":\"%s\","
-									"\"hwBomVerStr\":\"%s\","
-									"\"hwId\":%u,"
-									"\"hwMcuUniqueIdStr\":\"%s\""
-								"}"
-							"}\r\n",
-							fwArtf,
-							fwName,
-							fwVerStr,
-							fwBinStr,
-							hwPcbArtf,
-							hwPcbName,
-							hwPcbVerStr,
-							hwBomArtf,
-							hwBomName,
-							hwBomVerStr,
-							hwId,
-							hwMcuUniqueIdStr
-						);
-					}
-				}
-
-				// Send response
-				ALX_CLI_ASSERT(AlxSerialPort_WriteStr(me->alxSerialPort, me->buff) == Alx_Ok);
-
-				// Break
-				break;
-			}
 
 
-			//------------------------------------------------------------------------------
-			// Get Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "get\r\n") == 0)
-			{
-				AlxCli_Get(me, false, ALX_NULL);
-				break;
-			}
 
+	//------------------------------------------------------------------------------
+	//------------------------------------------------------------------------------
+	// Handle Binary Mode
+	//------------------------------------------------------------------------------
+	//------------------------------------------------------------------------------
+	#if defined(ALX_CLI_BIN)
+	if (me->isBinMode)
+	{
+		AlxCli_Bin_Handle(me);
+		return;
+	}
+	#endif
 
-			//------------------------------------------------------------------------------
-			// Get Parameters Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "get-param\r\n") == 0)
-			{
-				AlxCli_Get(me, true, AlxParamItem_Param);
-				break;
-			}
 
 
-			//------------------------------------------------------------------------------
-			// Get Variables Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "get-var\r\n") == 0)
-			{
-				AlxCli_Get(me, true, AlxParamItem_Var);
-				break;
-			}
 
+	//------------------------------------------------------------------------------
+	//------------------------------------------------------------------------------
+	// Handle Read Command
+	//------------------------------------------------------------------------------
+	//------------------------------------------------------------------------------
+	uint32_t cmdLen = 0;
+	uint32_t cmdLenMax = (me->buffLen < sizeof(me->line)) ? me->buffLen : sizeof(me->line);	// Line must fit in me->buff and in its tokenized copy
+	if (AlxSerialPort_ReadStrUntil(me->alxSerialPort, me->buff, "\r\n", cmdLenMax, &cmdLen) == Alx_Ok)
+	{
+		//------------------------------------------------------------------------------
+		// Tokenize
+		//------------------------------------------------------------------------------
 
-			//------------------------------------------------------------------------------
-			// Get Flags Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "get-flag\r\n") == 0)
-			{
-				AlxCli_Get(me, true, AlxParamItem_Flag);
-				break;
-			}
+		// Tokenize copy, so that me->buff can be used for response while args are still used, and stays unchanged for callback
+		char* tokenArr[1 + ALX_CLI_ARG_NUM_MAX] = {};
+		strcpy(me->line, me->buff);
+		uint32_t numOfTokens = AlxCli_Tokenize(me->line, tokenArr, ALX_ARR_LEN(tokenArr), ' ');
 
 
-			//------------------------------------------------------------------------------
-			// Get Constants Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "get-const\r\n") == 0)
+		//------------------------------------------------------------------------------
+		// Registered Command
+		//------------------------------------------------------------------------------
+		const AlxCli_Cmd* cmd = (numOfTokens > 0) ? AlxCli_FindCmd(me, tokenArr[0]) : NULL;
+		if (cmd != NULL)
+		{
+			// If number of args NOT within schema, respond with error, too many tokens are counted but NOT stored, so they also fail here
+			uint32_t numOfArgs = numOfTokens - 1;
+			if ((numOfArgs < cmd->numOfArgsMin) || (numOfArgs > cmd->numOfArgsMax))
 			{
-				AlxCli_Get(me, true, AlxParamItem_Const);
-				break;
+				AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
+				Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+				ALX_CLI_ASSERT(status == Alx_Ok);
+				(void)status;
 			}
-
-
-			//------------------------------------------------------------------------------
-			// Get Triggers Command
-			//------------------------------------------------------------------------------
-			if (strcmp(me->buff, "get-trig\r\n") == 0)
+			else
 			{
-				AlxCli_Get(me, true, AlxParamItem_Trig);
-				break;
+				cmd->handle(me, cmd->ctx, numOfArgs, &tokenArr[1]);
 			}
-
-
+		}
+		else
+		{
 			//------------------------------------------------------------------------------
-			// Set Parameter Command
+			// Callback
 			//------------------------------------------------------------------------------
-			if (strncmp(me->buff, "set-param", strlen("set-param")) == 0)
-			{
-				//------------------------------------------------------------------------------
-				// Handle
-				//------------------------------------------------------------------------------
-				while (1)
-				{
-					//------------------------------------------------------------------------------
-					// Parse
-					//------------------------------------------------------------------------------
-					char key[ALX_CLI_BUFF_LEN] = "";
-					char val[ALX_CLI_BUFF_LEN] = "";
-					int sscanfStatus = sscanf
-					(
-						me->buff,
-						"set-param --key %s --val %s\r\n",
-						key,
-						val);
-					if (sscanfStatus != 2)
-					{
-						AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
-						break;
-					}
-
-
-					//------------------------------------------------------------------------------
-					// Set
-					//------------------------------------------------------------------------------
-					Alx_Status status = AlxParamMgmt_ByKey_SetVal_StrFormat(me->alxParamMgmt, key, val);
-					if (status != Alx_Ok)
-					{
-						AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
-						break;
-					}
-
-
-					//------------------------------------------------------------------------------
-					// Break
-					//------------------------------------------------------------------------------
-					AlxCli_PrepareResponse(me, AlxCli_ResponseType_Success);
-					break;
-				}
-
-
-				//------------------------------------------------------------------------------
-				// Send Response
-				//------------------------------------------------------------------------------
-				ALX_CLI_ASSERT(AlxSerialPort_WriteStr(me->alxSerialPort, me->buff) == Alx_Ok);
-
-
-				//------------------------------------------------------------------------------
-				// Break
-				//------------------------------------------------------------------------------
-				break;
-			}
 
+			// Append \r\n
+			strcat(me->buff, "\r\n");
 
-			//------------------------------------------------------------------------------
-			// Callback
-			//------------------------------------------------------------------------------
+			// Handle
 			bool wasCmdHandled = AlxCli_Handle_Callback(me);
-			if (wasCmdHandled)
-			{
-				break;
-			}
 
 
 			//------------------------------------------------------------------------------
 			// Invalid Command
 			//------------------------------------------------------------------------------
+			if (wasCmdHandled == false)
+			{
+				// Flush serial port RX FIFO
+				AlxSerialPort_FlushRxFifo(me->alxSerialPort);
 
-			// Flush serial port RX FIFO
-			AlxSerialPort_FlushRxFifo(me->alxSerialPort);
-
-			// Prepare response
-			AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrCmd);
-
-			// Send response
-			ALX_CLI_ASSERT(AlxSerialPort_WriteStr(me->alxSerialPort, me->buff) == Alx_Ok);
+				// Prepare response
+				AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrCmd);
 
-			// Break
-			break;
+				// Send response
+				Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+				ALX_CLI_ASSERT(status == Alx_Ok);
+				(void)status;
+			}
 		}
 	}
 
@@ -684,6 +418,56 @@ void AlxCli_PrepareResponse(AlxCli* me, AlxCli_ResponseType responseType)
 		}
 	}
 }
+void AlxCli_SetFs(AlxCli* me, AlxFs* alxFs)
+{
+	// Assert
+	ALX_CLI_ASSERT(me->wasCtorCalled == true);
+
+	// Register file system commands, if first set
+	#if defined(ALX_FS_STATS)
+	if ((me->alxFs == NULL) && (alxFs != NULL) && (AlxCli_FindCmd(me, alxCli_cmdFsArr[0].name) == NULL))
+	{
+		for (uint32_t i = 0; i < ALX_ARR_LEN(alxCli_cmdFsArr); i++)
+		{
+			Alx_Status status = AlxCli_RegisterCmd(me, &alxCli_cmdFsArr[i]);
+			ALX_CLI_ASSERT(status == Alx_Ok);
+			(void)status;
+		}
+	}
+	#endif
+
+	// Set
+	me->alxFs = alxFs;
+}
+Alx_Status AlxCli_RegisterCmd(AlxCli* me, const AlxCli_Cmd* cmd)
+{
+	// Assert
+	ALX_CLI_ASSERT(me->wasCtorCalled == true);
+	ALX_CLI_ASSERT(cmd->name != NULL);
+	ALX_CLI_ASSERT(cmd->help != NULL);
+	ALX_CLI_ASSERT(cmd->numOfArgsMin <= cmd->numOfArgsMax);
+	ALX_CLI_ASSERT(cmd->numOfArgsMax <= ALX_CLI_ARG_NUM_MAX);
+	ALX_CLI_ASSERT(cmd->handle != NULL);
+
+	// Check
+	if (me->numOfCmd >= ALX_CLI_CMD_NUM_MAX) { ALX_CLI_TRACE_WRN("Err: cmdArr full"); return Alx_Err; }
+
+	// Insert into hash, open addressing with linear probing
+	uint32_t j = AlxGlobal_HashFnv1a(cmd->name) % ALX_CLI_CMD_HASH_LEN;
+	while (me->cmdHash[j] != ALX_CLI_CMD_HASH_EMPTY)
+	{
+		if (strcmp(cmd->name, me->cmdArr[me->cmdHash[j]]->name) == 0) { ALX_CLI_TRACE_WRN("Err: %s already registered", cmd->name); return Alx_Err; }
+		j = (j + 1) % ALX_CLI_CMD_HASH_LEN;
+	}
+	me->cmdHash[j] = (uint8_t)me->numOfCmd;
+
+	// Add, registration order is kept for help
+	me->cmdArr[me->numOfCmd] = cmd;
+	me->numOfCmd++;
+
+	// Return
+	return Alx_Ok;
+}
 
 
 //******************************************************************************
@@ -694,33 +478,10 @@ static void AlxCli_Get(AlxCli* me, bool paramTypeCheck, AlxParamItem_ParamType p
 	//------------------------------------------------------------------------------
 	// JSON Header
 	//------------------------------------------------------------------------------
-
-	// Prepare
-	if (AlxParamItem_GetValBool(me->PRETTY_JSON_EN))
-	{
-		strcpy
-		(
-			me->buff,
-			"{\r\n"
-			"    \"status\":\"success\",\r\n"
-			"    \"data\":\r\n"
-			"    {\r\n"
-		);
-	}
-	else
-	{
-		strcpy
-		(
-			me->buff,
-			"{"
-				"\"status\":\"success\","
-				"\"data\":"
-				"{"
-		);
-	}
-
-	// Send
-	ALX_CLI_ASSERT(AlxSerialPort_WriteStr(me->alxSerialPort, me->buff) == Alx_Ok);
+	AlxJson_Begin(&me->alxJson, AlxParamItem_GetValBool(me->PRETTY_JSON_EN));
+	AlxJson_ObjStart(&me->alxJson, NULL);
+	AlxJson_Raw(&me->alxJson, "status", "\"success\"");
+	AlxJson_ObjStart(&me->alxJson, "data");
 
 
 	//------------------------------------------------------------------------------
@@ -729,27 +490,14 @@ static void AlxCli_Get(AlxCli* me, bool paramTypeCheck, AlxParamItem_ParamType p
 
 	// Local variables
 	uint32_t numOfParamItems = AlxParamMgmt_GetNumOfParamItems(me->alxParamMgmt);
-	uint32_t numOfParamTypeItems = AlxParamMgmt_GetNumOfParamTypeItems(me->alxParamMgmt, paramType);
-	uint32_t paramTypeItemsIndex = 0;
 
 	// Loop through all parameters
 	for (uint32_t i = 0; i < numOfParamItems; i++)
 	{
-		// If param type check enabled
-		if (paramTypeCheck)
+		// If param type check enabled and param type NOT selected, continue
+		if (paramTypeCheck && (AlxParamMgmt_ByIndex_GetParamType(me->alxParamMgmt, i) != paramType))
 		{
-			// Get param type
-			AlxParamItem_ParamType _paramType = AlxParamMgmt_ByIndex_GetParamType(me->alxParamMgmt, i);
-
-			// Check param type, if NOT selected, continue, Else increment
-			if (_paramType != paramType)
-			{
-				continue;
-			}
-			else
-			{
-				paramTypeItemsIndex++;
-			}
+			continue;
 		}
 
 		// Get key
@@ -762,91 +510,1072 @@ static void AlxCli_Get(AlxCli* me, bool paramTypeCheck, AlxParamItem_ParamType p
 		char val[ALX_CLI_BUFF_LEN] = "";
 		AlxParamMgmt_ByIndex_GetVal_StrFormat(me->alxParamMgmt, i, val, sizeof(val));
 
-		// If string type add double quote (") around value, Else just use value
+		// If string type add double quote (") around value and escape, Else just use value
 		if (dataType == AlxParamItem_Str)
 		{
-			if (AlxParamItem_GetValBool(me->PRETTY_JSON_EN))
-			{
-				sprintf(me->buff, "        \"%s\":\"%s\"", key, val);
-			}
-			else
-			{
-				sprintf(me->buff, "\"%s\":\"%s\"", key, val);
-			}
+			AlxJson_Str(&me->alxJson, key, val);
 		}
 		else
 		{
-			if (AlxParamItem_GetValBool(me->PRETTY_JSON_EN))
-			{
-				sprintf(me->buff, "        \"%s\":%s", key, val);
-			}
-			else
-			{
-				sprintf(me->buff, "\"%s\":%s", key, val);
-			}
+			AlxJson_Raw(&me->alxJson, key, val);
+		}
+	}
+
+
+	//------------------------------------------------------------------------------
+	// JSON Footer
+	//------------------------------------------------------------------------------
+	AlxJson_ObjEnd(&me->alxJson);
+	AlxJson_ObjEnd(&me->alxJson);
+	Alx_Status status = AlxJson_End(&me->alxJson);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+}
+#if defined(ALX_FS_STATS)
+static void AlxCli_FsStats(AlxCli* me)
+{
+	//------------------------------------------------------------------------------
+	// Get
+	//------------------------------------------------------------------------------
+	AlxFs_Stats stats = {};
+	AlxFs_Stats_Get(me->alxFs, &stats);
+
+
+	//------------------------------------------------------------------------------
+	// JSON Header
+	//------------------------------------------------------------------------------
+	AlxJson_Begin(&me->alxJson, AlxParamItem_GetValBool(me->PRETTY_JSON_EN));
+	AlxJson_ObjStart(&me->alxJson, NULL);
+	AlxJson_Raw(&me->alxJson, "status", "\"success\"");
+	AlxJson_ObjStart(&me->alxJson, "data");
+
+
+	//------------------------------------------------------------------------------
+	// JSON Body
+	//------------------------------------------------------------------------------
+
+	// Loop through all operation types
+	for (uint32_t i = 0; i < AlxFs_Stats_OpType_Num; i++)
+	{
+		// Local variables
+		AlxFs_Stats_Op* op = &stats.op[i];
+
+		// Counters, length in kB & total time in ms, so values fit into 32-bit format
+		AlxJson_ObjStart(&me->alxJson, AlxFs_Stats_GetOpTypeStr((AlxFs_Stats_OpType)i));
+		AlxJson_Uint32(&me->alxJson, "count", op->count);
+		AlxJson_Uint32(&me->alxJson, "len_kB", (uint32_t)(op->len_byte / 1024));
+		AlxJson_Uint32(&me->alxJson, "timeTotal_ms", (uint32_t)(op->timeTotal_us / 1000));
+		AlxJson_Uint32(&me->alxJson, "timeMax_us", op->timeMax_us);
+
+		// Histogram
+		AlxJson_ArrStart(&me->alxJson, "timeHist");
+		for (uint32_t j = 0; j < ALX_FS_STATS_TIME_HIST_BIN_NUM; j++)
+		{
+			AlxJson_Uint32(&me->alxJson, NULL, op->timeHist[j]);
+		}
+		AlxJson_ArrEnd(&me->alxJson);
+		AlxJson_ObjEnd(&me->alxJson);
+	}
+
+
+	//------------------------------------------------------------------------------
+	// JSON Footer
+	//------------------------------------------------------------------------------
+	AlxJson_ObjEnd(&me->alxJson);
+	AlxJson_ObjEnd(&me->alxJson);
+	Alx_Status status = AlxJson_End(&me->alxJson);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+}
+#endif
+static Alx_Status AlxCli_Sub_Start(AlxCli* me, uint32_t period_ms, const uint16_t* indexArr, uint32_t numOfItems)
+{
+	// Check
+	if ((period_ms == 0) || (period_ms > UINT16_MAX) || (numOfItems == 0) || (numOfItems > ALX_CLI_SUB_NUM_MAX)) { ALX_CLI_TRACE_WRN("Err: subscribe"); return Alx_Err; }
+
+	// Check binary sample fits one frame, so that subscription is valid in both modes, Str items are sized by buffLen, because value can grow after subscribe
+	#if defined(ALX_CLI_BIN)
+	uint32_t sampleLen = sizeof(uint32_t);
+	for (uint32_t i = 0; i < numOfItems; i++)
+	{
+		uint32_t valLen = AlxParamMgmt_ByIndex_GetValLenMax(me->alxParamMgmt, indexArr[i]);
+		if (valLen > 0xFF) { ALX_CLI_TRACE_WRN("Err: subscribe valLen"); return Alx_Err; }
+		sampleLen = sampleLen + 1 + valLen;
+	}
+	if (sampleLen > ALX_CLI_BIN_PAYLOAD_LEN_MAX - ALX_CLI_BIN_RESP_HEADER_LEN) { ALX_CLI_TRACE_WRN("Err: subscribe sampleLen"); return Alx_Err; }
+	me->binSampleSeq = 0;
+	#endif
+
+	// Set, first sample is sent on next handle
+	memcpy(me->subIndexArr, indexArr, numOfItems * sizeof(indexArr[0]));
+	me->subNumOfItems = numOfItems;
+	me->subPeriod_ms = period_ms;
+	me->subNext_ms = 0;
+	AlxTimSw_Start(&me->subTimSw);
+
+	// Return
+	return Alx_Ok;
+}
+static void AlxCli_Sub_Handle(AlxCli* me)
+{
+	//------------------------------------------------------------------------------
+	// Check
+	//------------------------------------------------------------------------------
+
+	// If NOT subscribed or NOT time for next sample yet, return
+	if (me->subNumOfItems == 0)
+	{
+		return;
+	}
+	uint64_t t_ms = AlxTimSw_Get_ms(&me->subTimSw);
+	if (t_ms < me->subNext_ms)
+	{
+		return;
+	}
+
+	// Next sample time stays on period grid, so that handle call jitter does NOT accumulate, samples missed due to late handle call are skipped
+	me->subNext_ms = t_ms - ((t_ms - me->subNext_ms) % me->subPeriod_ms) + me->subPeriod_ms;
+
+
+	//------------------------------------------------------------------------------
+	// Binary Sample
+	//------------------------------------------------------------------------------
+	#if defined(ALX_CLI_BIN)
+	if (me->isBinMode)
+	{
+		AlxCli_Bin_Sample(me, (uint32_t)t_ms);
+		return;
+	}
+	#endif
+
+
+	//------------------------------------------------------------------------------
+	// JSON Sample
+	//------------------------------------------------------------------------------
+
+	// Header, always compact, so that each sample is one line
+	AlxJson_Begin(&me->alxJson, false);
+	AlxJson_ObjStart(&me->alxJson, NULL);
+	AlxJson_Raw(&me->alxJson, "event", "\"subscribe\"");
+	AlxJson_Uint32(&me->alxJson, "t_ms", (uint32_t)t_ms);
+	AlxJson_ObjStart(&me->alxJson, "data");
+
+	// Body, subscribed items only, by cached index
+	for (uint32_t i = 0; i < me->subNumOfItems; i++)
+	{
+		uint32_t index = me->subIndexArr[i];
+		const char* key = AlxParamMgmt_ByIndex_GetKey(me->alxParamMgmt, index);
+		char val[ALX_CLI_BUFF_LEN] = "";
+		AlxParamMgmt_ByIndex_GetVal_StrFormat(me->alxParamMgmt, index, val, sizeof(val));
+		if (AlxParamMgmt_ByIndex_GetDataType(me->alxParamMgmt, index) == AlxParamItem_Str)
+		{
+			AlxJson_Str(&me->alxJson, key, val);
+		}
+		else
+		{
+			AlxJson_Raw(&me->alxJson, key, val);
+		}
+	}
+
+	// Footer
+	AlxJson_ObjEnd(&me->alxJson);
+	AlxJson_ObjEnd(&me->alxJson);
+	Alx_Status status = AlxJson_End(&me->alxJson);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+
+	// Clear
+	memset(me->buff, 0, me->buffLen);
+}
+static Alx_Status AlxCli_Json_Write_Callback(void* ctx, const uint8_t* data, uint32_t len)
+{
+	return AlxSerialPort_Write((AlxSerialPort*)ctx, data, len);
+}
+static uint32_t AlxCli_Tokenize(char* line, char** tokenArr, uint32_t tokenArrLen, char sep)
+{
+	// Split in place on sep, tokens above tokenArrLen are counted but NOT stored
+	uint32_t numOfTokens = 0;
+	char* ptr = line;
+	while (true)
+	{
+		// Skip separators
+		while (*ptr == sep)
+		{
+			ptr++;
+		}
+		if (*ptr == '\0')
+		{
+			break;
+		}
+
+		// Store token start
+		if (numOfTokens < tokenArrLen)
+		{
+			tokenArr[numOfTokens] = ptr;
+		}
+		numOfTokens++;
+
+		// Find token end & terminate
+		while ((*ptr != sep) && (*ptr != '\0'))
+		{
+			ptr++;
+		}
+		if (*ptr == sep)
+		{
+			*ptr = '\0';
+			ptr++;
+		}
+	}
+
+	// Return
+	return numOfTokens;
+}
+static const AlxCli_Cmd* AlxCli_FindCmd(AlxCli* me, const char* name)
+{
+	// Linear probing through hash, empty entry ends search
+	uint32_t j = AlxGlobal_HashFnv1a(name) % ALX_CLI_CMD_HASH_LEN;
+	for (uint32_t i = 0; i < ALX_CLI_CMD_HASH_LEN; i++)
+	{
+		if (me->cmdHash[j] == ALX_CLI_CMD_HASH_EMPTY)
+		{
+			break;
+		}
+		const AlxCli_Cmd* cmd = me->cmdArr[me->cmdHash[j]];
+		if (strcmp(name, cmd->name) == 0)
+		{
+			return cmd;
+		}
+		j = (j + 1) % ALX_CLI_CMD_HASH_LEN;
+	}
+
+	// Not found
+	return NULL;
+}
+static void AlxCli_Cmd_Help(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	//------------------------------------------------------------------------------
+	// Unused
+	//------------------------------------------------------------------------------
+	(void)ctx;
+	(void)numOfArgs;
+	(void)argArr;
+
+
+	//------------------------------------------------------------------------------
+	// JSON Header
+	//------------------------------------------------------------------------------
+	strcpy
+	(
+		me->buff,
+		"{\r\n"
+		"    \"status\":\"success\",\r\n"
+		"    \"data\":\r\n"
+		"    {\r\n"
+	);
+	Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+
+
+	//------------------------------------------------------------------------------
+	// JSON Body
+	//------------------------------------------------------------------------------
+
+	// Registered commands in registration order, last one without comma & new line, so that callback can append
+	for (uint32_t i = 0; i < me->numOfCmd; i++)
+	{
+		snprintf(me->buff, me->buffLen, "        \"%s\":\"%s\"%s", me->cmdArr[i]->name, me->cmdArr[i]->help, (i < (me->numOfCmd - 1)) ? ",\r\n" : "");
+		status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+		ALX_CLI_ASSERT(status == Alx_Ok);
+	}
+
+	// Callback
+	strcpy(me->buff, "");
+	bool isImplemented = AlxCli_Help_Callback(me);
+	if (isImplemented == false)
+	{
+		strcat(me->buff, "\r\n");
+	}
+
+
+	//------------------------------------------------------------------------------
+	// JSON Footer
+	//------------------------------------------------------------------------------
+	strcat
+	(
+		me->buff,
+		"    }\r\n"
+		"}\r\n"
+	);
+
+
+	//------------------------------------------------------------------------------
+	// Send Response
+	//------------------------------------------------------------------------------
+	status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+}
+static void AlxCli_Cmd_Reset(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	// Unused
+	(void)ctx;
+	(void)numOfArgs;
+	(void)argArr;
+
+	// Prepare response
+	AlxCli_PrepareResponse(me, AlxCli_ResponseType_Success);
+
+	// Send response
+	Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+
+	// Reset MCU
+	NVIC_SystemReset();
+}
+static void AlxCli_Cmd_Id(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	// Unused
+	(void)ctx;
+	(void)numOfArgs;
+	(void)argArr;
+
+	// Get
+	bool fwIsBootUsed = AlxId_GetFwIsBootUsed(me->alxId);
+
+	const char* fwArtf = AlxId_GetFwArtf(me->alxId);
+	const char* fwName = AlxId_GetFwName(me->alxId);
+	const char* fwVerStr = AlxId_GetFwVerStr(me->alxId);
+	const char* fwBinStr = AlxId_GetFwBinStr(me->alxId);
+
+	const char* fwBootArtf = AlxId_GetFwBootArtf(me->alxId);
+	const char* fwBootName = AlxId_GetFwBootName(me->alxId);
+	const char* fwBootVerStr = AlxId_GetFwBootVerStr(me->alxId);
+	const char* fwBootBinStr = AlxId_GetFwBootBinStr(me->alxId);
+
+	const char* hwPcbArtf = AlxId_GetHwPcbArtf(me->alxId);
+	const char* hwPcbName = AlxId_GetHwPcbName(me->alxId);
+	const char* hwPcbVerStr = AlxId_GetHwPcbVerStr(me->alxId);
+
+	const char* hwBomArtf = AlxId_GetHwBomArtf(me->alxId);
+	const char* hwBomName = AlxId_GetHwBomName(me->alxId);
+	const char* hwBomVerStr = AlxId_GetHwBomVerStr(me->alxId);
+
+	uint8_t hwId = AlxId_GetHwId(me->alxId);
+	const char* hwMcuUniqueIdStr = AlxId_GetHwMcuUniqueIdStr(me->alxId);
+
+	// Prepare response
+	if (AlxParamItem_GetValBool(me->PRETTY_JSON_EN))
+	{
+		if (fwIsBootUsed)
+		{
+			sprintf
+			(
+				me->buff,
+				"{\r\n"
+				"    \"status\":\"success\",\r\n"
+				"    \"data\":\r\n"
+				"    {\r\n"
+				"        \"fwArtf\":\"%s\",\r\n"
+				"        \"fwName\":\"%s\",\r\n"
+				"        \"fwVerStr\":\"%s\",\r\n"
+				"        \"fwBinStr\":\"%s\",\r\n"
+				"        \"fwBootArtf\":\"%s\",\r\n"
+				"        \"fwBootName\":\"%s\",\r\n"
+				"        \"fwBootVerStr\":\"%s\",\r\n"
+				"        \"fwBootBinStr\":\"%s\",\r\n"
+				"        \"hwPcbArtf\":\"%s\",\r\n"
+				"        \"hwPcbName\":\"%s\",\r\n"
+				"        \"hwPcbVerStr\":\"%s\",\r\n"
+				"        \"hwBomArtf\":\"%s\",\r\n"
+				"        \"hwBomName\":\"%s\",\r\n"
+				"        \"hwBomVerStr\":\"%s\",\r\n"
+				"        \"hwId\":%u,\r\n"
+				"        \"hwMcuUniqueIdStr\":\"%s\"\r\n"
+				"    }\r\n"
+				"}\r\n",
+				fwArtf,
+				fwName,
+				fwVerStr,
+				fwBinStr,
+				fwBootArtf,
+				fwBootName,
+				fwBootVerStr,
+				fwBootBinStr,
+				hwPcbArtf,
+				hwPcbName,
+				hwPcbVerStr,
+				hwBomArtf,
+				hwBomName,
+				hwBomVerStr,
+				hwId,
+				hwMcuUniqueIdStr
+			);
+		}
+		else
+		{
+			sprintf
+			(
+				me->buff,
+				"{\r\n"
+				"    \"status\":\"success\",\r\n"
+				"    \"data\":\r\n"
+				"    {\r\n"
+				"        \"fwArtf\":\"%s\",\r\n"
+				"        \"fwName\":\"%s\",\r\n"
+				"        \"fwVerStr\":\"%s\",\r\n"
+				"        \"fwBinStr\":\"%s\",\r\n"
+				"        \"hwPcbArtf\":\"%s\",\r\n"
+				"        \"hwPcbName\":\"%s\",\r\n"
+				"        \"hwPcbVerStr\":\"%s\",\r\n"
+				"        \"hwBomArtf\":\"%s\",\r\n"
+				"        \"hwBomName\":\"%s\",\r\n"
+				"        \"hwBomVerStr\":\"%s\",\r\n"
+				"        \"hwId\":%u,\r\n"
+				"        \"hwMcuUniqueIdStr\":\"%s\"\r\n"
+				"    }\r\n"
+				"}\r\n",
+				fwArtf,
+				fwName,
+				fwVerStr,
+				fwBinStr,
+				hwPcbArtf,
+				hwPcbName,
+				hwPcbVerStr,
+				hwBomArtf,
+				hwBomName,
+				hwBomVerStr,
+				hwId,
+				hwMcuUniqueIdStr
+			);
+		}
+	}
+	else
+	{
+		if (fwIsBootUsed)
+		{
+			sprintf
+			(
+				me->buff,
+				"{"
+					"\"status\":\"success\","
+					"\"data\":"
+					"{"
+						"\"fwArtf\":\"%s\","
+						"\"fwName\":\"%s\","
+						"\"fwVerStr\":\"%s\","
+						"\"fwBinStr\":\"%s\","
+						"\"fwBootArtf\":\"%s\","
+						"\"fwBootName\":\"%s\","
+						"\"fwBootVerStr\":\"%s\","
+						"\"fwBootBinStr\":\"%s\","
+						"\"hwPcbArtf\":\"%s\","
+						"\"hwPcbName\":\"%s\","
+						"\"hwPcbVerStr\":\"%s\","
+						"\"hwBomArtf\":\"%s\","
+						"\"hwBomName\":\"%s\","
+						"\"hwBomVerStr\":\"%s\","
+						"\"hwId\":%u,"
+						"\"hwMcuUniqueIdStr\":\"%s\""
+					"}"
+				"}\r\n",
+				fwArtf,
+				fwName,
+				fwVerStr,
+				fwBinStr,
+				fwBootArtf,
+				fwBootName,
+				fwBootVerStr,
+				fwBootBinStr,
+				hwPcbArtf,
+				hwPcbName,
+				hwPcbVerStr,
+				hwBomArtf,
+				hwBomName,
+				hwBomVerStr,
+				hwId,
+				hwMcuUniqueIdStr
+			);
+		}
+		else
+		{
+			sprintf
+			(
+				me->buff,
+				"{"
+					"\"status\":\"success\","
+					"\"data\":"
+					"{"
+						"\"fwArtf\":\"%s\","
+						"\"fwName\":\"%s\","
+						"\"fwVerStr\":\"%s\","
+						"\"fwBinStr\":\"%s\","
+						"\"hwPcbArtf\":\"%s\","
+						"\"hwPcbName\":\"%s\","
+						"\"hwPcbVerStr\":\"%s\","
+						"\"hwBomArtf\":\"%s\","
+						"\"hwBomName\":\"%s\","
+						"\"hwBomVerStr\":\"%s\","
+						"\"hwId\":%u,"
+						"\"hwMcuUniqueIdStr\":\"%s\""
+					"}"
+				"}\r\n",
+				fwArtf,
+				fwName,
+				fwVerStr,
+				fwBinStr,
+				hwPcbArtf,
+				hwPcbName,
+				hwPcbVerStr,
+				hwBomArtf,
+				hwBomName,
+				hwBomVerStr,
+				hwId,
+				hwMcuUniqueIdStr
+			);
+		}
+	}
+
+	// Send response
+	Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+}
+static void AlxCli_Cmd_Get(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	// Unused
+	(void)numOfArgs;
+	(void)argArr;
+
+	// Get all, if ctx is NULL, Else get only param type pointed to by ctx
+	if (ctx == NULL)
+	{
+		AlxCli_Get(me, false, ALX_NULL);
+	}
+	else
+	{
+		AlxCli_Get(me, true, *(AlxParamItem_ParamType*)ctx);
+	}
+}
+#if defined(ALX_FS_STATS)
+static void AlxCli_Cmd_FsStats(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	// Unused
+	(void)ctx;
+	(void)numOfArgs;
+	(void)argArr;
+
+	// If file system was removed, handle as invalid command
+	if (me->alxFs == NULL)
+	{
+		AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrCmd);
+		Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+		ALX_CLI_ASSERT(status == Alx_Ok);
+		(void)status;
+		return;
+	}
+
+	// Handle
+	AlxCli_FsStats(me);
+}
+static void AlxCli_Cmd_FsStatsReset(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	// Unused
+	(void)ctx;
+	(void)numOfArgs;
+	(void)argArr;
+
+	// Reset, if file system was removed, handle as invalid command
+	if (me->alxFs == NULL)
+	{
+		AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrCmd);
+	}
+	else
+	{
+		AlxFs_Stats_Reset(me->alxFs);
+		AlxCli_PrepareResponse(me, AlxCli_ResponseType_Success);
+	}
+
+	// Send response
+	Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+}
+#endif
+static void AlxCli_Cmd_SetParam(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	//------------------------------------------------------------------------------
+	// Unused
+	//------------------------------------------------------------------------------
+	(void)ctx;
+	(void)numOfArgs;
+
+
+	//------------------------------------------------------------------------------
+	// Handle
+	//------------------------------------------------------------------------------
+	while (1)
+	{
+		//------------------------------------------------------------------------------
+		// Parse
+		//------------------------------------------------------------------------------
+
+		// Schema: --key <param_key> --val <param_val_to_set>
+		if ((strcmp(argArr[0], "--key") != 0) || (strcmp(argArr[2], "--val") != 0))
+		{
+			AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
+			break;
 		}
+		char* key = argArr[1];
+		char* val = argArr[3];
 
-		// If NOT last line in loop, add comma
-		if
-		(
-			((paramTypeCheck == true) && (paramTypeItemsIndex != numOfParamTypeItems)) ||
-			((paramTypeCheck == false) && (i < (numOfParamItems - 1)))
-		)
+
+		//------------------------------------------------------------------------------
+		// Set
+		//------------------------------------------------------------------------------
+		Alx_Status status = AlxParamMgmt_ByKey_SetVal_StrFormat(me->alxParamMgmt, key, val);
+		if (status != Alx_Ok)
 		{
-			if (AlxParamItem_GetValBool(me->PRETTY_JSON_EN))
+			AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
+			break;
+		}
+
+
+		//------------------------------------------------------------------------------
+		// Break
+		//------------------------------------------------------------------------------
+		AlxCli_PrepareResponse(me, AlxCli_ResponseType_Success);
+		break;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Send Response
+	//------------------------------------------------------------------------------
+	Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+}
+static void AlxCli_Cmd_Subscribe(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	//------------------------------------------------------------------------------
+	// Unused
+	//------------------------------------------------------------------------------
+	(void)ctx;
+	(void)numOfArgs;
+
+
+	//------------------------------------------------------------------------------
+	// Handle
+	//------------------------------------------------------------------------------
+	while (1)
+	{
+		//------------------------------------------------------------------------------
+		// Parse
+		//------------------------------------------------------------------------------
+
+		// Schema: --period <period_ms> --items <key_or_id>[,<key_or_id>...]
+		if ((strcmp(argArr[0], "--period") != 0) || (strcmp(argArr[2], "--items") != 0))
+		{
+			AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
+			break;
+		}
+		// Only digits, because strtoul accepts sign & whitespace and wraps "-1" to huge period, max is u16 same as binary subscribe
+		char* end = NULL;
+		unsigned long period_ms = strtoul(argArr[1], &end, 10);
+		if ((isdigit((unsigned char)argArr[1][0]) == 0) || (*end != '\0') || (period_ms > UINT16_MAX))
+		{
+			AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
+			break;
+		}
+		char* itemArr[ALX_CLI_SUB_NUM_MAX] = {};
+		uint32_t numOfItems = AlxCli_Tokenize(argArr[3], itemArr, ALX_ARR_LEN(itemArr), ',');
+		if (numOfItems > ALX_CLI_SUB_NUM_MAX)
+		{
+			AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
+			break;
+		}
+
+
+		//------------------------------------------------------------------------------
+		// Resolve
+		//------------------------------------------------------------------------------
+
+		// Resolve once, so that samples are read by index, numeric item is id, else key
+		uint16_t indexArr[ALX_CLI_SUB_NUM_MAX] = {};
+		Alx_Status status = Alx_Ok;
+		for (uint32_t i = 0; (i < numOfItems) && (status == Alx_Ok); i++)
+		{
+			uint32_t index = 0;
+			unsigned long id = strtoul(itemArr[i], &end, 10);
+			if ((isdigit((unsigned char)itemArr[i][0]) != 0) && (*end == '\0') && (id <= UINT32_MAX))
 			{
-				strcat(me->buff, ",\r\n");
+				status = AlxParamMgmt_ById_GetIndex(me->alxParamMgmt, (uint32_t)id, &index);
 			}
 			else
 			{
-				strcat(me->buff, ",");
+				status = AlxParamMgmt_ByKey_GetIndex(me->alxParamMgmt, itemArr[i], &index);
 			}
+			indexArr[i] = (uint16_t)index;
 		}
-		else
+		if (status != Alx_Ok)
+		{
+			AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
+			break;
+		}
+
+
+		//------------------------------------------------------------------------------
+		// Subscribe
+		//------------------------------------------------------------------------------
+		status = AlxCli_Sub_Start(me, (uint32_t)period_ms, indexArr, numOfItems);
+		if (status != Alx_Ok)
+		{
+			AlxCli_PrepareResponse(me, AlxCli_ResponseType_ErrArg);
+			break;
+		}
+
+
+		//------------------------------------------------------------------------------
+		// Break
+		//------------------------------------------------------------------------------
+		AlxCli_PrepareResponse(me, AlxCli_ResponseType_Success);
+		break;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Send Response
+	//------------------------------------------------------------------------------
+	Alx_Status statusWrite = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(statusWrite == Alx_Ok);
+	(void)statusWrite;
+}
+static void AlxCli_Cmd_Unsubscribe(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	// Unused
+	(void)ctx;
+	(void)numOfArgs;
+	(void)argArr;
+
+	// Stop
+	me->subNumOfItems = 0;
+
+	// Prepare response
+	AlxCli_PrepareResponse(me, AlxCli_ResponseType_Success);
+
+	// Send response
+	Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+}
+
+#if defined(ALX_CLI_BIN)
+static void AlxCli_Cmd_Bin(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr)
+{
+	// Unused
+	(void)ctx;
+	(void)numOfArgs;
+	(void)argArr;
+
+	// Prepare response
+	AlxCli_PrepareResponse(me, AlxCli_ResponseType_Success);
+
+	// Send response, last text response before switch
+	Alx_Status status = AlxSerialPort_WriteStr(me->alxSerialPort, me->buff);
+	ALX_CLI_ASSERT(status == Alx_Ok);
+	(void)status;
+
+	// Switch, following bytes are COBS frames
+	me->binRxLen = 0;
+	me->binRxIsOverflow = false;
+	me->isBinMode = true;
+}
+static void AlxCli_Bin_Handle(AlxCli* me)
+{
+	// Read all received bytes, 0x00 ends frame
+	uint8_t byte = 0;
+	while (AlxSerialPort_Read(me->alxSerialPort, &byte, 1) == Alx_Ok)
+	{
+		// Accumulate
+		if (byte != 0)
 		{
-			if (AlxParamItem_GetValBool(me->PRETTY_JSON_EN))
+			if (me->binRxLen < sizeof(me->binRxBuff))
 			{
-				strcat(me->buff, "\r\n");
+				me->binRxBuff[me->binRxLen] = byte;
+				me->binRxLen++;
 			}
 			else
 			{
-				// Do nothing
+				me->binRxIsOverflow = true;
 			}
+			continue;
+		}
+
+		// Handle frame, empty frames are ignored, so host can send 0x00 to resync
+		if (me->binRxIsOverflow)
+		{
+			AlxCli_Bin_Send(me, AlxCli_BinMsgId_ErrFrame, 0, AlxCli_ResponseType_ErrArg, 0);
+		}
+		else if (me->binRxLen > 0)
+		{
+			AlxCli_Bin_HandleFrame(me);
 		}
+		me->binRxLen = 0;
+		me->binRxIsOverflow = false;
 
-		// Send
-		ALX_CLI_ASSERT(AlxSerialPort_WriteStr(me->alxSerialPort, me->buff) == Alx_Ok);
+		// If exit message was handled, rest is handled as text
+		if (me->isBinMode == false)
+		{
+			break;
+		}
 	}
+}
+static void AlxCli_Bin_HandleFrame(AlxCli* me)
+{
+	//------------------------------------------------------------------------------
+	// Decode
+	//------------------------------------------------------------------------------
+
+	// Decode in place & check CRC, frame: msgId, seq, body, CRC16 CCITT little endian
+	uint32_t len = 0;
+	uint32_t validatedCrc = 0;
+	Alx_Status status = AlxCobs_Decode(me->binRxBuff, me->binRxLen, me->binRxBuff, sizeof(me->binRxBuff), &len);
+	if ((status != Alx_Ok) || (len < 2 + AlxCrc_GetLen(&me->binCrc)) || (AlxCrc_IsOk(&me->binCrc, me->binRxBuff, len, &validatedCrc) == false))
+	{
+		AlxCli_Bin_Send(me, AlxCli_BinMsgId_ErrFrame, 0, AlxCli_ResponseType_ErrCrc, 0);
+		return;
+	}
+	uint8_t msgId = me->binRxBuff[0];
+	uint8_t seq = me->binRxBuff[1];
+	uint8_t* body = &me->binRxBuff[2];
+	uint32_t bodyLen = len - 2 - AlxCrc_GetLen(&me->binCrc);
+	uint8_t* respBody = &me->binTxBuff[ALX_CLI_BIN_RESP_HEADER_LEN];
+	uint32_t respBodyLen = 0;
 
 
 	//------------------------------------------------------------------------------
-	// JSON Footer
+	// Handle
+	//------------------------------------------------------------------------------
+	AlxCli_ResponseType responseType = AlxCli_ResponseType_ErrCmd;
+	if (msgId == AlxCli_BinMsgId_Exit)
+	{
+		responseType = (bodyLen == 0) ? AlxCli_ResponseType_Success : AlxCli_ResponseType_ErrArg;
+	}
+	else if (msgId == AlxCli_BinMsgId_Describe)
+	{
+		responseType = AlxCli_Bin_Describe(me, body, bodyLen, respBody, &respBodyLen);
+	}
+	else if (msgId == AlxCli_BinMsgId_Get)
+	{
+		responseType = AlxCli_Bin_Get(me, body, bodyLen, respBody, &respBodyLen);
+	}
+	else if (msgId == AlxCli_BinMsgId_Set)
+	{
+		// Check all values first, so that either all or none are set
+		responseType = AlxCli_Bin_Set(me, body, bodyLen, false);
+		if (responseType == AlxCli_ResponseType_Success)
+		{
+			responseType = AlxCli_Bin_Set(me, body, bodyLen, true);
+		}
+	}
+	else if (msgId == AlxCli_BinMsgId_Subscribe)
+	{
+		responseType = AlxCli_Bin_Subscribe(me, body, bodyLen);
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Send Response
+	//------------------------------------------------------------------------------
+	if (responseType != AlxCli_ResponseType_Success)
+	{
+		respBodyLen = 0;
+	}
+	AlxCli_Bin_Send(me, msgId, seq, responseType, respBodyLen);
+
+
+	//------------------------------------------------------------------------------
+	// Exit
 	//------------------------------------------------------------------------------
+	if ((msgId == AlxCli_BinMsgId_Exit) && (responseType == AlxCli_ResponseType_Success))
+	{
+		me->isBinMode = false;
+	}
+}
+static AlxCli_ResponseType AlxCli_Bin_Describe(AlxCli* me, uint8_t* body, uint32_t bodyLen, uint8_t* respBody, uint32_t* respBodyLen)
+{
+	// Request: index u16, response: numOfItems u16, id u32, dataType u8, paramType u8, valLen u16, key without null terminator
+	uint16_t index = 0;
+	if (bodyLen != sizeof(index)) { return AlxCli_ResponseType_ErrArg; }
+	memcpy(&index, body, sizeof(index));
+	uint32_t numOfParamItems = AlxParamMgmt_GetNumOfParamItems(me->alxParamMgmt);
+	if (index >= numOfParamItems) { return AlxCli_ResponseType_ErrArg; }
 
 	// Prepare
-	if (AlxParamItem_GetValBool(me->PRETTY_JSON_EN))
+	uint16_t numOfItems = (uint16_t)numOfParamItems;
+	uint32_t id = AlxParamMgmt_ByIndex_GetId(me->alxParamMgmt, index);
+	uint8_t dataType = (uint8_t)AlxParamMgmt_ByIndex_GetDataType(me->alxParamMgmt, index);
+	uint8_t paramType = (uint8_t)AlxParamMgmt_ByIndex_GetParamType(me->alxParamMgmt, index);
+	uint16_t valLen = (uint16_t)AlxParamMgmt_ByIndex_GetValLen(me->alxParamMgmt, index);
+	const char* key = AlxParamMgmt_ByIndex_GetKey(me->alxParamMgmt, index);
+	uint32_t keyLen = strlen(key);
+	if (10 + keyLen > ALX_CLI_BIN_PAYLOAD_LEN_MAX - ALX_CLI_BIN_RESP_HEADER_LEN) { return AlxCli_ResponseType_ErrArg; }
+
+	// Set
+	memcpy(&respBody[0], &numOfItems, sizeof(numOfItems));
+	memcpy(&respBody[2], &id, sizeof(id));
+	memcpy(&respBody[6], &dataType, sizeof(dataType));
+	memcpy(&respBody[7], &paramType, sizeof(paramType));
+	memcpy(&respBody[8], &valLen, sizeof(valLen));
+	memcpy(&respBody[10], key, keyLen);
+	*respBodyLen = 10 + keyLen;
+
+	// Return
+	return AlxCli_ResponseType_Success;
+}
+static AlxCli_ResponseType AlxCli_Bin_Get(AlxCli* me, uint8_t* body, uint32_t bodyLen, uint8_t* respBody, uint32_t* respBodyLen)
+{
+	// Request: id u32 repeated, response: valLen u8 & raw value repeated, in request order
+	if ((bodyLen == 0) || ((bodyLen % sizeof(uint32_t)) != 0)) { return AlxCli_ResponseType_ErrArg; }
+
+	// Loop through all ids
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i < bodyLen; i = i + sizeof(uint32_t))
 	{
-		strcpy
-		(
-			me->buff,
-			"    }\r\n"
-			"}\r\n"
-		);
+		// Get len
+		uint32_t id = 0;
+		uint32_t valLen = 0;
+		memcpy(&id, &body[i], sizeof(id));
+		if (AlxParamMgmt_ById_GetValLen(me->alxParamMgmt, id, &valLen) != Alx_Ok) { return AlxCli_ResponseType_ErrArg; }
+		if ((valLen > 0xFF) || (offset + 1 + valLen > ALX_CLI_BIN_PAYLOAD_LEN_MAX - ALX_CLI_BIN_RESP_HEADER_LEN)) { return AlxCli_ResponseType_ErrArg; }
+
+		// Get value
+		respBody[offset] = (uint8_t)valLen;
+		AlxParamMgmt_ById_Get(me->alxParamMgmt, id, &respBody[offset + 1], valLen);
+		offset = offset + 1 + valLen;
 	}
-	else
+
+	// Return
+	*respBodyLen = offset;
+	return AlxCli_ResponseType_Success;
+}
+static AlxCli_ResponseType AlxCli_Bin_Set(AlxCli* me, uint8_t* body, uint32_t bodyLen, bool apply)
+{
+	// Request: id u32, valLen u8 & raw value repeated, Str value must include null terminator, response: status only
+	if (bodyLen == 0) { return AlxCli_ResponseType_ErrArg; }
+
+	// Loop through all records
+	uint32_t offset = 0;
+	while (offset < bodyLen)
 	{
-		strcpy
-		(
-			me->buff,
-				"}"
-			"}\r\n"
-		);
+		// Read record
+		uint32_t id = 0;
+		if (offset + sizeof(id) + 1 > bodyLen) { return AlxCli_ResponseType_ErrArg; }
+		memcpy(&id, &body[offset], sizeof(id));
+		uint8_t valLen = body[offset + 4];
+		uint8_t* val = &body[offset + 5];
+		offset = offset + sizeof(id) + 1 + valLen;
+		if (offset > bodyLen) { return AlxCli_ResponseType_ErrArg; }
+
+		// Check or set
+		Alx_Status status = apply ? AlxParamMgmt_ById_SetVal(me->alxParamMgmt, id, val, valLen) : AlxParamMgmt_ById_CheckVal(me->alxParamMgmt, id, val, valLen);
+		if (status != Alx_Ok) { return AlxCli_ResponseType_ErrArg; }
 	}
 
-	// Send
-	ALX_CLI_ASSERT(AlxSerialPort_WriteStr(me->alxSerialPort, me->buff) == Alx_Ok);
+	// Return
+	return AlxCli_ResponseType_Success;
 }
+static AlxCli_ResponseType AlxCli_Bin_Subscribe(AlxCli* me, uint8_t* body, uint32_t bodyLen)
+{
+	// Request: period_ms u16 & id u32 repeated, period 0 without ids unsubscribes, response: status only, samples follow as sample messages
+	uint16_t period_ms = 0;
+	if ((bodyLen < sizeof(period_ms)) || (((bodyLen - sizeof(period_ms)) % sizeof(uint32_t)) != 0)) { return AlxCli_ResponseType_ErrArg; }
+	memcpy(&period_ms, body, sizeof(period_ms));
+	uint32_t numOfItems = (bodyLen - sizeof(period_ms)) / sizeof(uint32_t);
+
+	// Unsubscribe
+	if ((period_ms == 0) && (numOfItems == 0))
+	{
+		me->subNumOfItems = 0;
+		return AlxCli_ResponseType_Success;
+	}
+
+	// Resolve once, so that samples are read by index
+	if (numOfItems > ALX_CLI_SUB_NUM_MAX) { return AlxCli_ResponseType_ErrArg; }
+	uint16_t indexArr[ALX_CLI_SUB_NUM_MAX] = {};
+	for (uint32_t i = 0; i < numOfItems; i++)
+	{
+		uint32_t id = 0;
+		uint32_t index = 0;
+		memcpy(&id, &body[sizeof(period_ms) + (i * sizeof(id))], sizeof(id));
+		if (AlxParamMgmt_ById_GetIndex(me->alxParamMgmt, id, &index) != Alx_Ok) { return AlxCli_ResponseType_ErrArg; }
+		indexArr[i] = (uint16_t)index;
+	}
+
+	// Subscribe
+	if (AlxCli_Sub_Start(me, period_ms, indexArr, numOfItems) != Alx_Ok) { return AlxCli_ResponseType_ErrArg; }
 
+	// Return
+	return AlxCli_ResponseType_Success;
+}
+static void AlxCli_Bin_Sample(AlxCli* me, uint32_t t_ms)
+{
+	// Body: t_ms u32, then valLen u8 & raw value per item, same as get response, fits frame as checked by AlxCli_Sub_Start
+	uint8_t* body = &me->binTxBuff[ALX_CLI_BIN_RESP_HEADER_LEN];
+	memcpy(&body[0], &t_ms, sizeof(t_ms));
+	uint32_t offset = sizeof(t_ms);
+	for (uint32_t i = 0; i < me->subNumOfItems; i++)
+	{
+		// If value does NOT fit, send it empty, so that following items are still parsed at right position
+		uint32_t index = me->subIndexArr[i];
+		uint32_t valLen = AlxParamMgmt_ByIndex_GetValLen(me->alxParamMgmt, index);
+		if (offset + 1 + valLen > ALX_CLI_BIN_PAYLOAD_LEN_MAX - ALX_CLI_BIN_RESP_HEADER_LEN)
+		{
+			ALX_CLI_ASSERT(false);	// We should never get here, sample len was checked by AlxCli_Sub_Start
+			valLen = 0;
+		}
+		if (offset + 1 > ALX_CLI_BIN_PAYLOAD_LEN_MAX - ALX_CLI_BIN_RESP_HEADER_LEN)
+		{
+			break;
+		}
+		body[offset] = (uint8_t)valLen;
+		memcpy(&body[offset + 1], AlxParamMgmt_ByIndex_GetValPtr(me->alxParamMgmt, index), valLen);
+		offset = offset + 1 + valLen;
+	}
+
+	// Send, seq counts samples, so that host can detect lost samples
+	AlxCli_Bin_Send(me, AlxCli_BinMsgId_Sample, me->binSampleSeq, AlxCli_ResponseType_Success, offset);
+	me->binSampleSeq++;
+}
+static void AlxCli_Bin_Send(AlxCli* me, uint8_t msgId, uint8_t seq, AlxCli_ResponseType status, uint32_t respBodyLen)
+{
+	// Header, response msgId has MSB set
+	me->binTxBuff[0] = msgId | 0x80;
+	me->binTxBuff[1] = seq;
+	me->binTxBuff[2] = (uint8_t)status;
+	uint32_t len = ALX_CLI_BIN_RESP_HEADER_LEN + respBodyLen;
+
+	// CRC
+	uint16_t crc = (uint16_t)AlxCrc_Calc(&me->binCrc, me->binTxBuff, len);
+	memcpy(&me->binTxBuff[len], &crc, sizeof(crc));
+	len = len + sizeof(crc);
+
+	// Encode into buff & add delimiter
+	uint32_t lenEnc = 0;
+	uint8_t* buff = (uint8_t*)me->buff;
+	Alx_Status statusCobs = AlxCobs_Encode(me->binTxBuff, len, buff, me->buffLen - 1, &lenEnc);
+	ALX_CLI_ASSERT(statusCobs == Alx_Ok);
+	(void)statusCobs;
+	buff[lenEnc] = 0;
+
+	// Send
+	Alx_Status statusWrite = AlxSerialPort_Write(me->alxSerialPort, buff, lenEnc + 1);
+	ALX_CLI_ASSERT(statusWrite == Alx_Ok);
+	(void)statusWrite;
+}
+#endif
 
 //******************************************************************************
 // Weak Functions
@@ -45,6 +45,11 @@ extern "C" {
 #include "alxSerialPort.h"
 #include "alxId.h"
 #include "alxParamMgmt.h"
+#include "alxFs.h"
+#include "alxJson.h"
+#include "alxCobs.h"
+#include "alxCrc.h"
+#include "alxTimSw.h"
 
 
 //******************************************************************************
@@ -76,6 +81,26 @@ extern "C" {
 	#define ALX_CLI_TRACE_WRN(...) do{} while (false)
 #endif
 
+// Defines
+#ifndef ALX_CLI_CMD_NUM_MAX
+	#define ALX_CLI_CMD_NUM_MAX 32	// Max number of built-in and registered commands, must be less than 255
+#endif
+#ifndef ALX_CLI_CMD_HASH_LEN
+	#define ALX_CLI_CMD_HASH_LEN 64	// Command hash len, must be greater than ALX_CLI_CMD_NUM_MAX, 2x ALX_CLI_CMD_NUM_MAX is recommended
+#endif
+#ifndef ALX_CLI_ARG_NUM_MAX
+	#define ALX_CLI_ARG_NUM_MAX 8	// Max number of args after command name
+#endif
+#ifndef ALX_CLI_LINE_LEN_MAX
+	#define ALX_CLI_LINE_LEN_MAX (ALX_PARAM_ITEM_BUFF_LEN + 64)	// Max command line len with null terminator, so that set-param with longest Str value fits, longer lines are NOT read
+#endif
+#ifndef ALX_CLI_SUB_NUM_MAX
+	#define ALX_CLI_SUB_NUM_MAX 8	// Max number of subscribed items
+#endif
+#ifndef ALX_CLI_BIN_FRAME_LEN
+	#define ALX_CLI_BIN_FRAME_LEN 256	// Max COBS encoded binary frame len without 0x00 delimiter, in both directions, buffLen must be greater
+#endif
+
 
 //******************************************************************************
 // Types
@@ -89,10 +114,36 @@ typedef enum
 	AlxCli_ResponseType_ErrTimeout
 } AlxCli_ResponseType;
 
+typedef enum
+{
+	AlxCli_BinMsgId_Exit = 0x01,
+	AlxCli_BinMsgId_Describe = 0x02,
+	AlxCli_BinMsgId_Get = 0x03,
+	AlxCli_BinMsgId_Set = 0x04,
+	AlxCli_BinMsgId_Subscribe = 0x05,
+	AlxCli_BinMsgId_Sample = 0x06,	// Device to host only, pushed every subscription period
+	AlxCli_BinMsgId_ErrFrame = 0x7F
+} AlxCli_BinMsgId;
+
+typedef struct AlxCli AlxCli;
+
 typedef struct
+{
+	const char* name;		// First token of command line, must be unique
+	const char* help;		// Description shown by help command
+	uint32_t numOfArgsMin;	// Number of space separated args after name, else ErrArg response is sent
+	uint32_t numOfArgsMax;	// Must NOT be greater than ALX_CLI_ARG_NUM_MAX
+	void (*handle)(AlxCli* me, void* ctx, uint32_t numOfArgs, char** argArr);	// Must prepare and send response, args point to copy of command line, so me->buff can be used for response
+	void* ctx;
+} AlxCli_Cmd;
+
+typedef struct AlxCli
 {
 	// Defines
 	#define ALX_CLI_BUFF_LEN 128
+	#define ALX_CLI_CMD_HASH_EMPTY 0xFF
+	#define ALX_CLI_BIN_PAYLOAD_LEN_MAX (ALX_CLI_BIN_FRAME_LEN - (ALX_CLI_BIN_FRAME_LEN / 254) - 1 - 2)	// Without CRC, so that encoded frame fits ALX_CLI_BIN_FRAME_LEN
+	#define ALX_CLI_BIN_RESP_HEADER_LEN 3	// msgId, seq, status
 
 	// Parameters
 	AlxSerialPort* alxSerialPort;
@@ -104,6 +155,26 @@ typedef struct
 
 	// Variables
 	uint32_t buffLenUsed;
+	AlxFs* alxFs;
+	const AlxCli_Cmd* cmdArr[ALX_CLI_CMD_NUM_MAX];	// Commands in registration order
+	uint8_t cmdHash[ALX_CLI_CMD_HASH_LEN];			// cmdArr indexes hashed by name
+	uint32_t numOfCmd;
+	char line[ALX_CLI_LINE_LEN_MAX];				// Tokenized copy of command line, args point into it
+	AlxJson alxJson;
+	uint16_t subIndexArr[ALX_CLI_SUB_NUM_MAX];	// Subscribed param item indexes, resolved once when subscribed
+	uint32_t subNumOfItems;						// 0 if NOT subscribed
+	uint32_t subPeriod_ms;
+	uint64_t subNext_ms;						// Next sample time since subscribed
+	AlxTimSw subTimSw;
+	#if defined(ALX_CLI_BIN)
+	bool isBinMode;
+	uint8_t binRxBuff[ALX_CLI_BIN_FRAME_LEN];
+	uint32_t binRxLen;
+	bool binRxIsOverflow;
+	uint8_t binTxBuff[ALX_CLI_BIN_PAYLOAD_LEN_MAX + 2];
+	AlxCrc binCrc;
+	uint8_t binSampleSeq;
+	#endif
 
 	// Info
 	bool wasCtorCalled;
@@ -131,6 +202,8 @@ void AlxCli_Ctor
 void AlxCli_Handle(AlxCli* me);
 void AlxCli_PrepareEvent(AlxCli* me, const uint8_t* data, uint32_t len);
 void AlxCli_PrepareResponse(AlxCli* me, AlxCli_ResponseType responseType);
+void AlxCli_SetFs(AlxCli* me, AlxFs* alxFs);
+Alx_Status AlxCli_RegisterCmd(AlxCli* me, const AlxCli_Cmd* cmd);
 
 
 #endif	// #if defined(ALX_C_LIB)
@@ -0,0 +1,349 @@
+#*******************************************************************************
+# @file			alxCliBin.py
+# @brief		Auralix C Library - ALX CLI Binary Mode Client Module
+# @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+#
+# @section License
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+# This file is part of Auralix C Library.
+#
+# Auralix C Library is free software: you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation, either version 3
+# of the License, or (at your option) any later version.
+#
+# Auralix C Library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+#*****************************************************************************
+
+
+#*******************************************************************************
+# Imports
+#*******************************************************************************
+import binascii
+import collections
+import struct
+import sys
+import time
+import serial
+
+
+#*******************************************************************************
+# Constants
+#*******************************************************************************
+
+# Message IDs, same as AlxCli_BinMsgId, response has MSB set
+MSG_ID_EXIT = 0x01
+MSG_ID_DESCRIBE = 0x02
+MSG_ID_GET = 0x03
+MSG_ID_SET = 0x04
+MSG_ID_SUBSCRIBE = 0x05
+MSG_ID_SAMPLE = 0x06
+MSG_ID_ERR_FRAME = 0x7F
+
+# Status, same as AlxCli_ResponseType
+STATUS_STR = ["success", "Command invalid", "Arguments invalid", "CRC mismatch", "Command timeout"]
+
+# Data types, same order as AlxParamItem_DataType, values are little endian
+DATA_TYPE_FORMAT = ["<B", "<H", "<I", "<Q", "<b", "<h", "<i", "<q", "<f", "<d", "<?", None, None]
+DATA_TYPE_ARR = 11
+DATA_TYPE_STR = 12
+
+# Param types, same order as AlxParamItem_ParamType
+PARAM_TYPE_STR = ["param", "var", "flag", "const", "trig"]
+
+# Limits, same as device defaults ALX_CLI_SUB_NUM_MAX, ALX_CLI_BIN_PAYLOAD_LEN_MAX & ALX_PARAM_ITEM_BUFF_LEN
+SUB_NUM_MAX = 8
+REQ_BODY_LEN_MAX = 252 - 2		# Without msgId & seq
+RESP_BODY_LEN_MAX = 252 - 3		# Without msgId, seq & status
+SAMPLE_BODY_LEN_MAX = RESP_BODY_LEN_MAX - 4		# Without t_ms
+VAL_LEN_STR_MAX = 128
+
+
+#*******************************************************************************
+# Functions - COBS & CRC
+#*******************************************************************************
+def CobsEncode(data):
+	# Same as AlxCobs_Encode, code byte holds distance to next zero, which is then dropped
+	out = bytearray([0])
+	codeIndex = 0
+	code = 1
+	for i, byte in enumerate(data):
+		if byte != 0:
+			out.append(byte)
+			code = code + 1
+		if byte == 0 or code == 0xFF:
+			out[codeIndex] = code
+			code = 1
+			codeIndex = len(out)
+			if byte == 0 or i < len(data) - 1:
+				out.append(0)
+	if codeIndex < len(out):
+		out[codeIndex] = code
+	return bytes(out)
+
+def CobsDecode(dataEnc):
+	out = bytearray()
+	i = 0
+	while i < len(dataEnc):
+		code = dataEnc[i]
+		if code == 0 or i + code > len(dataEnc):
+			raise ValueError("COBS invalid")
+		out += dataEnc[i + 1:i + code]
+		i = i + code
+		if code != 255 and i < len(dataEnc):
+			out.append(0)
+	return bytes(out)
+
+def Crc(data):
+	# CRC16 CCITT, init 0xFFFF, same as AlxCrc_Config_Ccitt
+	return binascii.crc_hqx(data, 0xFFFF)
+
+
+#*******************************************************************************
+# Class - CliBin
+#*******************************************************************************
+class CliBin:
+	#-------------------------------------------------------------------------------
+	# Ctor
+	#-------------------------------------------------------------------------------
+	def __init__(self, serialPort):
+		# Parameters
+		self.__serialPort = serialPort
+
+		# Variables
+		self.__seq = 0
+		self.__itemById = {}
+		self.__sampleQueue = collections.deque()
+		self.__sampleIds = []
+
+
+	#-------------------------------------------------------------------------------
+	# Public Functions
+	#-------------------------------------------------------------------------------
+	def Enter(self):
+		# Text command, device responds with last text response and switches
+		self.__serialPort.write(b"bin\r\n")
+		line = self.__serialPort.read_until(b"\r\n")
+		if b"success" not in line:
+			raise RuntimeError(f"FAIL: bin command response {line}")
+
+	def Exit(self):
+		self.__Transfer(MSG_ID_EXIT, b"")
+
+	def Describe(self, index):
+		body = self.__Transfer(MSG_ID_DESCRIBE, struct.pack("<H", index))
+		numOfItems, id, dataType, paramType, valLen = struct.unpack_from("<HIBBH", body)
+		item = {
+			"index": index,
+			"numOfItems": numOfItems,
+			"id": id,
+			"dataType": dataType,
+			"paramType": PARAM_TYPE_STR[paramType],
+			"valLen": valLen,
+			"key": body[10:].decode()
+		}
+		self.__itemById[id] = item
+		return item
+
+	def DescribeAll(self):
+		items = [self.Describe(0)]
+		for index in range(1, items[0]["numOfItems"]):
+			items.append(self.Describe(index))
+		return items
+
+	def GetRaw(self, ids):
+		# Ids are split into requests, so that each request & response fits one frame, items must be described first
+		vals = []
+		for batch in self.__Batch(ids, REQ_BODY_LEN_MAX, RESP_BODY_LEN_MAX):
+			body = self.__Transfer(MSG_ID_GET, b"".join(struct.pack("<I", id) for id in batch))
+			offset = 0
+			for id in batch:
+				valLen = body[offset]
+				vals.append(body[offset + 1:offset + 1 + valLen])
+				offset = offset + 1 + valLen
+		return vals
+
+	def Get(self, ids):
+		# Items must be described first, so that data type is known
+		return [self.__Unpack(self.__itemById[id]["dataType"], val) for id, val in zip(ids, self.GetRaw(ids))]
+
+	def Set(self, valById):
+		# All values are checked by device first, so either all or none are set
+		body = b""
+		for id, val in valById.items():
+			raw = self.__Pack(self.__itemById[id]["dataType"], val)
+			body += struct.pack("<IB", id, len(raw)) + raw
+		self.__Transfer(MSG_ID_SET, body)
+
+	def CanSubscribe(self, ids):
+		# Device accepts max SUB_NUM_MAX items, whose sample fits one frame
+		return len(self.__Batch(ids, SUB_NUM_MAX * 4, SAMPLE_BODY_LEN_MAX)) == 1
+
+	def Subscribe(self, ids, periodMs):
+		# Device pushes sample every period, until unsubscribed, read with ReadSample, samples queued before response are from previous subscription
+		self.__Transfer(MSG_ID_SUBSCRIBE, struct.pack("<H", periodMs) + b"".join(struct.pack("<I", id) for id in ids))
+		self.__sampleQueue.clear()
+		self.__sampleIds = list(ids)
+
+	def Unsubscribe(self):
+		self.__Transfer(MSG_ID_SUBSCRIBE, struct.pack("<H", 0))
+		self.__sampleQueue.clear()
+		self.__sampleIds = []
+
+	def ReadSample(self):
+		# Returns device time in ms, sample counter & values in subscribe order
+		if self.__sampleQueue:
+			resp = self.__sampleQueue.popleft()
+		else:
+			resp = self.__Receive()
+			if resp[0] != (MSG_ID_SAMPLE | 0x80):
+				raise RuntimeError(f"FAIL: sample msgId 0x{resp[0]:02X}")
+		body = resp[3:-2]
+		tMs = struct.unpack_from("<I", body)[0]
+		vals = []
+		offset = 4
+		for id in self.__sampleIds:
+			valLen = body[offset]
+			vals.append(self.__Unpack(self.__itemById[id]["dataType"], body[offset + 1:offset + 1 + valLen]))
+			offset = offset + 1 + valLen
+		return tMs, resp[1], vals
+
+
+	#-------------------------------------------------------------------------------
+	# Private Functions
+	#-------------------------------------------------------------------------------
+	def __Transfer(self, msgId, body):
+		# Send
+		self.__seq = (self.__seq + 1) & 0xFF
+		payload = bytes([msgId, self.__seq]) + body
+		payload += struct.pack("<H", Crc(payload))
+		self.__serialPort.write(CobsEncode(payload) + b"\x00")
+
+		# Receive, samples pushed before response are queued
+		resp = self.__Receive()
+		while resp[0] == (MSG_ID_SAMPLE | 0x80):
+			self.__sampleQueue.append(resp)
+			resp = self.__Receive()
+		if resp[0] == (MSG_ID_ERR_FRAME | 0x80):
+			raise RuntimeError(f"FAIL: frame error, {STATUS_STR[resp[2]]}")
+		if resp[0] != (msgId | 0x80) or resp[1] != self.__seq:
+			raise RuntimeError(f"FAIL: response msgId 0x{resp[0]:02X} seq {resp[1]}")
+		if resp[2] != 0:
+			raise RuntimeError(f"FAIL: {STATUS_STR[resp[2]]}")
+		return resp[3:-2]
+
+	def __Receive(self):
+		frame = self.__serialPort.read_until(b"\x00")
+		if not frame.endswith(b"\x00"):
+			raise TimeoutError("FAIL: response timeout")
+		resp = CobsDecode(frame[:-1])
+		if len(resp) < 5 or Crc(resp[:-2]) != struct.unpack("<H", resp[-2:])[0]:
+			raise RuntimeError("FAIL: response CRC")
+		return resp
+
+	def __Batch(self, ids, reqLenMax, respLenMax):
+		# Split ids, so that request of 4 bytes per id & response of valLen u8 & value per id are within limits
+		batches = [[]]
+		reqLen = 0
+		respLen = 0
+		for id in ids:
+			item = self.__itemById[id]
+			valLen = max(item["valLen"], VAL_LEN_STR_MAX) if item["dataType"] == DATA_TYPE_STR else item["valLen"]
+			if batches[-1] and (reqLen + 4 > reqLenMax or respLen + 1 + valLen > respLenMax):
+				batches.append([])
+				reqLen = 0
+				respLen = 0
+			batches[-1].append(id)
+			reqLen = reqLen + 4
+			respLen = respLen + 1 + valLen
+		return batches
+
+	def __Unpack(self, dataType, raw):
+		if dataType == DATA_TYPE_STR:
+			return raw.split(b"\x00")[0].decode()
+		if dataType == DATA_TYPE_ARR:
+			return raw
+		return struct.unpack(DATA_TYPE_FORMAT[dataType], raw)[0]
+
+	def __Pack(self, dataType, val):
+		if dataType == DATA_TYPE_STR:
+			return val.encode() + b"\x00"
+		if dataType == DATA_TYPE_ARR:
+			return bytes(val)
+		return struct.pack(DATA_TYPE_FORMAT[dataType], val)
+
+
+#*******************************************************************************
+# Script
+#*******************************************************************************
+def Script(port, baudRate, periodSec):
+	serialPort = None
+	cliBin = None
+	try:
+		#-------------------------------------------------------------------------------
+		# Init
+		#-------------------------------------------------------------------------------
+		serialPort = serial.Serial(port=port, baudrate=baudRate, timeout=1)
+		cliBin = CliBin(serialPort)
+		cliBin.Enter()
+
+
+		#-------------------------------------------------------------------------------
+		# Describe
+		#-------------------------------------------------------------------------------
+		items = [item for item in cliBin.DescribeAll() if item["paramType"] == "var"]
+		ids = [item["id"] for item in items]
+		print(",".join(["time"] + [item["key"] for item in items]))
+
+
+		#-------------------------------------------------------------------------------
+		# Loop - Device pushes all variables every period, if they fit one subscription, else they are polled in batches
+		#-------------------------------------------------------------------------------
+		if cliBin.CanSubscribe(ids):
+			cliBin.Subscribe(ids, int(periodSec * 1000))
+			while True:
+				tMs, seq, vals = cliBin.ReadSample()
+				print(",".join([f"{tMs / 1000:.3f}"] + [str(val) for val in vals]))
+		else:
+			tStart = time.monotonic()
+			tNext = tStart
+			while True:
+				t = time.monotonic()
+				vals = cliBin.Get(ids)
+				print(",".join([f"{t - tStart:.3f}"] + [str(val) for val in vals]))
+				tNext = tNext + periodSec
+				time.sleep(max(0, tNext - time.monotonic()))
+
+	except KeyboardInterrupt:
+		pass
+
+	finally:
+		#-------------------------------------------------------------------------------
+		# Exit
+		#-------------------------------------------------------------------------------
+		if cliBin:
+			cliBin.Unsubscribe()
+			cliBin.Exit()
+		if serialPort and serialPort.is_open:
+			serialPort.close()
+
+
+#*******************************************************************************
+# Run Guard
+#*******************************************************************************
+if __name__ == "__main__":
+	# Prepare
+	port = sys.argv[1]
+	baudRate = sys.argv[2]
+	periodSec = float(sys.argv[3]) if len(sys.argv) > 3 else 0.1
+
+	# Script
+	Script(port, baudRate, periodSec)
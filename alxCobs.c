@@ -0,0 +1,155 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxCobs.c
+  * @brief		Auralix C Library - ALX COBS Module
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxCobs.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB)
+
+
+//******************************************************************************
+// Functions
+//******************************************************************************
+
+/**
+  * @brief			Worst case encoded length, without 0x00 frame delimiter
+  * @param[in]		len
+  * @return
+  */
+uint32_t AlxCobs_GetEncLenMax(uint32_t len)
+{
+	// One code byte per started block of 254 non-zero bytes
+	return len + (len / 254) + 1;
+}
+
+/**
+  * @brief			Consistent Overhead Byte Stuffing, encoded data contains no 0x00, so 0x00 can be used as frame delimiter, delimiter is NOT added
+  * @param[in]		data
+  * @param[in]		len
+  * @param[out]		dataEnc			Must NOT overlap data
+  * @param[in]		dataEncLenMax
+  * @param[out]		dataEncLen
+  * @retval			Alx_Ok
+  * @retval			Alx_Err			dataEnc too short
+  */
+Alx_Status AlxCobs_Encode(const uint8_t* data, uint32_t len, uint8_t* dataEnc, uint32_t dataEncLenMax, uint32_t* dataEncLen)
+{
+	// Local variables
+	uint32_t codeIndex = 0;
+	uint32_t outIndex = 1;
+	uint8_t code = 1;
+
+	// Check
+	if (dataEncLenMax < AlxCobs_GetEncLenMax(len)) { ALX_COBS_TRACE("Err: dataEncLenMax"); return Alx_Err; }
+
+	// Encode, code byte holds distance to next zero, which is then dropped
+	for (uint32_t i = 0; i < len; i++)
+	{
+		if (data[i] != 0)
+		{
+			dataEnc[outIndex] = data[i];
+			outIndex++;
+			code++;
+		}
+		if ((data[i] == 0) || (code == 0xFF))
+		{
+			dataEnc[codeIndex] = code;
+			codeIndex = outIndex;
+			outIndex++;
+			code = 1;
+
+			// Block of 254 non-zero bytes at the end needs no extra code byte
+			if ((data[i] != 0) && (i == len - 1))
+			{
+				outIndex--;
+				*dataEncLen = outIndex;
+				return Alx_Ok;
+			}
+		}
+	}
+	dataEnc[codeIndex] = code;
+
+	// Return
+	*dataEncLen = outIndex;
+	return Alx_Ok;
+}
+
+/**
+  * @brief			Can be done in place, data may be equal to dataEnc, because decoded data is never longer than encoded
+  * @param[in]		dataEnc			Without 0x00 frame delimiter
+  * @param[in]		dataEncLen
+  * @param[out]		data
+  * @param[in]		dataLenMax
+  * @param[out]		dataLen
+  * @retval			Alx_Ok
+  * @retval			Alx_Err			dataEnc invalid or data too short
+  */
+Alx_Status AlxCobs_Decode(const uint8_t* dataEnc, uint32_t dataEncLen, uint8_t* data, uint32_t dataLenMax, uint32_t* dataLen)
+{
+	// Local variables
+	uint32_t inIndex = 0;
+	uint32_t outIndex = 0;
+
+	// Decode
+	while (inIndex < dataEncLen)
+	{
+		// Code byte
+		uint8_t code = dataEnc[inIndex];
+		if ((code == 0) || (inIndex + code > dataEncLen)) { ALX_COBS_TRACE("Err: code"); return Alx_Err; }
+		inIndex++;
+
+		// Non-zero bytes
+		for (uint32_t i = 1; i < code; i++)
+		{
+			if ((dataEnc[inIndex] == 0) || (outIndex >= dataLenMax)) { ALX_COBS_TRACE("Err: data"); return Alx_Err; }
+			data[outIndex] = dataEnc[inIndex];
+			outIndex++;
+			inIndex++;
+		}
+
+		// Dropped zero, except after full block and at the end
+		if ((code != 0xFF) && (inIndex < dataEncLen))
+		{
+			if (outIndex >= dataLenMax) { ALX_COBS_TRACE("Err: data"); return Alx_Err; }
+			data[outIndex] = 0;
+			outIndex++;
+		}
+	}
+
+	// Return
+	*dataLen = outIndex;
+	return Alx_Ok;
+}
+
+
+#endif	// #if defined(ALX_C_LIB)
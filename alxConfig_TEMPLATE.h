@@ -178,6 +178,85 @@ extern "C" {
 #define ALX_INA238
 
 
+//------------------------------------------------------------------------------
+// ALX - CLI
+//------------------------------------------------------------------------------
+//#define ALX_CLI_BIN
+//#define ALX_CLI_BIN_FRAME_LEN 256
+//#define ALX_CLI_SUB_NUM_MAX 8
+//#define ALX_CLI_LINE_LEN_MAX 192
+
+
+//------------------------------------------------------------------------------
+// ALX - FS
+//------------------------------------------------------------------------------
+//#define ALX_FS_FATFS_MMC_SECTOR_COUNT 62160896
+//#define ALX_FS_FATFS_FAST_SEEK
+//#define ALX_FS_FATFS_FAST_SEEK_CLMT_LEN 64
+//#define ALX_FS_FATFS_DISK_CACHE
+//#define ALX_FS_FATFS_DISK_CACHE_WRITE_SECTOR_NUM 8
+//#define ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM 4
+//#define ALX_FS_FATFS_DISCARD
+//#define ALX_FS_STATS
+//#define ALX_FS_STATS_TIME_HIST_BIN_NUM 10
+//#define ALX_FS_READ_IN_CHUNKS_PIPELINED_THREAD_STACK_LEN_BYTE 2048
+//#define ALX_FS_READ_IN_CHUNKS_PIPELINED_THREAD_PRIORITY 1
+//#define ALX_FS_MAINTENANCE_THREAD
+//#define ALX_FS_MAINTENANCE_THREAD_STACK_LEN_BYTE 1024
+//#define ALX_FS_MAINTENANCE_THREAD_PRIORITY 0
+//#define ALX_FS_MAINTENANCE_THREAD_PERIOD_MS 1000
+//#define ALX_FS_MAINTENANCE_THREAD_TIME_BUDGET_MS 20
+
+
+//------------------------------------------------------------------------------
+// ALX - FS SAFE
+//------------------------------------------------------------------------------
+//#define ALX_FS_SAFE_GEN
+
+
+//------------------------------------------------------------------------------
+// ALX - LOGGER
+//------------------------------------------------------------------------------
+//#define ALX_LOGGER_FILE_PREALLOC_LEN 65536
+
+
+//------------------------------------------------------------------------------
+// ALX - MEM SAFE
+//------------------------------------------------------------------------------
+//#define ALX_MEM_SAFE_NON_BLOCKING_CHUNK_LEN 32
+//#define ALX_MEM_SAFE_WRITE_DELTA
+//#define ALX_MEM_SAFE_WRITE_DELTA_PAGE_LEN 32
+
+
+//------------------------------------------------------------------------------
+// ALX - PARAM GROUP
+//------------------------------------------------------------------------------
+//#define ALX_PARAM_GROUP_VAL_CHANGED_EVENT	// Param values must be changed only through AlxParamItem setters
+
+
+//------------------------------------------------------------------------------
+// ALX - PARAM ITEM
+//------------------------------------------------------------------------------
+//#define ALX_PARAM_ITEM_DESC_CONST	// Only AlxParamItem_CtorDesc with const descriptor tables in flash, other Ctors are disabled
+
+
+//------------------------------------------------------------------------------
+// ALX - PARAM KV STORE
+//------------------------------------------------------------------------------
+//#define ALX_PARAM_KV_STORE_LOG
+//#define ALX_PARAM_KV_STORE_LOG_PATH "/paramKvStoreLog.bin"
+//#define ALX_PARAM_KV_STORE_LOG_PATH_TMP "/paramKvStoreLogTmp.bin"
+//#define ALX_PARAM_KV_STORE_LOG_LEN_MAX 32768
+//#define ALX_PARAM_KV_STORE_LOG_KEY_LEN_MAX 64
+
+
+//------------------------------------------------------------------------------
+// ALX - PARAM MGMT
+//------------------------------------------------------------------------------
+//#define ALX_PARAM_MGMT_INDEX
+//#define ALX_PARAM_MGMT_VAL_CHANGED_SUB_LEN 4
+
+
 
 
 //------------------------------------------------------------------------------
@@ -250,6 +329,7 @@ extern "C" {
 //// AlxBuild
 //#define ALX_CAN_PARSER_ASSERT_BKPT_ENABLE
 //#define ALX_CLI_ASSERT_BKPT_ENABLE
+//#define ALX_COBS_ASSERT_BKPT_ENABLE
 //#define ALX_CRC_ASSERT_BKPT_ENABLE
 //#define ALX_DELAY_ASSERT_BKPT_ENABLE
 //#define ALX_FIFO_ASSERT_BKPT_ENABLE
@@ -265,6 +345,7 @@ extern "C" {
 //#define ALX_ID_ASSERT_BKPT_ENABLE
 //// AlxInc
 //#define ALX_INTERP_LIN_ASSERT_BKPT_ENABLE
+//#define ALX_JSON_ASSERT_BKPT_ENABLE
 //#define ALX_LFS_CONFIG_ASSERT_BKPT_ENABLE
 //#define ALX_LIN_ASSERT_BKPT_ENABLE
 //#define ALX_LIN_FUN_ASSERT_BKPT_ENABLE
@@ -357,6 +438,7 @@ extern "C" {
 //// AlxBuild
 //#define ALX_CAN_PARSER_ASSERT_TRACE_ENABLE
 //#define ALX_CLI_ASSERT_TRACE_ENABLE
+//#define ALX_COBS_ASSERT_TRACE_ENABLE
 //#define ALX_CRC_ASSERT_TRACE_ENABLE
 //#define ALX_DELAY_ASSERT_TRACE_ENABLE
 //#define ALX_FIFO_ASSERT_TRACE_ENABLE
@@ -372,6 +454,7 @@ extern "C" {
 //#define ALX_ID_ASSERT_TRACE_ENABLE
 //// AlxInc
 //#define ALX_INTERP_LIN_ASSERT_TRACE_ENABLE
+//#define ALX_JSON_ASSERT_TRACE_ENABLE
 //#define ALX_LFS_CONFIG_ASSERT_TRACE_ENABLE
 //#define ALX_LIN_ASSERT_TRACE_ENABLE
 //#define ALX_LIN_FUN_ASSERT_TRACE_ENABLE
@@ -464,6 +547,7 @@ extern "C" {
 // AlxBuild
 #define ALX_CAN_PARSER_ASSERT_RST_ENABLE
 #define ALX_CLI_ASSERT_RST_ENABLE
+#define ALX_COBS_ASSERT_RST_ENABLE
 #define ALX_CRC_ASSERT_RST_ENABLE
 #define ALX_DELAY_ASSERT_RST_ENABLE
 #define ALX_FIFO_ASSERT_RST_ENABLE
@@ -479,6 +563,7 @@ extern "C" {
 #define ALX_ID_ASSERT_RST_ENABLE
 // AlxInc
 #define ALX_INTERP_LIN_ASSERT_RST_ENABLE
+#define ALX_JSON_ASSERT_RST_ENABLE
 #define ALX_LFS_CONFIG_ASSERT_RST_ENABLE
 #define ALX_LIN_ASSERT_RST_ENABLE
 #define ALX_LIN_FUN_ASSERT_RST_ENABLE
@@ -572,6 +657,7 @@ extern "C" {
 // AlxBuild
 #define ALX_CAN_PARSER_TRACE_ENABLE
 #define ALX_CLI_TRACE_ENABLE
+#define ALX_COBS_TRACE_ENABLE
 #define ALX_CRC_TRACE_ENABLE
 #define ALX_DELAY_TRACE_ENABLE
 #define ALX_FIFO_TRACE_ENABLE
@@ -587,6 +673,7 @@ extern "C" {
 #define ALX_ID_TRACE_ENABLE
 // AlxInc
 #define ALX_INTERP_LIN_TRACE_ENABLE
+#define ALX_JSON_TRACE_ENABLE
 #define ALX_LFS_CONFIG_TRACE_ENABLE
 #define ALX_LIN_TRACE_ENABLE
 #define ALX_LIN_FUN_TRACE_ENABLE
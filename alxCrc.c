@@ -82,6 +82,62 @@ uint32_t AlxCrc_Calc(AlxCrc* me, uint8_t* data, uint32_t len)
 	// #1 Assert
 	ALX_CRC_ASSERT(me->wasCtorCalled == true);
 
+	// #2 Calculate CRC in one go
+	uint32_t remainder = AlxCrc_Calc_Start(me);
+	remainder = AlxCrc_Calc_Update(me, remainder, data, len);
+	return AlxCrc_Calc_Finish(me, remainder);
+}
+
+/**
+  * @brief			Start running CRC calculation, used when data is not available in one buffer
+  * @param[in,out]	me
+  * @return			Initial remainder, pass it to AlxCrc_Calc_Update
+  */
+uint32_t AlxCrc_Calc_Start(AlxCrc* me)
+{
+	// #1 Assert
+	ALX_CRC_ASSERT(me->wasCtorCalled == true);
+
+	// #2 Return initial remainder based on configuration
+	switch (me->config)
+	{
+		case AlxCrc_Config_Ccitt:
+		{
+			return 0xFFFF;
+			break;
+		}
+		case AlxCrc_Config_Crc16:
+		{
+			return 0x0000;
+			break;
+		}
+		case AlxCrc_Config_Crc32:
+		{
+			return 0xFFFFFFFF;
+			break;
+		}
+		default:
+		{
+			ALX_CRC_ASSERT(false);	// We should never get here
+			return 0;
+			break;
+		}
+	}
+}
+
+/**
+  * @brief			Continue running CRC calculation with next part of data
+  * @param[in,out]	me
+  * @param[in]		remainder	Remainder returned by AlxCrc_Calc_Start or previous AlxCrc_Calc_Update
+  * @param[in]		data
+  * @param[in]		len
+  * @return			New remainder
+  */
+uint32_t AlxCrc_Calc_Update(AlxCrc* me, uint32_t remainder, uint8_t* data, uint32_t len)
+{
+	// #1 Assert
+	ALX_CRC_ASSERT(me->wasCtorCalled == true);
+
 	// #2 Handle CRC calculation
 	switch (me->config)
 	{
@@ -90,9 +146,7 @@ uint32_t AlxCrc_Calc(AlxCrc* me, uint8_t* data, uint32_t len)
 			// #1 Prepare variables
 			const uint8_t width = (8 * sizeof(uint16_t));
 			const uint16_t polynomial = 0x1021;
-			const uint16_t initialRemainder = 0xFFFF;
-			const uint16_t finalXorValue = 0x0000;
-			uint16_t remainder = initialRemainder;
+			uint16_t remainder16 = (uint16_t)remainder;
 			uint32_t byte = 0;
 			uint8_t  bit = 0;
 
@@ -100,26 +154,26 @@ uint32_t AlxCrc_Calc(AlxCrc* me, uint8_t* data, uint32_t len)
 			for (byte = 0; byte < len; ++byte)
 			{
 				// #2.1 Bring the next byte into the remainder.
-				remainder ^= (data[byte] << (width - 8));
+				remainder16 ^= (data[byte] << (width - 8));
 
 				// #2.2 Perform modulo-2 division, a bit at a time.
 				for (bit = 8; bit > 0; --bit)
 				{
 
 					// #2.3 Try to divide the current data bit.
-					if (remainder & (1 << (width - 1)))
+					if (remainder16 & (1 << (width - 1)))
 					{
-						remainder = (remainder << 1) ^ polynomial;
+						remainder16 = (remainder16 << 1) ^ polynomial;
 					}
 					else
 					{
-						remainder = (remainder << 1);
+						remainder16 = (remainder16 << 1);
 					}
 				}
 			}
 
-			// #3 The final remainder is the CRC result.
-			return (remainder ^ finalXorValue);
+			// #3 Return remainder
+			return remainder16;
 			break;
 		}
 		case AlxCrc_Config_Crc16:
@@ -127,9 +181,7 @@ uint32_t AlxCrc_Calc(AlxCrc* me, uint8_t* data, uint32_t len)
 			// #1 Prepare variables
 			const uint8_t width = (8 * sizeof(uint16_t));
 			const uint16_t polynomial = 0x8005;
-			const uint16_t initialRemainder = 0x0000;
-			const uint16_t finalXorValue = 0x0000;
-			uint16_t remainder = initialRemainder;
+			uint16_t remainder16 = (uint16_t)remainder;
 			uint32_t byte = 0;
 			uint8_t  bit = 0;
 
@@ -137,25 +189,25 @@ uint32_t AlxCrc_Calc(AlxCrc* me, uint8_t* data, uint32_t len)
 			for (byte = 0; byte < len; ++byte)
 			{
 				// #2.1 Bring the next byte into the remainder.
-				remainder ^= (((uint8_t)AlxCrc_Reflect((data[byte]), 8)) << (width - 8));
+				remainder16 ^= (((uint8_t)AlxCrc_Reflect((data[byte]), 8)) << (width - 8));
 
 				// #2.2 Perform modulo-2 division, a bit at a time.
 				for (bit = 8; bit > 0; --bit)
 				{
 					// #2.3 Try to divide the current data bit.
-					if (remainder & (1 << (width - 1)))
+					if (remainder16 & (1 << (width - 1)))
 					{
-						remainder = (remainder << 1) ^ polynomial;
+						remainder16 = (remainder16 << 1) ^ polynomial;
 					}
 					else
 					{
-						remainder = (remainder << 1);
+						remainder16 = (remainder16 << 1);
 					}
 				}
 			}
 
-			// #3 The final remainder is the CRC result.
-			return (((uint16_t)AlxCrc_Reflect((remainder), width)) ^ finalXorValue);
+			// #3 Return remainder
+			return remainder16;
 			break;
 		}
 		case AlxCrc_Config_Crc32:
@@ -163,9 +215,6 @@ uint32_t AlxCrc_Calc(AlxCrc* me, uint8_t* data, uint32_t len)
 			// #1 Prepare variables
 			const uint8_t width = (8 * sizeof(uint32_t));
 			const uint32_t polynomial = 0x04C11DB7;
-			const uint32_t initialRemainder = 0xFFFFFFFF;
-			const uint32_t finalXorValue = 0xFFFFFFFF;
-			uint32_t remainder = initialRemainder;
 			uint32_t byte = 0;
 			uint8_t  bit = 0;
 
@@ -190,13 +239,57 @@ uint32_t AlxCrc_Calc(AlxCrc* me, uint8_t* data, uint32_t len)
 				}
 			}
 
-			// #3 The final remainder is the CRC result.
+			// #3 Return remainder
+			return remainder;
+			break;
+		}
+		default:
+		{
+			ALX_CRC_ASSERT(false);	// We should never get here
+			return 0;
+			break;
+		}
+	}
+}
+
+/**
+  * @brief			Finish running CRC calculation
+  * @param[in,out]	me
+  * @param[in]		remainder	Remainder returned by last AlxCrc_Calc_Update
+  * @return			CRC
+  */
+uint32_t AlxCrc_Calc_Finish(AlxCrc* me, uint32_t remainder)
+{
+	// #1 Assert
+	ALX_CRC_ASSERT(me->wasCtorCalled == true);
+
+	// #2 The final remainder is the CRC result
+	switch (me->config)
+	{
+		case AlxCrc_Config_Ccitt:
+		{
+			const uint16_t finalXorValue = 0x0000;
+			return ((uint16_t)remainder ^ finalXorValue);
+			break;
+		}
+		case AlxCrc_Config_Crc16:
+		{
+			const uint8_t width = (8 * sizeof(uint16_t));
+			const uint16_t finalXorValue = 0x0000;
+			return (((uint16_t)AlxCrc_Reflect((remainder), width)) ^ finalXorValue);
+			break;
+		}
+		case AlxCrc_Config_Crc32:
+		{
+			const uint8_t width = (8 * sizeof(uint32_t));
+			const uint32_t finalXorValue = 0xFFFFFFFF;
 			return (((uint32_t)AlxCrc_Reflect((remainder), width)) ^ finalXorValue);
 			break;
 		}
 		default:
 		{
 			ALX_CRC_ASSERT(false);	// We should never get here
+			return 0;
 			break;
 		}
 	}
@@ -108,6 +108,9 @@ void AlxCrc_Ctor
 // Functions
 //******************************************************************************
 uint32_t AlxCrc_Calc(AlxCrc* me, uint8_t* data, uint32_t len);
+uint32_t AlxCrc_Calc_Start(AlxCrc* me);
+uint32_t AlxCrc_Calc_Update(AlxCrc* me, uint32_t remainder, uint8_t* data, uint32_t len);
+uint32_t AlxCrc_Calc_Finish(AlxCrc* me, uint32_t remainder);
 bool AlxCrc_IsOk(AlxCrc* me, uint8_t* dataWithCrc, uint32_t lenWithCrc, uint32_t* validatedCrc);
 uint32_t AlxCrc_GetLen(AlxCrc* me);
 
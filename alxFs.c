@@ -37,6 +37,34 @@
 #if defined(ALX_C_LIB)
 
 
+//******************************************************************************
+// Private Types
+//******************************************************************************
+typedef struct
+{
+	// Parameters
+	AlxFs* me;
+	AlxFs_File* file;
+	uint8_t* chunkBuff[2];
+	uint32_t chunkLen;
+	uint32_t fileSize;
+	AlxOsMutex* alxOsMutex;
+
+	// Variables
+	uint32_t chunkLenActual[2];
+	Alx_Status chunkStatus[2];
+	bool chunkIsLast[2];
+	uint32_t fileSizeRead;
+	uint64_t readTime_us;
+	#if defined(ALX_FREE_RTOS)
+	AlxOsMutex chunkFull[2];
+	AlxOsMutex chunkEmpty[2];
+	AlxOsMutex pipeDone;
+	volatile bool abort;
+	#endif
+} AlxFs_File_ReadInChunks_Pipeline;
+
+
 //******************************************************************************
 // Private Variables
 //******************************************************************************
@@ -50,11 +78,44 @@ static AlxFs* alxFs_Fatfs_Mmc_Usb_me = NULL;
 //******************************************************************************
 
 
+//------------------------------------------------------------------------------
+// General
+//------------------------------------------------------------------------------
+static Alx_Status AlxFs_File_Read_Private(AlxFs* me, AlxFs_File* file, void* data, uint32_t len, uint32_t* lenActual);
+static Alx_Status AlxFs_File_Write_Private(AlxFs* me, AlxFs_File* file, void* data, uint32_t len);
+static Alx_Status AlxFs_File_Seek_Private(AlxFs* me, AlxFs_File* file, int32_t offset, AlxFs_File_Seek_Origin origin, uint32_t* positionNew);
+static Alx_Status AlxFs_Dir_Read_Private(AlxFs* me, AlxFs_Dir* dir, AlxFs_Info* info);
+static void AlxFs_File_ReadInChunks_Pipelined_ReadChunk(AlxFs_File_ReadInChunks_Pipeline* pipe, uint32_t i);
+#if defined(ALX_FREE_RTOS)
+static void AlxFs_File_ReadInChunks_Pipelined_Pipe(AlxFs_File_ReadInChunks_Pipeline* pipe);
+static void AlxFs_File_ReadInChunks_Pipelined_Thread(void* param);
+#endif
+static Alx_Status AlxFs_Maintenance_Private(AlxFs* me, uint32_t timeBudget_ms);
+#if defined(ALX_FS_STATS)
+static void AlxFs_Stats_Record(AlxFs* me, AlxFs_Stats_OpType opType, uint32_t len_byte, uint64_t time_us);
+#endif
+#if defined(ALX_FREE_RTOS) && defined(ALX_FS_MAINTENANCE_THREAD)
+static void AlxFs_Maintenance_Thread(void* param);
+#endif
+
+
 //------------------------------------------------------------------------------
 // Fatfs_Mmc & Fatfs_Usb
 //------------------------------------------------------------------------------
 #if defined(ALX_FATFS)
 static void AlxFs_Fatfs_Mmc_Usb_Ctor(AlxFs* me);
+static Alx_Status AlxFs_Fatfs_Mmc_Usb_ReadBlock(AlxFs* me, uint8_t* buff, LBA_t sector, uint32_t count);
+static Alx_Status AlxFs_Fatfs_Mmc_Usb_WriteBlock(AlxFs* me, const uint8_t* buff, LBA_t sector, uint32_t count);
+#endif
+#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_DISK_CACHE)
+static void AlxFs_Fatfs_DiskCache_Reset(AlxFs* me);
+static Alx_Status AlxFs_Fatfs_DiskCache_Flush(AlxFs* me);
+static Alx_Status AlxFs_Fatfs_DiskCache_Read(AlxFs* me, uint8_t* buff, LBA_t sector, uint32_t count);
+static Alx_Status AlxFs_Fatfs_DiskCache_Write(AlxFs* me, const uint8_t* buff, LBA_t sector, uint32_t count);
+#endif
+#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_DISCARD)
+static void AlxFs_Fatfs_Discard_Add(AlxFs* me, LBA_t sectorStart, LBA_t sectorEnd);
+static Alx_Status AlxFs_Fatfs_Discard_Flush(AlxFs* me);
 #endif
 
 
@@ -90,6 +151,17 @@ static int AlxFs_Lfs_Mmc_Unlock(const struct lfs_config* c);
 #endif
 
 
+//------------------------------------------------------------------------------
+// Lfs Stats
+//------------------------------------------------------------------------------
+#if defined(ALX_LFS) && defined(ALX_FS_STATS)
+static int AlxFs_Lfs_Stats_ReadBlock(const struct lfs_config* c, lfs_block_t block, lfs_off_t off, void* buffer, lfs_size_t size);
+static int AlxFs_Lfs_Stats_ProgBlock(const struct lfs_config* c, lfs_block_t block, lfs_off_t off, const void* buffer, lfs_size_t size);
+static int AlxFs_Lfs_Stats_EraseBlock(const struct lfs_config* c, lfs_block_t block);
+static int AlxFs_Lfs_Stats_SyncBlock(const struct lfs_config* c);
+#endif
+
+
 //------------------------------------------------------------------------------
 // Callback Functions
 //------------------------------------------------------------------------------
@@ -120,6 +192,36 @@ void AlxFs_Ctor
 	me->do_DBG_EraseBlock = do_DBG_EraseBlock;
 	me->do_DBG_SyncBlock = do_DBG_SyncBlock;
 
+	// Variables
+	AlxOsMutex_CtorPrioInherit(&me->alxOsMutex);	// Thread waiting for volume raises priority of holder, e.g. idle maintenance thread
+	#if defined(ALX_FREE_RTOS) && defined(ALX_FS_MAINTENANCE_THREAD)
+	AlxOsThread_Ctor
+	(
+		&me->alxOsThread_Maintenance,
+		AlxFs_Maintenance_Thread,
+		"AlxFs_Maintenance",
+		ALX_FS_MAINTENANCE_THREAD_STACK_LEN_BYTE,
+		me,
+		ALX_FS_MAINTENANCE_THREAD_PRIORITY
+	);
+	#endif
+	#if defined(ALX_FREE_RTOS)
+	AlxOsThread_Ctor
+	(
+		&me->alxOsThread_ReadInChunks,
+		AlxFs_File_ReadInChunks_Pipelined_Thread,
+		"AlxFs_ReadInChunks",
+		ALX_FS_READ_IN_CHUNKS_PIPELINED_THREAD_STACK_LEN_BYTE,
+		me,
+		ALX_FS_READ_IN_CHUNKS_PIPELINED_THREAD_PRIORITY
+	);
+	AlxOsMutex_CtorPrioInherit(&me->alxOsMutex_ReadInChunks);
+	AlxOsMutex_Ctor(&me->readInChunksJobStart);
+	AlxOsMutex_Lock(&me->readInChunksJobStart);	// No pipeline yet
+	me->readInChunksPipe = NULL;
+	me->readInChunksIsThreadStarted = false;
+	#endif
+
 	// Ctor
 	if (me->config == AlxFs_Config_Undefined)
 	{
@@ -145,6 +247,25 @@ void AlxFs_Ctor
 		ALX_FS_ASSERT(false);	// We should never get here
 	}
 
+	// Stats
+	#if defined(ALX_FS_STATS)
+	memset(&me->stats, 0, sizeof(me->stats));
+	#endif
+	#if defined(ALX_LFS) && defined(ALX_FS_STATS)
+	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
+	{
+		// Route block device callbacks through stats callbacks, which then call backend callbacks
+		me->lfsReadBlock = me->lfsConfig.read;
+		me->lfsProgBlock = me->lfsConfig.prog;
+		me->lfsEraseBlock = me->lfsConfig.erase;
+		me->lfsSyncBlock = me->lfsConfig.sync;
+		me->lfsConfig.read = AlxFs_Lfs_Stats_ReadBlock;
+		me->lfsConfig.prog = AlxFs_Lfs_Stats_ProgBlock;
+		me->lfsConfig.erase = AlxFs_Lfs_Stats_EraseBlock;
+		me->lfsConfig.sync = AlxFs_Lfs_Stats_SyncBlock;
+	}
+	#endif
+
 	// Info
 	me->wasCtorCalled = true;
 	me->isMounted = false;
@@ -164,6 +285,7 @@ Alx_Status AlxFs_Mount(AlxFs* me)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -183,6 +305,11 @@ Alx_Status AlxFs_Mount(AlxFs* me)
 		status = lfs_mount(&me->lfs, &me->lfsConfig);
 	}
 	#endif
+	if (status == 0)
+	{
+		me->isMounted = true;	// Set isMounted while locked, so maintenance never runs on unmounted volume
+	}
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -191,9 +318,6 @@ Alx_Status AlxFs_Mount(AlxFs* me)
 		return Alx_Err;
 	}
 
-	// Set isMounted
-	me->isMounted = true;
-
 	// Return
 	return Alx_Ok;
 }
@@ -207,6 +331,7 @@ Alx_Status AlxFs_UnMount(AlxFs* me)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -219,6 +344,11 @@ Alx_Status AlxFs_UnMount(AlxFs* me)
 		status = lfs_unmount(&me->lfs);
 	}
 	#endif
+	if (status == 0)
+	{
+		me->isMounted = false;	// Clear isMounted while locked, so maintenance never runs on unmounted volume
+	}
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -227,9 +357,6 @@ Alx_Status AlxFs_UnMount(AlxFs* me)
 		return Alx_Err;
 	}
 
-	// Clear isMounted
-	me->isMounted = false;
-
 	// Return
 	return Alx_Ok;
 }
@@ -276,6 +403,7 @@ Alx_Status AlxFs_Format(AlxFs* me)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -288,6 +416,7 @@ Alx_Status AlxFs_Format(AlxFs* me)
 		status = lfs_format(&me->lfs, &me->lfsConfig);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -309,6 +438,7 @@ Alx_Status AlxFs_Remove(AlxFs* me, const char* path)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -321,6 +451,7 @@ Alx_Status AlxFs_Remove(AlxFs* me, const char* path)
 		status = lfs_remove(&me->lfs, path);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -342,6 +473,7 @@ Alx_Status AlxFs_Rename(AlxFs* me, const char* pathOld, const char* pathNew)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -354,6 +486,7 @@ Alx_Status AlxFs_Rename(AlxFs* me, const char* pathOld, const char* pathNew)
 		status = lfs_rename(&me->lfs, pathOld, pathNew);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -376,8 +509,14 @@ Alx_Status AlxFs_File_Open(AlxFs* me, AlxFs_File* file, const char* path, const
 
 	// Local variables
 	int32_t status = -1;
+	bool isNoFile = false;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	#endif
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -416,6 +555,32 @@ Alx_Status AlxFs_File_Open(AlxFs* me, AlxFs_File* file, const char* path, const
 
 		// Do
 		status = f_open(&file->fatfsFile, path, fatfsMode);
+		isNoFile = (status == FR_NO_FILE) || (status == FR_NO_PATH);
+
+		// If read-only, build cluster link map table, so seeks don't have to walk FAT cluster chain from the start
+		// File in fast seek mode can't be expanded, so it is used only for read-only files
+		#if defined(ALX_FS_FATFS_FAST_SEEK)
+		if ((status == FR_OK) && (fatfsMode == FA_READ))
+		{
+			// Prepare
+			file->fatfsClmt[0] = ALX_FS_FATFS_FAST_SEEK_CLMT_LEN;
+			file->fatfsFile.cltbl = file->fatfsClmt;
+
+			// Create
+			int32_t statusClmt = f_lseek(&file->fatfsFile, CREATE_LINKMAP);
+			if (statusClmt == FR_NOT_ENOUGH_CORE)
+			{
+				// File too fragmented for cluster link map table, fallback to normal seek
+				file->fatfsFile.cltbl = NULL;
+			}
+			else if (statusClmt != FR_OK)
+			{
+				ALX_FS_TRACE_WRN("Err: %d, path=%s, mode=%s", statusClmt, path, mode);
+				f_close(&file->fatfsFile);
+				status = statusClmt;
+			}
+		}
+		#endif
 	}
 	#endif
 	#if defined(ALX_LFS)
@@ -456,13 +621,22 @@ Alx_Status AlxFs_File_Open(AlxFs* me, AlxFs_File* file, const char* path, const
 
 		// Do
 		status = lfs_file_open(&me->lfs, &file->lfsFile, path, lfsMode);
+		isNoFile = (status == LFS_ERR_NOENT);
 	}
 	#endif
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_FileOpen, 0, AlxTimSw_Get_us(&alxTimSw_Stats));
+	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
 	{
 		ALX_FS_TRACE_WRN("Err: %d, path=%s, mode=%s", status, path, mode);
+		if (isNoFile)
+		{
+			return AlxFs_ErrNoFile;
+		}
 		return Alx_Err;
 	}
 
@@ -479,6 +653,11 @@ Alx_Status AlxFs_File_Close(AlxFs* me, AlxFs_File* file)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	#endif
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -491,6 +670,10 @@ Alx_Status AlxFs_File_Close(AlxFs* me, AlxFs_File* file)
 		status = lfs_file_close(&me->lfs, &file->lfsFile);
 	}
 	#endif
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_FileClose, 0, AlxTimSw_Get_us(&alxTimSw_Stats));
+	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -509,34 +692,19 @@ Alx_Status AlxFs_File_Read(AlxFs* me, AlxFs_File* file, void* data, uint32_t len
 	ALX_FS_ASSERT(me->isMounted == true);
 
 	// Do
-	#if defined(ALX_FATFS)
-	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
-	{
-		unsigned int _lenActual = 0;
-		int32_t status = f_read(&file->fatfsFile, data, len, &_lenActual);
-		if (status != 0)
-		{
-			ALX_FS_TRACE_WRN("Err: %d, lenActual=%d, len=%u", status, _lenActual, len);
-			return Alx_Err;
-		}
-		*lenActual = (uint32_t)_lenActual;
-	}
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
 	#endif
-	#if defined(ALX_LFS)
-	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
-	{
-		int32_t _lenActual = lfs_file_read(&me->lfs, &file->lfsFile, data, len);
-		if (_lenActual < 0)
-		{
-			ALX_FS_TRACE_WRN("Err: lenActual=%d, len=%u", _lenActual, len);
-			return Alx_Err;
-		}
-		*lenActual = (uint32_t)_lenActual;
-	}
+	Alx_Status status = AlxFs_File_Read_Private(me, file, data, len, lenActual);
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_FileRead, (status == Alx_Ok) ? *lenActual : 0, AlxTimSw_Get_us(&alxTimSw_Stats));
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Return
-	return Alx_Ok;
+	return status;
 }
 Alx_Status AlxFs_File_ReadStrUntil(AlxFs* me, AlxFs_File* file, char* str, const char* delim, uint32_t len, uint32_t* lenActual)
 {
@@ -552,11 +720,14 @@ Alx_Status AlxFs_File_ReadStrUntil(AlxFs* me, AlxFs_File* file, char* str, const
 	char ch __attribute__((aligned(4))) = 0;
 	uint32_t readLenActual = 0;
 
+	// Lock, whole string is read under single lock
+	AlxOsMutex_Lock(&me->alxOsMutex);
+
 	// Loop
 	for (_lenActual = 0; _lenActual < (len - 1); _lenActual++)
 	{
 		// Read char
-		statusRead = AlxFs_File_Read(me, file, &ch, 1, &readLenActual);
+		statusRead = AlxFs_File_Read_Private(me, file, &ch, 1, &readLenActual);
 		if ((statusRead == Alx_Ok) && (readLenActual == 0))
 		{
 			// Break, we reached end of file, status already AlxFs_ErrNoDelim
@@ -587,6 +758,9 @@ Alx_Status AlxFs_File_ReadStrUntil(AlxFs* me, AlxFs_File* file, char* str, const
 		}
 	}
 
+	// Unlock
+	AlxOsMutex_Unlock(&me->alxOsMutex);
+
 	// Null-terminate string
 	str[_lenActual] = '\0';
 
@@ -601,32 +775,19 @@ Alx_Status AlxFs_File_Write(AlxFs* me, AlxFs_File* file, void* data, uint32_t le
 	ALX_FS_ASSERT(me->isMounted == true);
 
 	// Do
-	#if defined(ALX_FATFS)
-	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
-	{
-		unsigned int lenActual = 0;
-		int32_t status = f_write(&file->fatfsFile, data, len, &lenActual);
-		if ((status != 0) || (lenActual != len))
-		{
-			ALX_FS_TRACE_WRN("Err: %d, lenActual=%d, len=%u", status, lenActual, len);
-			return Alx_Err;
-		}
-	}
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
 	#endif
-	#if defined(ALX_LFS)
-	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
-	{
-		int32_t lenActual = lfs_file_write(&me->lfs, &file->lfsFile, data, len);
-		if (lenActual != (int32_t)len)
-		{
-			ALX_FS_TRACE_WRN("Err: lenActual=%d, len=%u", lenActual, len);
-			return Alx_Err;
-		}
-	}
+	Alx_Status status = AlxFs_File_Write_Private(me, file, data, len);
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_FileWrite, (status == Alx_Ok) ? len : 0, AlxTimSw_Get_us(&alxTimSw_Stats));
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Return
-	return Alx_Ok;
+	return status;
 }
 Alx_Status AlxFs_File_WriteStr(AlxFs* me, AlxFs_File* file, const char* str)
 {
@@ -647,6 +808,11 @@ Alx_Status AlxFs_File_Sync(AlxFs* me, AlxFs_File* file)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	#endif
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -659,6 +825,10 @@ Alx_Status AlxFs_File_Sync(AlxFs* me, AlxFs_File* file)
 		status = lfs_file_sync(&me->lfs, &file->lfsFile);
 	}
 	#endif
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_FileSync, 0, AlxTimSw_Get_us(&alxTimSw_Stats));
+	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -677,81 +847,19 @@ Alx_Status AlxFs_File_Seek(AlxFs* me, AlxFs_File* file, int32_t offset, AlxFs_Fi
 	ALX_FS_ASSERT(me->isMounted == true);
 
 	// Do
-	#if defined(ALX_FATFS)
-	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
-	{
-		// Local variables
-		int32_t fatfsPositionNew = 0;
-
-		// Prepare
-		if (origin == AlxFs_File_Seek_Origin_Set)
-		{
-			fatfsPositionNew = offset;
-		}
-		else if(origin == AlxFs_File_Seek_Origin_Cur)
-		{
-			fatfsPositionNew = f_tell(&file->fatfsFile) + offset;
-		}
-		else if(origin == AlxFs_File_Seek_Origin_End)
-		{
-			fatfsPositionNew = f_size(&file->fatfsFile) + offset;
-		}
-		else
-		{
-			ALX_FS_ASSERT(false);	// We should never get here
-		}
-
-		// Do
-		int32_t status = f_lseek(&file->fatfsFile, fatfsPositionNew);
-		if (status != 0)
-		{
-			ALX_FS_TRACE_WRN("Err: %d, fatfsPositionNew=%d, offset=%d, origin=%d", status, fatfsPositionNew, offset, origin);
-			return Alx_Err;
-		}
-
-		// Return
-		*positionNew = (uint32_t)fatfsPositionNew;
-	}
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
 	#endif
-	#if defined(ALX_LFS)
-	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
-	{
-		// Local variables
-		int lfsOrigin = 0;
-
-		// Prepare
-		if (origin == AlxFs_File_Seek_Origin_Set)
-		{
-			lfsOrigin = LFS_SEEK_SET;
-		}
-		else if(origin == AlxFs_File_Seek_Origin_Cur)
-		{
-			lfsOrigin = LFS_SEEK_CUR;
-		}
-		else if(origin == AlxFs_File_Seek_Origin_End)
-		{
-			lfsOrigin = LFS_SEEK_END;
-		}
-		else
-		{
-			ALX_FS_ASSERT(false);	// We should never get here
-		}
-
-		// Do
-		int32_t lfsPositionNew = lfs_file_seek(&me->lfs, &file->lfsFile, (lfs_soff_t)offset, lfsOrigin);
-		if (lfsPositionNew < 0)
-		{
-			ALX_FS_TRACE_WRN("Err: lfsPositionNew=%d, offset=%d, origin=%d", lfsPositionNew, offset, origin);
-			return Alx_Err;
-		}
-
-		// Return
-		*positionNew = (uint32_t)lfsPositionNew;
-	}
+	Alx_Status status = AlxFs_File_Seek_Private(me, file, offset, origin, positionNew);
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_FileSeek, 0, AlxTimSw_Get_us(&alxTimSw_Stats));
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Return
-	return Alx_Ok;
+	return status;
 }
 Alx_Status AlxFs_File_Tell(AlxFs* me, AlxFs_File* file, uint32_t* position)
 {
@@ -763,6 +871,7 @@ Alx_Status AlxFs_File_Tell(AlxFs* me, AlxFs_File* file, uint32_t* position)
 	int32_t _position = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -775,6 +884,7 @@ Alx_Status AlxFs_File_Tell(AlxFs* me, AlxFs_File* file, uint32_t* position)
 		_position = lfs_file_tell(&me->lfs, &file->lfsFile);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (_position < 0)
@@ -797,6 +907,7 @@ Alx_Status AlxFs_File_Rewind(AlxFs* me, AlxFs_File* file)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -809,6 +920,7 @@ Alx_Status AlxFs_File_Rewind(AlxFs* me, AlxFs_File* file)
 		status = lfs_file_rewind(&me->lfs, &file->lfsFile);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -830,6 +942,7 @@ Alx_Status AlxFs_File_Size(AlxFs* me, AlxFs_File* file, uint32_t* size)
 	int32_t _size = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -842,6 +955,7 @@ Alx_Status AlxFs_File_Size(AlxFs* me, AlxFs_File* file, uint32_t* size)
 		_size = lfs_file_size(&me->lfs, &file->lfsFile);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (_size < 0)
@@ -864,6 +978,7 @@ Alx_Status AlxFs_File_Truncate(AlxFs* me, AlxFs_File* file, uint32_t size)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
@@ -883,6 +998,7 @@ Alx_Status AlxFs_File_Truncate(AlxFs* me, AlxFs_File* file, uint32_t size)
 		status = lfs_file_truncate(&me->lfs, &file->lfsFile, size);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -894,6 +1010,65 @@ Alx_Status AlxFs_File_Truncate(AlxFs* me, AlxFs_File* file, uint32_t size)
 	// Return
 	return Alx_Ok;
 }
+Alx_Status AlxFs_File_Preallocate(AlxFs* me, AlxFs_File* file, uint32_t size, bool contiguous)
+{
+	//------------------------------------------------------------------------------
+	// Only Fatfs, Lfs has no way to allocate blocks without writing them, so Alx_Err is returned
+	// File must be empty and opened for writing, storage is allocated now, file size is set to size & file pointer stays at 0
+	// - contiguous == true:  Contiguous cluster chain is allocated, fails if there is no large enough contiguous free area
+	// - contiguous == false: Cluster chain is allocated from any free clusters
+	// Allocated data is not initialized, caller must track end of written data & truncate file to it when done
+	//------------------------------------------------------------------------------
+
+	// Assert
+	ALX_FS_ASSERT(me->wasCtorCalled == true);
+	ALX_FS_ASSERT(me->isMounted == true);
+	ALX_FS_ASSERT(size > 0);
+
+	// Local variables
+	int32_t status = -1;
+
+	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	#if defined(ALX_FATFS)
+	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
+	{
+		if (contiguous)
+		{
+			status = f_expand(&file->fatfsFile, size, 1);
+		}
+		else
+		{
+			// Move file pointer beyond end of file, this allocates clusters & expands file, on disk full file pointer stops at allocated size
+			status = f_lseek(&file->fatfsFile, size);
+			if ((status == 0) && (f_tell(&file->fatfsFile) != size))
+			{
+				status = FR_DENIED;
+			}
+
+			// Move file pointer back
+			if (status == 0)
+			{
+				status = f_lseek(&file->fatfsFile, 0);
+			}
+		}
+	}
+	#else
+	(void)file;
+	(void)contiguous;
+	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
+
+	// Trace
+	if (status != 0)
+	{
+		ALX_FS_TRACE_WRN("Err: %d, size=%u, contiguous=%u", status, size, contiguous);
+		return Alx_Err;
+	}
+
+	// Return
+	return Alx_Ok;
+}
 Alx_Status AlxFs_File_ReadInChunks(AlxFs* me, const char* path, uint8_t* chunkBuff, uint32_t chunkLen, Alx_Status(*chunkRead_Callback)(void* ctx, void* chunkData, uint32_t chunkLenActual), void* chunkRead_Callback_Ctx, uint32_t* readLen, AlxOsMutex* alxOsMutex)
 {
 	// Assert
@@ -998,62 +1173,215 @@ Alx_Status AlxFs_File_ReadInChunks(AlxFs* me, const char* path, uint8_t* chunkBu
 	*readLen = fileSizeRead;
 	return Alx_Ok;
 }
-Alx_Status AlxFs_File_Trace(AlxFs* me, const char* path, bool bin)
+Alx_Status AlxFs_File_ReadInChunks_Pipelined(AlxFs* me, const char* path, uint8_t* chunkBuffA, uint8_t* chunkBuffB, uint32_t chunkLen, Alx_Status(*chunkRead_Callback)(void* ctx, void* chunkData, uint32_t chunkLenActual), void* chunkRead_Callback_Ctx, uint32_t* readLen, AlxOsMutex* alxOsMutex, AlxFs_File_ReadInChunks_Stats* stats)
 {
-	// Assert
-	ALX_FS_ASSERT(me->wasCtorCalled == true);
-	ALX_FS_ASSERT(me->isMounted == true);
-
-	// Local variables
-	uint8_t chunkBuff[ALX_FS_BUFF_LEN] = {};
-
-	// Trace
-	ALX_FS_TRACE_FORMAT("AlxFs - File '%s' Trace\r\n", path);
-
-	// Read
-	uint32_t readLen = 0;
-	Alx_Status status = AlxFs_File_ReadInChunks(me, path, chunkBuff, sizeof(chunkBuff), AlxFs_File_Trace_ChunkRead_Callback, &bin, &readLen, NULL);
-
-	// Trace
-	ALX_FS_TRACE_FORMAT("\r\n");
+	//------------------------------------------------------------------------------
+	// Pipelined variant of AlxFs_File_ReadInChunks
+	// - With FreeRTOS, reader thread reads next chunk into one buffer while chunkRead_Callback consumes previous chunk from the other buffer
+	// - Reader thread is started on first call and then serves all pipelined reads of this volume, one at a time
+	// - Without FreeRTOS, chunks are read and consumed sequentially, stats are still provided
+	// - stats is optional and can be NULL
+	//------------------------------------------------------------------------------
 
-	// Return
-	return status;
-}
-Alx_Status AlxFs_Dir_Make(AlxFs* me, const char* path)
-{
 	// Assert
 	ALX_FS_ASSERT(me->wasCtorCalled == true);
 	ALX_FS_ASSERT(me->isMounted == true);
+	ALX_FS_ASSERT(chunkBuffA != chunkBuffB);
 
 	// Local variables
-	int32_t status = -1;
+	Alx_Status status = Alx_Err;
+	AlxFs_File file = {};
+	AlxFs_File_ReadInChunks_Pipeline pipe = {};
+	AlxFs_File_ReadInChunks_Stats statsLocal = {};
+	AlxTimSw alxTimSw_Total;
+	AlxTimSw alxTimSw;
+	uint32_t fileSize = 0;
+	uint32_t fileSizeConsumed = 0;
+	uint32_t i = 0;
+	AlxTimSw_Ctor(&alxTimSw_Total, true);
+	AlxTimSw_Ctor(&alxTimSw, false);
 
-	// Do
-	#if defined(ALX_FATFS)
-	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
+	// Lock reader thread, start it on first call
+	#if defined(ALX_FREE_RTOS)
+	AlxOsMutex_Lock(&me->alxOsMutex_ReadInChunks);
+	if (me->readInChunksIsThreadStarted == false)
 	{
-		status = f_mkdir(path);
-	}
-	#endif
-	#if defined(ALX_LFS)
-	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
-	{
-		status = lfs_mkdir(&me->lfs, path);
+		status = AlxOsThread_Start(&me->alxOsThread_ReadInChunks);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_TRACE_WRN("Err: %d, path=%s", status, path);
+			AlxOsMutex_Unlock(&me->alxOsMutex_ReadInChunks);
+			return status;
+		}
+		me->readInChunksIsThreadStarted = true;
 	}
 	#endif
 
-	// Trace
-	if (status != 0)
+	// Open
+	if (alxOsMutex != NULL) AlxOsMutex_Lock(alxOsMutex);
+	status = AlxFs_File_Open(me, &file, path, "r");
+	if (alxOsMutex != NULL) AlxOsMutex_Unlock(alxOsMutex);
+	if (status != Alx_Ok)
 	{
 		ALX_FS_TRACE_WRN("Err: %d, path=%s", status, path);
-		return Alx_Err;
+		#if defined(ALX_FREE_RTOS)
+		AlxOsMutex_Unlock(&me->alxOsMutex_ReadInChunks);
+		#endif
+		return status;
+	}
+
+	// Get fileSize
+	if (alxOsMutex != NULL) AlxOsMutex_Lock(alxOsMutex);
+	status = AlxFs_File_Size(me, &file, &fileSize);
+	if (alxOsMutex != NULL) AlxOsMutex_Unlock(alxOsMutex);
+	if (status != Alx_Ok)
+	{
+		ALX_FS_TRACE_WRN("Err: %d, path=%s, fileSize=%u", status, path, fileSize);
+		if (alxOsMutex != NULL) AlxOsMutex_Lock(alxOsMutex);
+		Alx_Status statusClose = AlxFs_File_Close(me, &file);
+		if (alxOsMutex != NULL) AlxOsMutex_Unlock(alxOsMutex);
+		if (statusClose != Alx_Ok)
+		{
+			ALX_FS_TRACE_WRN("Err: %d, path=%s", statusClose, path);	// Size error has precedence, close error is only traced
+		}
+		#if defined(ALX_FREE_RTOS)
+		AlxOsMutex_Unlock(&me->alxOsMutex_ReadInChunks);
+		#endif
+		return status;
+	}
+
+	// Prepare pipeline
+	pipe.me = me;
+	pipe.file = &file;
+	pipe.chunkBuff[0] = chunkBuffA;
+	pipe.chunkBuff[1] = chunkBuffB;
+	pipe.chunkLen = chunkLen;
+	pipe.fileSize = fileSize;
+	pipe.alxOsMutex = alxOsMutex;
+
+	// Hand pipeline over to reader thread
+	#if defined(ALX_FREE_RTOS)
+	for (uint32_t j = 0; j < 2; j++)
+	{
+		AlxOsMutex_Ctor(&pipe.chunkFull[j]);
+		AlxOsMutex_Lock(&pipe.chunkFull[j]);	// Chunk not yet read
+		AlxOsMutex_Ctor(&pipe.chunkEmpty[j]);	// Chunk free for reader thread
+	}
+	AlxOsMutex_Ctor(&pipe.pipeDone);
+	AlxOsMutex_Lock(&pipe.pipeDone);
+	me->readInChunksPipe = &pipe;
+	AlxOsMutex_Unlock(&me->readInChunksJobStart);
+	#endif
+
+	// Loop
+	while (true)
+	{
+		// Get chunk
+		AlxTimSw_Start(&alxTimSw);
+		#if defined(ALX_FREE_RTOS)
+		AlxOsMutex_Lock(&pipe.chunkFull[i]);	// Wait for reader thread
+		#else
+		AlxFs_File_ReadInChunks_Pipelined_ReadChunk(&pipe, i);
+		#endif
+		statsLocal.waitTime_us = statsLocal.waitTime_us + AlxTimSw_Get_us(&alxTimSw);
+
+		// Check read
+		status = pipe.chunkStatus[i];
+		if (status != Alx_Ok)
+		{
+			ALX_FS_TRACE_WRN("Err: %d, path=%s, fileSize=%u, chunkLen=%u, chunkLenActual=%u", status, path, fileSize, chunkLen, pipe.chunkLenActual[i]);
+			break;
+		}
+
+		// Callback
+		AlxTimSw_Start(&alxTimSw);
+		status = chunkRead_Callback(chunkRead_Callback_Ctx, pipe.chunkBuff[i], pipe.chunkLenActual[i]);
+		statsLocal.callbackTime_us = statsLocal.callbackTime_us + AlxTimSw_Get_us(&alxTimSw);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_TRACE_WRN("Err: %d, path=%s, fileSize=%u, chunkLenActual=%u", status, path, fileSize, pipe.chunkLenActual[i]);
+			break;
+		}
+
+		// Increment fileSizeConsumed
+		fileSizeConsumed = fileSizeConsumed + pipe.chunkLenActual[i];
+		statsLocal.numOfChunks++;
+
+		// If done, break
+		if (pipe.chunkIsLast[i])
+		{
+			break;
+		}
+
+		// Release chunk to reader thread, continue with other chunk
+		#if defined(ALX_FREE_RTOS)
+		AlxOsMutex_Unlock(&pipe.chunkEmpty[i]);
+		#endif
+		i = i ^ 1;
+	}
+
+	// Stop pipeline, release both chunks so reader thread can not stay blocked, then wait until it stops touching file & pipeline
+	#if defined(ALX_FREE_RTOS)
+	pipe.abort = true;
+	AlxOsMutex_Unlock(&pipe.chunkEmpty[0]);
+	AlxOsMutex_Unlock(&pipe.chunkEmpty[1]);
+	AlxOsMutex_Lock(&pipe.pipeDone);
+	me->readInChunksPipe = NULL;
+	AlxOsMutex_Unlock(&me->alxOsMutex_ReadInChunks);
+	#endif
+
+	// Stats
+	statsLocal.readTime_us = pipe.readTime_us;
+	statsLocal.totalTime_us = AlxTimSw_Get_us(&alxTimSw_Total);
+	if (stats != NULL)
+	{
+		*stats = statsLocal;
+	}
+
+	// Close
+	if (alxOsMutex != NULL) AlxOsMutex_Lock(alxOsMutex);
+	Alx_Status statusClose = AlxFs_File_Close(me, &file);
+	if (alxOsMutex != NULL) AlxOsMutex_Unlock(alxOsMutex);
+	if (statusClose != Alx_Ok)
+	{
+		ALX_FS_TRACE_WRN("Err: %d, path=%s", statusClose, path);
+		if (status == Alx_Ok)
+		{
+			status = statusClose;	// Error before close has precedence
+		}
+	}
+	if (status != Alx_Ok)
+	{
+		return status;
 	}
 
 	// Return
+	*readLen = fileSizeConsumed;
 	return Alx_Ok;
 }
-Alx_Status AlxFs_Dir_Open(AlxFs* me, AlxFs_Dir* dir, const char* path)
+Alx_Status AlxFs_File_Trace(AlxFs* me, const char* path, bool bin)
+{
+	// Assert
+	ALX_FS_ASSERT(me->wasCtorCalled == true);
+	ALX_FS_ASSERT(me->isMounted == true);
+
+	// Local variables
+	uint8_t chunkBuff[ALX_FS_BUFF_LEN] = {};
+
+	// Trace
+	ALX_FS_TRACE_FORMAT("AlxFs - File '%s' Trace\r\n", path);
+
+	// Read
+	uint32_t readLen = 0;
+	Alx_Status status = AlxFs_File_ReadInChunks(me, path, chunkBuff, sizeof(chunkBuff), AlxFs_File_Trace_ChunkRead_Callback, &bin, &readLen, NULL);
+
+	// Trace
+	ALX_FS_TRACE_FORMAT("\r\n");
+
+	// Return
+	return status;
+}
+Alx_Status AlxFs_Dir_Make(AlxFs* me, const char* path)
 {
 	// Assert
 	ALX_FS_ASSERT(me->wasCtorCalled == true);
@@ -1063,18 +1391,20 @@ Alx_Status AlxFs_Dir_Open(AlxFs* me, AlxFs_Dir* dir, const char* path)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
-		status = f_opendir(&dir->fatfsDir, path);
+		status = f_mkdir(path);
 	}
 	#endif
 	#if defined(ALX_LFS)
 	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
 	{
-		status = lfs_dir_open(&me->lfs, &dir->lfsDir, path);
+		status = lfs_mkdir(&me->lfs, path);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
@@ -1086,7 +1416,7 @@ Alx_Status AlxFs_Dir_Open(AlxFs* me, AlxFs_Dir* dir, const char* path)
 	// Return
 	return Alx_Ok;
 }
-Alx_Status AlxFs_Dir_Close(AlxFs* me, AlxFs_Dir* dir)
+Alx_Status AlxFs_Dir_Open(AlxFs* me, AlxFs_Dir* dir, const char* path)
 {
 	// Assert
 	ALX_FS_ASSERT(me->wasCtorCalled == true);
@@ -1096,30 +1426,32 @@ Alx_Status AlxFs_Dir_Close(AlxFs* me, AlxFs_Dir* dir)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
-		status = f_closedir(&dir->fatfsDir);
+		status = f_opendir(&dir->fatfsDir, path);
 	}
 	#endif
 	#if defined(ALX_LFS)
 	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
 	{
-		status = lfs_dir_close(&me->lfs, &dir->lfsDir);
+		status = lfs_dir_open(&me->lfs, &dir->lfsDir, path);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
 
 	// Trace
 	if (status != 0)
 	{
-		ALX_FS_TRACE_WRN("Err: %d", status);
+		ALX_FS_TRACE_WRN("Err: %d, path=%s", status, path);
 		return Alx_Err;
 	}
 
 	// Return
 	return Alx_Ok;
 }
-Alx_Status AlxFs_Dir_Read(AlxFs* me, AlxFs_Dir* dir, AlxFs_Info* info)
+Alx_Status AlxFs_Dir_Close(AlxFs* me, AlxFs_Dir* dir)
 {
 	// Assert
 	ALX_FS_ASSERT(me->wasCtorCalled == true);
@@ -1129,40 +1461,45 @@ Alx_Status AlxFs_Dir_Read(AlxFs* me, AlxFs_Dir* dir, AlxFs_Info* info)
 	int32_t status = -1;
 
 	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
 	#if defined(ALX_FATFS)
 	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
 	{
-		status = f_readdir(&dir->fatfsDir, &info->fatfsInfo);
-		if (status != 0)
-		{
-			ALX_FS_TRACE_WRN("Err: %d", status);
-			return Alx_Err;
-		}
-		else if (strcmp(info->fatfsInfo.fname, "") == 0)
-		{
-			return AlxFs_EndOfDir;
-		}
+		status = f_closedir(&dir->fatfsDir);
 	}
 	#endif
 	#if defined(ALX_LFS)
 	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
 	{
-		status = lfs_dir_read(&me->lfs, &dir->lfsDir, &info->lfsInfo);
-		if (status == 0)
-		{
-			return AlxFs_EndOfDir;
-		}
-		else if (status != 1)
-		{
-			ALX_FS_TRACE_WRN("Err: %d", status);
-			return Alx_Err;
-		}
+		status = lfs_dir_close(&me->lfs, &dir->lfsDir);
 	}
 	#endif
+	AlxOsMutex_Unlock(&me->alxOsMutex);
+
+	// Trace
+	if (status != 0)
+	{
+		ALX_FS_TRACE_WRN("Err: %d", status);
+		return Alx_Err;
+	}
 
 	// Return
 	return Alx_Ok;
 }
+Alx_Status AlxFs_Dir_Read(AlxFs* me, AlxFs_Dir* dir, AlxFs_Info* info)
+{
+	// Assert
+	ALX_FS_ASSERT(me->wasCtorCalled == true);
+	ALX_FS_ASSERT(me->isMounted == true);
+
+	// Do
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	Alx_Status status = AlxFs_Dir_Read_Private(me, dir, info);
+	AlxOsMutex_Unlock(&me->alxOsMutex);
+
+	// Return
+	return status;
+}
 Alx_Status AlxFs_Dir_Trace(AlxFs* me, const char* path, bool fileTrace, bool fileBin)
 {
 	// Assert
@@ -1328,11 +1665,453 @@ Alx_Status AlxFs_Dir_Trace(AlxFs* me, const char* path, bool fileTrace, bool fil
 	// Return
 	return Alx_Ok;
 }
+Alx_Status AlxFs_Maintenance(AlxFs* me, uint32_t timeBudget_ms)
+{
+	// Assert
+	ALX_FS_ASSERT(me->wasCtorCalled == true);
+	ALX_FS_ASSERT(me->isMounted == true);
+
+	// Do
+	return AlxFs_Maintenance_Private(me, timeBudget_ms);
+}
+#if defined(ALX_FS_STATS)
+void AlxFs_Stats_Get(AlxFs* me, AlxFs_Stats* stats)
+{
+	// Assert
+	ALX_FS_ASSERT(me->wasCtorCalled == true);
+	// isMounted -> Don't care
+
+	// Get
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	*stats = me->stats;
+	AlxOsMutex_Unlock(&me->alxOsMutex);
+}
+void AlxFs_Stats_Reset(AlxFs* me)
+{
+	// Assert
+	ALX_FS_ASSERT(me->wasCtorCalled == true);
+	// isMounted -> Don't care
+
+	// Reset
+	AlxOsMutex_Lock(&me->alxOsMutex);
+	memset(&me->stats, 0, sizeof(me->stats));
+	AlxOsMutex_Unlock(&me->alxOsMutex);
+}
+const char* AlxFs_Stats_GetOpTypeStr(AlxFs_Stats_OpType opType)
+{
+	switch (opType)
+	{
+		case AlxFs_Stats_OpType_BlockRead: return "BlockRead";
+		case AlxFs_Stats_OpType_BlockWrite: return "BlockWrite";
+		case AlxFs_Stats_OpType_BlockErase: return "BlockErase";
+		case AlxFs_Stats_OpType_BlockSync: return "BlockSync";
+		case AlxFs_Stats_OpType_FileOpen: return "FileOpen";
+		case AlxFs_Stats_OpType_FileClose: return "FileClose";
+		case AlxFs_Stats_OpType_FileRead: return "FileRead";
+		case AlxFs_Stats_OpType_FileWrite: return "FileWrite";
+		case AlxFs_Stats_OpType_FileSeek: return "FileSeek";
+		case AlxFs_Stats_OpType_FileSync: return "FileSync";
+		default: ALX_FS_ASSERT(false); return "";	// We should never get here
+	}
+}
+#endif
+#if defined(ALX_FREE_RTOS) && defined(ALX_FS_MAINTENANCE_THREAD)
+Alx_Status AlxFs_Maintenance_Thread_Start(AlxFs* me)
+{
+	// Assert
+	ALX_FS_ASSERT(me->wasCtorCalled == true);
+	// isMounted -> Don't care, thread skips maintenance while volume is not mounted
+
+	// Start
+	Alx_Status status = AlxOsThread_Start(&me->alxOsThread_Maintenance);
+	if (status != Alx_Ok)
+	{
+		ALX_FS_TRACE_WRN("Err: %d", status);
+		return status;
+	}
+
+	// Return
+	return Alx_Ok;
+}
+#endif
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+
+
+//------------------------------------------------------------------------------
+// General
+//------------------------------------------------------------------------------
+static Alx_Status AlxFs_File_Read_Private(AlxFs* me, AlxFs_File* file, void* data, uint32_t len, uint32_t* lenActual)
+{
+	// Do
+	#if defined(ALX_FATFS)
+	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
+	{
+		unsigned int _lenActual = 0;
+		int32_t status = f_read(&file->fatfsFile, data, len, &_lenActual);
+		if (status != 0)
+		{
+			ALX_FS_TRACE_WRN("Err: %d, lenActual=%d, len=%u", status, _lenActual, len);
+			return Alx_Err;
+		}
+		*lenActual = (uint32_t)_lenActual;
+	}
+	#endif
+	#if defined(ALX_LFS)
+	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
+	{
+		int32_t _lenActual = lfs_file_read(&me->lfs, &file->lfsFile, data, len);
+		if (_lenActual < 0)
+		{
+			ALX_FS_TRACE_WRN("Err: lenActual=%d, len=%u", _lenActual, len);
+			return Alx_Err;
+		}
+		*lenActual = (uint32_t)_lenActual;
+	}
+	#endif
+
+	// Return
+	return Alx_Ok;
+}
+static Alx_Status AlxFs_File_Write_Private(AlxFs* me, AlxFs_File* file, void* data, uint32_t len)
+{
+	// Do
+	#if defined(ALX_FATFS)
+	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
+	{
+		unsigned int lenActual = 0;
+		int32_t status = f_write(&file->fatfsFile, data, len, &lenActual);
+		if ((status != 0) || (lenActual != len))
+		{
+			ALX_FS_TRACE_WRN("Err: %d, lenActual=%d, len=%u", status, lenActual, len);
+			return Alx_Err;
+		}
+	}
+	#endif
+	#if defined(ALX_LFS)
+	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
+	{
+		int32_t lenActual = lfs_file_write(&me->lfs, &file->lfsFile, data, len);
+		if (lenActual != (int32_t)len)
+		{
+			ALX_FS_TRACE_WRN("Err: lenActual=%d, len=%u", lenActual, len);
+			return Alx_Err;
+		}
+	}
+	#endif
+
+	// Return
+	return Alx_Ok;
+}
+static Alx_Status AlxFs_File_Seek_Private(AlxFs* me, AlxFs_File* file, int32_t offset, AlxFs_File_Seek_Origin origin, uint32_t* positionNew)
+{
+	// Do
+	#if defined(ALX_FATFS)
+	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
+	{
+		// Local variables
+		int32_t fatfsPositionNew = 0;
+
+		// Prepare
+		if (origin == AlxFs_File_Seek_Origin_Set)
+		{
+			fatfsPositionNew = offset;
+		}
+		else if(origin == AlxFs_File_Seek_Origin_Cur)
+		{
+			fatfsPositionNew = f_tell(&file->fatfsFile) + offset;
+		}
+		else if(origin == AlxFs_File_Seek_Origin_End)
+		{
+			fatfsPositionNew = f_size(&file->fatfsFile) + offset;
+		}
+		else
+		{
+			ALX_FS_ASSERT(false);	// We should never get here
+		}
+
+		// Do
+		int32_t status = f_lseek(&file->fatfsFile, fatfsPositionNew);
+		if (status != 0)
+		{
+			ALX_FS_TRACE_WRN("Err: %d, fatfsPositionNew=%d, offset=%d, origin=%d", status, fatfsPositionNew, offset, origin);
+			return Alx_Err;
+		}
+
+		// Return
+		*positionNew = (uint32_t)fatfsPositionNew;
+	}
+	#endif
+	#if defined(ALX_LFS)
+	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
+	{
+		// Local variables
+		int lfsOrigin = 0;
+
+		// Prepare
+		if (origin == AlxFs_File_Seek_Origin_Set)
+		{
+			lfsOrigin = LFS_SEEK_SET;
+		}
+		else if(origin == AlxFs_File_Seek_Origin_Cur)
+		{
+			lfsOrigin = LFS_SEEK_CUR;
+		}
+		else if(origin == AlxFs_File_Seek_Origin_End)
+		{
+			lfsOrigin = LFS_SEEK_END;
+		}
+		else
+		{
+			ALX_FS_ASSERT(false);	// We should never get here
+		}
+
+		// Do
+		int32_t lfsPositionNew = lfs_file_seek(&me->lfs, &file->lfsFile, (lfs_soff_t)offset, lfsOrigin);
+		if (lfsPositionNew < 0)
+		{
+			ALX_FS_TRACE_WRN("Err: lfsPositionNew=%d, offset=%d, origin=%d", lfsPositionNew, offset, origin);
+			return Alx_Err;
+		}
+
+		// Return
+		*positionNew = (uint32_t)lfsPositionNew;
+	}
+	#endif
+
+	// Return
+	return Alx_Ok;
+}
+static Alx_Status AlxFs_Dir_Read_Private(AlxFs* me, AlxFs_Dir* dir, AlxFs_Info* info)
+{
+	// Local variables
+	int32_t status = -1;
+
+	// Do
+	#if defined(ALX_FATFS)
+	if (me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb)
+	{
+		status = f_readdir(&dir->fatfsDir, &info->fatfsInfo);
+		if (status != 0)
+		{
+			ALX_FS_TRACE_WRN("Err: %d", status);
+			return Alx_Err;
+		}
+		else if (strcmp(info->fatfsInfo.fname, "") == 0)
+		{
+			return AlxFs_EndOfDir;
+		}
+	}
+	#endif
+	#if defined(ALX_LFS)
+	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
+	{
+		status = lfs_dir_read(&me->lfs, &dir->lfsDir, &info->lfsInfo);
+		if (status == 0)
+		{
+			return AlxFs_EndOfDir;
+		}
+		else if (status != 1)
+		{
+			ALX_FS_TRACE_WRN("Err: %d", status);
+			return Alx_Err;
+		}
+	}
+	#endif
+
+	// Return
+	return Alx_Ok;
+}
+static void AlxFs_File_ReadInChunks_Pipelined_ReadChunk(AlxFs_File_ReadInChunks_Pipeline* pipe, uint32_t i)
+{
+	// Local variables
+	AlxTimSw alxTimSw;
+	AlxTimSw_Ctor(&alxTimSw, true);
+
+	// Read
+	memset(pipe->chunkBuff[i], 0, pipe->chunkLen);
+	pipe->chunkLenActual[i] = 0;
+	if (pipe->alxOsMutex != NULL) AlxOsMutex_Lock(pipe->alxOsMutex);
+	pipe->chunkStatus[i] = AlxFs_File_Read(pipe->me, pipe->file, pipe->chunkBuff[i], pipe->chunkLen, &pipe->chunkLenActual[i]);
+	if (pipe->alxOsMutex != NULL) AlxOsMutex_Unlock(pipe->alxOsMutex);
+
+	// Increment fileSizeRead
+	pipe->fileSizeRead = pipe->fileSizeRead + pipe->chunkLenActual[i];
+
+	// Set last chunk, no further reads after error, empty read or end of file
+	pipe->chunkIsLast[i] = (pipe->chunkStatus[i] != Alx_Ok) || (pipe->chunkLenActual[i] == 0) || (pipe->fileSizeRead >= pipe->fileSize);
+
+	// Stats
+	pipe->readTime_us = pipe->readTime_us + AlxTimSw_Get_us(&alxTimSw);
+}
+#if defined(ALX_FREE_RTOS)
+static void AlxFs_File_ReadInChunks_Pipelined_Pipe(AlxFs_File_ReadInChunks_Pipeline* pipe)
+{
+	// Local variables
+	uint32_t i = 0;
+
+	// Loop
+	while (true)
+	{
+		// Wait until chunk is released by consumer
+		AlxOsMutex_Lock(&pipe->chunkEmpty[i]);
+		if (pipe->abort)
+		{
+			break;
+		}
+
+		// Read
+		AlxFs_File_ReadInChunks_Pipelined_ReadChunk(pipe, i);
+		bool isLast = pipe->chunkIsLast[i];
+
+		// Hand chunk over to consumer
+		AlxOsMutex_Unlock(&pipe->chunkFull[i]);
+
+		// If done, break
+		if (isLast)
+		{
+			break;
+		}
+		i = i ^ 1;
+	}
+}
+static void AlxFs_File_ReadInChunks_Pipelined_Thread(void* param)
+{
+	// Local variables
+	AlxFs* me = (AlxFs*)param;
+
+	// Loop
+	while (true)
+	{
+		// Wait for pipeline
+		AlxOsMutex_Lock(&me->readInChunksJobStart);
+		AlxFs_File_ReadInChunks_Pipeline* pipe = (AlxFs_File_ReadInChunks_Pipeline*)me->readInChunksPipe;
+
+		// Read chunks
+		AlxFs_File_ReadInChunks_Pipelined_Pipe(pipe);
+
+		// Signal done, pipeline must NOT be touched after this, it is on caller stack
+		AlxOsMutex_Unlock(&pipe->pipeDone);
+	}
+}
+#endif
+static Alx_Status AlxFs_Maintenance_Private(AlxFs* me, uint32_t timeBudget_ms)
+{
+	//------------------------------------------------------------------------------
+	// Runs background work which would otherwise be done inline in write path
+	// - Time budget is checked before each step, single step is not interrupted
+	// - Volume mutex is released between steps, so other threads are blocked for at most one step
+	// - Volume mutex has priority inheritance, so thread waiting for volume raises priority of low priority maintenance thread until step is done
+	//------------------------------------------------------------------------------
+
+	// Local variables
+	int32_t status = 0;
+	AlxTimSw alxTimSw;
+	AlxTimSw_Ctor(&alxTimSw, true);
+	(void)alxTimSw;
+	(void)timeBudget_ms;
+
+	#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_DISK_CACHE)
+	if ((me->config == AlxFs_Config_Fatfs_Mmc || me->config == AlxFs_Config_Fatfs_Usb) && (AlxTimSw_Get_ms(&alxTimSw) < timeBudget_ms))
+	{
+		// Flush write cache, so next write does not have to
+		AlxOsMutex_Lock(&me->alxOsMutex);
+		if (me->isMounted)
+		{
+			status = AlxFs_Fatfs_DiskCache_Flush(me) == Alx_Ok ? 0 : -1;
+		}
+		AlxOsMutex_Unlock(&me->alxOsMutex);
+	}
+	#endif
+	#if defined(ALX_LFS)
+	if (me->config == AlxFs_Config_Lfs_FlashInt || me->config == AlxFs_Config_Lfs_Mmc)
+	{
+		// Finish pending orphan & move cleanup, otherwise done by first write after power loss
+		#if defined(LFS_VERSION) && (LFS_VERSION >= 0x00020006)
+		if ((status == 0) && (AlxTimSw_Get_ms(&alxTimSw) < timeBudget_ms))
+		{
+			AlxOsMutex_Lock(&me->alxOsMutex);
+			if (me->isMounted)
+			{
+				status = lfs_fs_mkconsistent(&me->lfs);
+			}
+			AlxOsMutex_Unlock(&me->alxOsMutex);
+		}
+		#endif
+
+		// Refill lookahead buffer & compact metadata pairs above compact_thresh, otherwise done by block allocation inside write
+		#if defined(LFS_VERSION) && (LFS_VERSION >= 0x00020008)
+		if ((status == 0) && (AlxTimSw_Get_ms(&alxTimSw) < timeBudget_ms))
+		{
+			AlxOsMutex_Lock(&me->alxOsMutex);
+			if (me->isMounted)
+			{
+				status = lfs_fs_gc(&me->lfs);
+			}
+			AlxOsMutex_Unlock(&me->alxOsMutex);
+		}
+		#endif
+	}
+	#endif
+
+	// Trace
+	if (status != 0)
+	{
+		ALX_FS_TRACE_WRN("Err: %d", status);
+		return Alx_Err;
+	}
+
+	// Return
+	return Alx_Ok;
+}
+#if defined(ALX_FREE_RTOS) && defined(ALX_FS_MAINTENANCE_THREAD)
+static void AlxFs_Maintenance_Thread(void* param)
+{
+	// Local variables
+	AlxFs* me = (AlxFs*)param;
+
+	// Loop
+	while (true)
+	{
+		AlxFs_Maintenance_Private(me, ALX_FS_MAINTENANCE_THREAD_TIME_BUDGET_MS);
+		AlxOsDelay_ms(&alxOsDelay, ALX_FS_MAINTENANCE_THREAD_PERIOD_MS);
+	}
+}
+#endif
+#if defined(ALX_FS_STATS)
+static void AlxFs_Stats_Record(AlxFs* me, AlxFs_Stats_OpType opType, uint32_t len_byte, uint64_t time_us)
+{
+	//------------------------------------------------------------------------------
+	// Called with volume mutex locked, block operations are always executed from within locked AlxFs functions
+	//------------------------------------------------------------------------------
+
+	// Local variables
+	AlxFs_Stats_Op* op = &me->stats.op[opType];
+	uint32_t time_us_u32 = (time_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)time_us;
+	uint32_t bin = 0;
+	uint64_t binEdge_us = 4;
 
+	// Find histogram bin
+	while ((time_us >= binEdge_us) && (bin < (ALX_FS_STATS_TIME_HIST_BIN_NUM - 1)))
+	{
+		bin++;
+		binEdge_us = binEdge_us * 4;
+	}
 
-//******************************************************************************
-// Private Functions
-//******************************************************************************
+	// Record
+	op->count++;
+	op->len_byte = op->len_byte + len_byte;
+	op->timeTotal_us = op->timeTotal_us + time_us;
+	if (time_us_u32 > op->timeMax_us)
+	{
+		op->timeMax_us = time_us_u32;
+	}
+	op->timeHist[bin]++;
+}
+#endif
 
 
 //------------------------------------------------------------------------------
@@ -1357,6 +2136,13 @@ static void AlxFs_Fatfs_Mmc_Usb_Ctor(AlxFs* me)
 	me->fatfsMkfsOpt.n_root = ALX_NULL;
 	me->fatfsMkfsOpt.au_size = 0;
 	memset(&me->fatfsMkfsBuff, 0, sizeof(me->fatfsMkfsBuff));
+	#if defined(ALX_FS_FATFS_DISK_CACHE)
+	AlxFs_Fatfs_DiskCache_Reset(me);
+	#endif
+	#if defined(ALX_FS_FATFS_DISCARD)
+	me->fatfsDiscardSector = 0;
+	me->fatfsDiscardSectorCount = 0;
+	#endif
 }
 DSTATUS disk_initialize(BYTE pdrv)
 {
@@ -1366,6 +2152,17 @@ DSTATUS disk_initialize(BYTE pdrv)
 	(void)pdrv;
 
 
+	//------------------------------------------------------------------------------
+	// Reset Disk Cache
+	//------------------------------------------------------------------------------
+	#if defined(ALX_FS_FATFS_DISK_CACHE)
+	AlxFs_Fatfs_DiskCache_Reset(alxFs_Fatfs_Mmc_Usb_me);	// Volume is (re)mounted, media could have been changed
+	#endif
+	#if defined(ALX_FS_FATFS_DISCARD)
+	alxFs_Fatfs_Mmc_Usb_me->fatfsDiscardSectorCount = 0;
+	#endif
+
+
 	//------------------------------------------------------------------------------
 	// Handle
 	//------------------------------------------------------------------------------
@@ -1434,20 +2231,11 @@ DRESULT disk_read(BYTE pdrv, BYTE* buff, LBA_t sector, UINT count)
 	//------------------------------------------------------------------------------
 	// Read
 	//------------------------------------------------------------------------------
-	if(alxFs_Fatfs_Mmc_Usb_me->do_DBG_ReadBlock != NULL) AlxIoPin_Set(alxFs_Fatfs_Mmc_Usb_me->do_DBG_ReadBlock);
-	if (alxFs_Fatfs_Mmc_Usb_me->config == AlxFs_Config_Fatfs_Mmc)
-	{
-		#if defined(ALX_STM32L4)
-		status = AlxMmc_ReadBlock(alxFs_Fatfs_Mmc_Usb_me->alxMmc, count, sector, buff, count * 512, 3, 100);
-		#endif
-	}
-	else if (alxFs_Fatfs_Mmc_Usb_me->config == AlxFs_Config_Fatfs_Usb)
-	{
-		#if defined(ALX_STM32F7)
-		status = AlxUsb_Read(alxFs_Fatfs_Mmc_Usb_me->alxUsb, count, sector, (uint8_t*)buff);
-		#endif
-	}
-	if(alxFs_Fatfs_Mmc_Usb_me->do_DBG_ReadBlock != NULL) AlxIoPin_Reset(alxFs_Fatfs_Mmc_Usb_me->do_DBG_ReadBlock);
+	#if defined(ALX_FS_FATFS_DISK_CACHE)
+	status = AlxFs_Fatfs_DiskCache_Read(alxFs_Fatfs_Mmc_Usb_me, (uint8_t*)buff, sector, count);
+	#else
+	status = AlxFs_Fatfs_Mmc_Usb_ReadBlock(alxFs_Fatfs_Mmc_Usb_me, (uint8_t*)buff, sector, count);
+	#endif
 	if (status != Alx_Ok)
 	{
 		ALX_FS_TRACE_WRN("Err: %d", status);
@@ -1472,20 +2260,11 @@ DRESULT disk_write(BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count)
 	//------------------------------------------------------------------------------
 	// Write
 	//------------------------------------------------------------------------------
-	if(alxFs_Fatfs_Mmc_Usb_me->do_DBG_WriteBlock != NULL) AlxIoPin_Set(alxFs_Fatfs_Mmc_Usb_me->do_DBG_WriteBlock);
-	if (alxFs_Fatfs_Mmc_Usb_me->config == AlxFs_Config_Fatfs_Mmc)
-	{
-		#if defined(ALX_STM32L4)
-		status = AlxMmc_WriteBlock(alxFs_Fatfs_Mmc_Usb_me->alxMmc, count, sector, (uint8_t*)buff, count * 512, 3, 100);
-		#endif
-	}
-	else if (alxFs_Fatfs_Mmc_Usb_me->config == AlxFs_Config_Fatfs_Usb)
-	{
-		#if defined(ALX_STM32F7)
-		status = AlxUsb_Write(alxFs_Fatfs_Mmc_Usb_me->alxUsb, count, sector, (uint8_t*)buff);
-		#endif
-	}
-	if(alxFs_Fatfs_Mmc_Usb_me->do_DBG_WriteBlock != NULL) AlxIoPin_Reset(alxFs_Fatfs_Mmc_Usb_me->do_DBG_WriteBlock);
+	#if defined(ALX_FS_FATFS_DISK_CACHE)
+	status = AlxFs_Fatfs_DiskCache_Write(alxFs_Fatfs_Mmc_Usb_me, (const uint8_t*)buff, sector, count);
+	#else
+	status = AlxFs_Fatfs_Mmc_Usb_WriteBlock(alxFs_Fatfs_Mmc_Usb_me, (const uint8_t*)buff, sector, count);
+	#endif
 	if (status != Alx_Ok)
 	{
 		ALX_FS_TRACE_WRN("Err: %d", status);
@@ -1514,13 +2293,38 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff)
 	{
 		case CTRL_SYNC:
 		{
+			//------------------------------------------------------------------------------
+			// Flush Disk Cache
+			//------------------------------------------------------------------------------
+			#if defined(ALX_FS_FATFS_DISK_CACHE)
+			status = AlxFs_Fatfs_DiskCache_Flush(alxFs_Fatfs_Mmc_Usb_me);
+			if (status != Alx_Ok)
+			{
+				ALX_FS_TRACE_WRN("Err: %d", status);
+				return RES_ERROR;
+			}
+			#endif
+
+
+			//------------------------------------------------------------------------------
+			// Flush Discard, error is ignored, discard is only a hint to device
+			//------------------------------------------------------------------------------
+			#if defined(ALX_FS_FATFS_DISCARD)
+			AlxFs_Fatfs_Discard_Flush(alxFs_Fatfs_Mmc_Usb_me);
+			#endif
+
+
 			//------------------------------------------------------------------------------
 			// Handle
 			//------------------------------------------------------------------------------
+			#if defined(ALX_FS_STATS)
+			AlxTimSw alxTimSw_Stats;
+			AlxTimSw_Ctor(&alxTimSw_Stats, true);
+			#endif
 			if(alxFs_Fatfs_Mmc_Usb_me->do_DBG_SyncBlock != NULL) AlxIoPin_Set(alxFs_Fatfs_Mmc_Usb_me->do_DBG_SyncBlock);
 			if (alxFs_Fatfs_Mmc_Usb_me->config == AlxFs_Config_Fatfs_Mmc)
 			{
-				#if defined(ALX_STM32L4)
+				#if defined(ALX_STM32L4) || defined(ALX_PC)
 				status = AlxMmc_WaitForTransferState(alxFs_Fatfs_Mmc_Usb_me->alxMmc);
 				#endif
 			}
@@ -1529,6 +2333,9 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff)
 				status = Alx_Ok;	// AlxUsb_Read/Write are synchronous, so always return OK
 			}
 			if(alxFs_Fatfs_Mmc_Usb_me->do_DBG_SyncBlock != NULL) AlxIoPin_Reset(alxFs_Fatfs_Mmc_Usb_me->do_DBG_SyncBlock);
+			#if defined(ALX_FS_STATS)
+			AlxFs_Stats_Record(alxFs_Fatfs_Mmc_Usb_me, AlxFs_Stats_OpType_BlockSync, 0, AlxTimSw_Get_us(&alxTimSw_Stats));
+			#endif
 			if (status != Alx_Ok)
 			{
 				ALX_FS_TRACE_WRN("Err: %d", status);
@@ -1549,7 +2356,7 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff)
 			if (alxFs_Fatfs_Mmc_Usb_me->config == AlxFs_Config_Fatfs_Mmc)
 			{
 				// Set
-				*(LBA_t*)buff = 62160896;
+				*(LBA_t*)buff = ALX_FS_FATFS_MMC_SECTOR_COUNT;
 			}
 			else if (alxFs_Fatfs_Mmc_Usb_me->config == AlxFs_Config_Fatfs_Usb)
 			{
@@ -1617,6 +2424,25 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff)
 			// Return
 			return RES_OK;
 		}
+		case CTRL_TRIM:
+		{
+			//------------------------------------------------------------------------------
+			// Handle
+			//------------------------------------------------------------------------------
+			#if defined(ALX_FS_FATFS_DISCARD)
+			if (alxFs_Fatfs_Mmc_Usb_me->config == AlxFs_Config_Fatfs_Mmc)
+			{
+				LBA_t* sectorRange = (LBA_t*)buff;	// [0] start sector, [1] end sector, both inclusive
+				AlxFs_Fatfs_Discard_Add(alxFs_Fatfs_Mmc_Usb_me, sectorRange[0], sectorRange[1]);
+			}
+			#endif
+
+
+			//------------------------------------------------------------------------------
+			// Return
+			//------------------------------------------------------------------------------
+			return RES_OK;	// If discard is disabled or not supported by device, freed sectors are just not reported
+		}
 		default:
 		{
 			// Return
@@ -1624,6 +2450,297 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff)
 		}
 	}
 }
+static Alx_Status AlxFs_Fatfs_Mmc_Usb_ReadBlock(AlxFs* me, uint8_t* buff, LBA_t sector, uint32_t count)
+{
+	// Prepare
+	Alx_Status status = Alx_Err;
+
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	#endif
+
+	// Read
+	if(me->do_DBG_ReadBlock != NULL) AlxIoPin_Set(me->do_DBG_ReadBlock);
+	if (me->config == AlxFs_Config_Fatfs_Mmc)
+	{
+		#if defined(ALX_STM32L4) || defined(ALX_PC)
+		status = AlxMmc_ReadBlock(me->alxMmc, count, sector, buff, count * 512, 3, 100);
+		#endif
+	}
+	else if (me->config == AlxFs_Config_Fatfs_Usb)
+	{
+		#if defined(ALX_STM32F7)
+		status = AlxUsb_Read(me->alxUsb, count, sector, buff);
+		#endif
+	}
+	if(me->do_DBG_ReadBlock != NULL) AlxIoPin_Reset(me->do_DBG_ReadBlock);
+
+	// Stats
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_BlockRead, count * FF_MIN_SS, AlxTimSw_Get_us(&alxTimSw_Stats));
+	#endif
+
+	// Return
+	return status;
+}
+static Alx_Status AlxFs_Fatfs_Mmc_Usb_WriteBlock(AlxFs* me, const uint8_t* buff, LBA_t sector, uint32_t count)
+{
+	// Prepare
+	Alx_Status status = Alx_Err;
+
+	// Flush pending discard first, freed sectors can be reallocated & written before next sync, error is ignored, discard is only a hint to device
+	#if defined(ALX_FS_FATFS_DISCARD)
+	AlxFs_Fatfs_Discard_Flush(me);
+	#endif
+
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	#endif
+
+	// Write
+	if(me->do_DBG_WriteBlock != NULL) AlxIoPin_Set(me->do_DBG_WriteBlock);
+	if (me->config == AlxFs_Config_Fatfs_Mmc)
+	{
+		#if defined(ALX_STM32L4) || defined(ALX_PC)
+		status = AlxMmc_WriteBlock(me->alxMmc, count, sector, (uint8_t*)buff, count * 512, 3, 100);
+		#endif
+	}
+	else if (me->config == AlxFs_Config_Fatfs_Usb)
+	{
+		#if defined(ALX_STM32F7)
+		status = AlxUsb_Write(me->alxUsb, count, sector, (uint8_t*)buff);
+		#endif
+	}
+	if(me->do_DBG_WriteBlock != NULL) AlxIoPin_Reset(me->do_DBG_WriteBlock);
+
+	// Stats
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_BlockWrite, count * FF_MIN_SS, AlxTimSw_Get_us(&alxTimSw_Stats));
+	#endif
+
+	// Return
+	return status;
+}
+#endif
+
+
+//------------------------------------------------------------------------------
+// Fatfs Disk Cache
+//------------------------------------------------------------------------------
+#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_DISK_CACHE)
+static void AlxFs_Fatfs_DiskCache_Reset(AlxFs* me)
+{
+	// Write cache
+	me->fatfsWriteCacheSector = 0;
+	me->fatfsWriteCacheSectorCount = 0;
+
+	// Read cache
+	for (uint32_t i = 0; i < ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM; i++)
+	{
+		me->fatfsReadCacheSector[i] = 0;
+		me->fatfsReadCacheUsedCount[i] = 0;
+		me->fatfsReadCacheValid[i] = false;
+	}
+	me->fatfsReadCacheUsedCountLast = 0;
+}
+static Alx_Status AlxFs_Fatfs_DiskCache_Flush(AlxFs* me)
+{
+	// If nothing to flush, return
+	if (me->fatfsWriteCacheSectorCount == 0)
+	{
+		return Alx_Ok;
+	}
+
+	// Write all collected contiguous sectors with single multi-block write
+	Alx_Status status = AlxFs_Fatfs_Mmc_Usb_WriteBlock(me, me->fatfsWriteCacheBuff, me->fatfsWriteCacheSector, me->fatfsWriteCacheSectorCount);
+
+	// Clear, also on error, FatFs will report error to caller
+	me->fatfsWriteCacheSectorCount = 0;
+
+	// Return
+	return status;
+}
+static Alx_Status AlxFs_Fatfs_DiskCache_Read(AlxFs* me, uint8_t* buff, LBA_t sector, uint32_t count)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	LBA_t writeCacheSectorEnd = me->fatfsWriteCacheSector + me->fatfsWriteCacheSectorCount;
+
+	// If requested sectors overlap with collected write sectors, flush them first
+	if ((me->fatfsWriteCacheSectorCount > 0) && (sector < writeCacheSectorEnd) && (me->fatfsWriteCacheSector < sector + count))
+	{
+		status = AlxFs_Fatfs_DiskCache_Flush(me);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_TRACE_WRN("Err: %d", status);
+			return status;
+		}
+	}
+
+	// If not single sector from FAT area, read directly
+	if ((count != 1) || (sector >= me->fatfs.database))
+	{
+		return AlxFs_Fatfs_Mmc_Usb_ReadBlock(me, buff, sector, count);
+	}
+
+	// Search read cache, remember least recently used entry
+	uint32_t iLru = 0;
+	for (uint32_t i = 0; i < ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM; i++)
+	{
+		if (me->fatfsReadCacheValid[i] && (me->fatfsReadCacheSector[i] == sector))
+		{
+			memcpy(buff, me->fatfsReadCacheBuff[i], FF_MAX_SS);
+			me->fatfsReadCacheUsedCountLast++;
+			me->fatfsReadCacheUsedCount[i] = me->fatfsReadCacheUsedCountLast;
+			return Alx_Ok;
+		}
+		if (me->fatfsReadCacheValid[iLru] && ((me->fatfsReadCacheValid[i] == false) || (me->fatfsReadCacheUsedCount[i] < me->fatfsReadCacheUsedCount[iLru])))
+		{
+			iLru = i;
+		}
+	}
+
+	// Read
+	status = AlxFs_Fatfs_Mmc_Usb_ReadBlock(me, buff, sector, 1);
+	if (status != Alx_Ok)
+	{
+		ALX_FS_TRACE_WRN("Err: %d", status);
+		return status;
+	}
+
+	// Store to least recently used entry
+	memcpy(me->fatfsReadCacheBuff[iLru], buff, FF_MAX_SS);
+	me->fatfsReadCacheSector[iLru] = sector;
+	me->fatfsReadCacheUsedCountLast++;
+	me->fatfsReadCacheUsedCount[iLru] = me->fatfsReadCacheUsedCountLast;
+	me->fatfsReadCacheValid[iLru] = true;
+
+	// Return
+	return Alx_Ok;
+}
+static Alx_Status AlxFs_Fatfs_DiskCache_Write(AlxFs* me, const uint8_t* buff, LBA_t sector, uint32_t count)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	LBA_t writeCacheSectorEnd = me->fatfsWriteCacheSector + me->fatfsWriteCacheSectorCount;
+
+	// Update read cache entries, so they stay coherent with written data
+	for (uint32_t i = 0; i < ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM; i++)
+	{
+		if (me->fatfsReadCacheValid[i] && (me->fatfsReadCacheSector[i] >= sector) && (me->fatfsReadCacheSector[i] < sector + count))
+		{
+			memcpy(me->fatfsReadCacheBuff[i], buff + (me->fatfsReadCacheSector[i] - sector) * FF_MAX_SS, FF_MAX_SS);
+		}
+	}
+
+	// If sectors are already collected, overwrite them, e.g. repeated FAT sector writes
+	if ((me->fatfsWriteCacheSectorCount > 0) && (sector >= me->fatfsWriteCacheSector) && (sector + count <= writeCacheSectorEnd))
+	{
+		memcpy(me->fatfsWriteCacheBuff + (sector - me->fatfsWriteCacheSector) * FF_MAX_SS, buff, count * FF_MAX_SS);
+		return Alx_Ok;
+	}
+
+	// If sectors continue collected sectors and fit, append them
+	if ((me->fatfsWriteCacheSectorCount > 0) && (sector == writeCacheSectorEnd) && (me->fatfsWriteCacheSectorCount + count <= ALX_FS_FATFS_DISK_CACHE_WRITE_SECTOR_NUM))
+	{
+		memcpy(me->fatfsWriteCacheBuff + me->fatfsWriteCacheSectorCount * FF_MAX_SS, buff, count * FF_MAX_SS);
+		me->fatfsWriteCacheSectorCount = me->fatfsWriteCacheSectorCount + count;
+
+		// If full, flush
+		if (me->fatfsWriteCacheSectorCount == ALX_FS_FATFS_DISK_CACHE_WRITE_SECTOR_NUM)
+		{
+			return AlxFs_Fatfs_DiskCache_Flush(me);
+		}
+		return Alx_Ok;
+	}
+
+	// Flush collected sectors, they are not contiguous with new ones
+	status = AlxFs_Fatfs_DiskCache_Flush(me);
+	if (status != Alx_Ok)
+	{
+		ALX_FS_TRACE_WRN("Err: %d", status);
+		return status;
+	}
+
+	// If sectors don't fit, write directly, FatFs already passes them as single multi-block run
+	if (count >= ALX_FS_FATFS_DISK_CACHE_WRITE_SECTOR_NUM)
+	{
+		return AlxFs_Fatfs_Mmc_Usb_WriteBlock(me, buff, sector, count);
+	}
+
+	// Start collecting new contiguous sectors
+	memcpy(me->fatfsWriteCacheBuff, buff, count * FF_MAX_SS);
+	me->fatfsWriteCacheSector = sector;
+	me->fatfsWriteCacheSectorCount = count;
+
+	// Return
+	return Alx_Ok;
+}
+#endif
+
+
+//------------------------------------------------------------------------------
+// Fatfs Discard
+//------------------------------------------------------------------------------
+#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_DISCARD)
+static void AlxFs_Fatfs_Discard_Add(AlxFs* me, LBA_t sectorStart, LBA_t sectorEnd)
+{
+	// Local variables
+	uint32_t count = (uint32_t)(sectorEnd - sectorStart + 1);
+
+	// If adjacent to pending range, just extend it
+	if ((me->fatfsDiscardSectorCount > 0) && (sectorStart == me->fatfsDiscardSector + me->fatfsDiscardSectorCount))
+	{
+		me->fatfsDiscardSectorCount = me->fatfsDiscardSectorCount + count;
+		return;
+	}
+	if ((me->fatfsDiscardSectorCount > 0) && (sectorEnd + 1 == me->fatfsDiscardSector))
+	{
+		me->fatfsDiscardSector = sectorStart;
+		me->fatfsDiscardSectorCount = me->fatfsDiscardSectorCount + count;
+		return;
+	}
+
+	// Else flush pending range & start new one, flush error is already traced & ignored, discard is only a hint to device
+	AlxFs_Fatfs_Discard_Flush(me);
+	me->fatfsDiscardSector = sectorStart;
+	me->fatfsDiscardSectorCount = count;
+}
+static Alx_Status AlxFs_Fatfs_Discard_Flush(AlxFs* me)
+{
+	// If nothing to flush, return
+	if (me->fatfsDiscardSectorCount == 0)
+	{
+		return Alx_Ok;
+	}
+
+	// Discard
+	Alx_Status status = Alx_Err;
+	#if defined(ALX_FS_STATS)
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	#endif
+	if(me->do_DBG_EraseBlock != NULL) AlxIoPin_Set(me->do_DBG_EraseBlock);
+	#if defined(ALX_STM32L4) || defined(ALX_PC)
+	status = AlxMmc_EraseBlock(me->alxMmc, me->fatfsDiscardSectorCount, me->fatfsDiscardSector, 3, 100);
+	#endif
+	if(me->do_DBG_EraseBlock != NULL) AlxIoPin_Reset(me->do_DBG_EraseBlock);
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_BlockErase, me->fatfsDiscardSectorCount * FF_MIN_SS, AlxTimSw_Get_us(&alxTimSw_Stats));
+	#endif
+	if (status != Alx_Ok)
+	{
+		ALX_FS_TRACE_WRN("Err: %d, sector=%lu, count=%u", status, me->fatfsDiscardSector, me->fatfsDiscardSectorCount);
+	}
+
+	// Clear, also on error, discard is only a hint to device
+	me->fatfsDiscardSectorCount = 0;
+
+	// Return
+	return status;
+}
 #endif
 
 
@@ -1955,6 +3072,8 @@ static int AlxFs_Lfs_FlashInt_Lock(const struct lfs_config* c)
 	// Local variables
 	(void)c;
 
+	// Nothing to do, AlxFs already serializes volume access with its own mutex
+
 	// Return
 	return LFS_ERR_OK;
 }
@@ -1963,6 +3082,8 @@ static int AlxFs_Lfs_FlashInt_Unlock(const struct lfs_config* c)
 	// Local variables
 	(void)c;
 
+	// Nothing to do, AlxFs already serializes volume access with its own mutex
+
 	// Return
 	return LFS_ERR_OK;
 }
@@ -2060,6 +3181,8 @@ static int AlxFs_Lfs_Mmc_EraseBlock(const struct lfs_config* c, lfs_block_t bloc
 	AlxFs* me = (AlxFs*)c->context;
 	(void)block;
 
+	// Lfs calls erase right before block is programmed again, not when block is freed, so discard would not help MMC garbage collection, MMC handles rewrite itself
+
 	// Toggle
 	if(me->do_DBG_EraseBlock != NULL) AlxIoPin_Set(me->do_DBG_EraseBlock);
 	if(me->do_DBG_EraseBlock != NULL) AlxIoPin_Reset(me->do_DBG_EraseBlock);
@@ -2085,6 +3208,8 @@ static int AlxFs_Lfs_Mmc_Lock(const struct lfs_config* c)
 	// Local variables
 	(void)c;
 
+	// Nothing to do, AlxFs already serializes volume access with its own mutex
+
 	// Return
 	return LFS_ERR_OK;
 }
@@ -2093,6 +3218,8 @@ static int AlxFs_Lfs_Mmc_Unlock(const struct lfs_config* c)
 	// Local variables
 	(void)c;
 
+	// Nothing to do, AlxFs already serializes volume access with its own mutex
+
 	// Return
 	return LFS_ERR_OK;
 }
@@ -2100,6 +3227,49 @@ static int AlxFs_Lfs_Mmc_Unlock(const struct lfs_config* c)
 #endif
 
 
+//------------------------------------------------------------------------------
+// Lfs Stats
+//------------------------------------------------------------------------------
+#if defined(ALX_LFS) && defined(ALX_FS_STATS)
+static int AlxFs_Lfs_Stats_ReadBlock(const struct lfs_config* c, lfs_block_t block, lfs_off_t off, void* buffer, lfs_size_t size)
+{
+	AlxFs* me = (AlxFs*)c->context;
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	int status = me->lfsReadBlock(c, block, off, buffer, size);
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_BlockRead, size, AlxTimSw_Get_us(&alxTimSw_Stats));
+	return status;
+}
+static int AlxFs_Lfs_Stats_ProgBlock(const struct lfs_config* c, lfs_block_t block, lfs_off_t off, const void* buffer, lfs_size_t size)
+{
+	AlxFs* me = (AlxFs*)c->context;
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	int status = me->lfsProgBlock(c, block, off, buffer, size);
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_BlockWrite, size, AlxTimSw_Get_us(&alxTimSw_Stats));
+	return status;
+}
+static int AlxFs_Lfs_Stats_EraseBlock(const struct lfs_config* c, lfs_block_t block)
+{
+	AlxFs* me = (AlxFs*)c->context;
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	int status = me->lfsEraseBlock(c, block);
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_BlockErase, c->block_size, AlxTimSw_Get_us(&alxTimSw_Stats));
+	return status;
+}
+static int AlxFs_Lfs_Stats_SyncBlock(const struct lfs_config* c)
+{
+	AlxFs* me = (AlxFs*)c->context;
+	AlxTimSw alxTimSw_Stats;
+	AlxTimSw_Ctor(&alxTimSw_Stats, true);
+	int status = me->lfsSyncBlock(c);
+	AlxFs_Stats_Record(me, AlxFs_Stats_OpType_BlockSync, 0, AlxTimSw_Get_us(&alxTimSw_Stats));
+	return status;
+}
+#endif
+
+
 //------------------------------------------------------------------------------
 // Callback Functions
 //------------------------------------------------------------------------------
@@ -46,6 +46,9 @@ extern "C" {
 #include "alxMmc.h"
 #include "alxUsb.h"
 #include "alxOsMutex.h"
+#include "alxOsThread.h"
+#include "alxOsDelay.h"
+#include "alxTimSw.h"
 #if defined(ALX_LFS)
 #include "lfs.h"
 #endif
@@ -82,6 +85,53 @@ extern "C" {
 	#define ALX_FS_TRACE_FORMAT(...) do{} while (false)
 #endif
 
+// Defines
+#if defined(ALX_FATFS)
+	#ifndef ALX_FS_FATFS_MMC_SECTOR_COUNT
+		#define ALX_FS_FATFS_MMC_SECTOR_COUNT 62160896	// Number of 512 byte sectors reported to FatFs for AlxFs_Config_Fatfs_Mmc, 62160896 * 512 bytes = ~32GB
+	#endif
+#endif
+#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_FAST_SEEK)
+	#ifndef ALX_FS_FATFS_FAST_SEEK_CLMT_LEN
+		#define ALX_FS_FATFS_FAST_SEEK_CLMT_LEN 64	// Cluster link map table length in DWORDs, table can hold (ALX_FS_FATFS_FAST_SEEK_CLMT_LEN - 1) / 2 file fragments
+	#endif
+#endif
+#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_DISK_CACHE)
+	#ifndef ALX_FS_FATFS_DISK_CACHE_WRITE_SECTOR_NUM
+		#define ALX_FS_FATFS_DISK_CACHE_WRITE_SECTOR_NUM 8	// Number of contiguous sectors collected before they are written with single multi-block write
+	#endif
+	#ifndef ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM
+		#define ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM 4	// Number of cached sectors from FAT area (sectors before data area)
+	#endif
+#endif
+#if defined(ALX_FREE_RTOS)
+	#ifndef ALX_FS_READ_IN_CHUNKS_PIPELINED_THREAD_STACK_LEN_BYTE
+		#define ALX_FS_READ_IN_CHUNKS_PIPELINED_THREAD_STACK_LEN_BYTE 2048	// Stack length of reader thread used by AlxFs_File_ReadInChunks_Pipelined, thread is started on first call and then reused
+	#endif
+	#ifndef ALX_FS_READ_IN_CHUNKS_PIPELINED_THREAD_PRIORITY
+		#define ALX_FS_READ_IN_CHUNKS_PIPELINED_THREAD_PRIORITY 1	// Priority of reader thread used by AlxFs_File_ReadInChunks_Pipelined
+	#endif
+#endif
+#if defined(ALX_FS_STATS)
+	#ifndef ALX_FS_STATS_TIME_HIST_BIN_NUM
+		#define ALX_FS_STATS_TIME_HIST_BIN_NUM 10	// Bin i counts operations which took less than 4^(i+1) us, last bin counts all longer operations
+	#endif
+#endif
+#if defined(ALX_FREE_RTOS) && defined(ALX_FS_MAINTENANCE_THREAD)
+	#ifndef ALX_FS_MAINTENANCE_THREAD_STACK_LEN_BYTE
+		#define ALX_FS_MAINTENANCE_THREAD_STACK_LEN_BYTE 1024	// Stack length of maintenance thread
+	#endif
+	#ifndef ALX_FS_MAINTENANCE_THREAD_PRIORITY
+		#define ALX_FS_MAINTENANCE_THREAD_PRIORITY 0	// Priority of maintenance thread, by default idle priority so it runs only when nothing else is ready
+	#endif
+	#ifndef ALX_FS_MAINTENANCE_THREAD_PERIOD_MS
+		#define ALX_FS_MAINTENANCE_THREAD_PERIOD_MS 1000	// Delay between maintenance runs
+	#endif
+	#ifndef ALX_FS_MAINTENANCE_THREAD_TIME_BUDGET_MS
+		#define ALX_FS_MAINTENANCE_THREAD_TIME_BUDGET_MS 20	// Time budget of single maintenance run
+	#endif
+#endif
+
 
 //******************************************************************************
 // Types
@@ -111,6 +161,9 @@ typedef struct
 	#if defined(ALX_FATFS)
 	FIL fatfsFile;
 	#endif
+	#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_FAST_SEEK)
+	DWORD fatfsClmt[ALX_FS_FATFS_FAST_SEEK_CLMT_LEN];
+	#endif
 	#if defined(ALX_LFS)
 	lfs_file_t lfsFile;
 	#endif
@@ -139,6 +192,46 @@ typedef struct
 	bool dummy;
 } AlxFs_Info;
 
+typedef struct
+{
+	uint32_t numOfChunks;
+	uint64_t readTime_us;		// Total time spent reading chunks from storage
+	uint64_t callbackTime_us;	// Total time spent in chunkRead_Callback
+	uint64_t waitTime_us;		// Total time consumer waited for chunk to be read, storage time not hidden by pipelining
+	uint64_t totalTime_us;
+} AlxFs_File_ReadInChunks_Stats;
+
+#if defined(ALX_FS_STATS)
+typedef enum
+{
+	AlxFs_Stats_OpType_BlockRead,
+	AlxFs_Stats_OpType_BlockWrite,
+	AlxFs_Stats_OpType_BlockErase,
+	AlxFs_Stats_OpType_BlockSync,
+	AlxFs_Stats_OpType_FileOpen,
+	AlxFs_Stats_OpType_FileClose,
+	AlxFs_Stats_OpType_FileRead,
+	AlxFs_Stats_OpType_FileWrite,
+	AlxFs_Stats_OpType_FileSeek,
+	AlxFs_Stats_OpType_FileSync,
+	AlxFs_Stats_OpType_Num
+} AlxFs_Stats_OpType;
+
+typedef struct
+{
+	uint32_t count;
+	uint64_t len_byte;
+	uint64_t timeTotal_us;
+	uint32_t timeMax_us;
+	uint32_t timeHist[ALX_FS_STATS_TIME_HIST_BIN_NUM];
+} AlxFs_Stats_Op;
+
+typedef struct
+{
+	AlxFs_Stats_Op op[AlxFs_Stats_OpType_Num];
+} AlxFs_Stats;
+#endif
+
 typedef struct
 {
 	// Defines
@@ -163,11 +256,45 @@ typedef struct
 	MKFS_PARM fatfsMkfsOpt;
 	uint8_t fatfsMkfsBuff[ALX_FS_FATFS_MKFS_BUFF_LEN];
 	#endif
+	#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_DISK_CACHE)
+	uint8_t fatfsWriteCacheBuff[ALX_FS_FATFS_DISK_CACHE_WRITE_SECTOR_NUM * FF_MAX_SS] __attribute__((aligned(4)));
+	LBA_t fatfsWriteCacheSector;
+	uint32_t fatfsWriteCacheSectorCount;
+	uint8_t fatfsReadCacheBuff[ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM][FF_MAX_SS] __attribute__((aligned(4)));
+	LBA_t fatfsReadCacheSector[ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM];
+	uint32_t fatfsReadCacheUsedCount[ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM];
+	bool fatfsReadCacheValid[ALX_FS_FATFS_DISK_CACHE_READ_SECTOR_NUM];
+	uint32_t fatfsReadCacheUsedCountLast;
+	#endif
+	#if defined(ALX_FATFS) && defined(ALX_FS_FATFS_DISCARD)
+	LBA_t fatfsDiscardSector;
+	uint32_t fatfsDiscardSectorCount;
+	#endif
 	#if defined(ALX_LFS)
 	lfs_t lfs;
 	struct lfs_config lfsConfig;
 	uint32_t lfsAddr;
 	#endif
+	AlxOsMutex alxOsMutex;
+	#if defined(ALX_FS_STATS)
+	AlxFs_Stats stats;
+	#endif
+	#if defined(ALX_LFS) && defined(ALX_FS_STATS)
+	int (*lfsReadBlock)(const struct lfs_config* c, lfs_block_t block, lfs_off_t off, void* buffer, lfs_size_t size);
+	int (*lfsProgBlock)(const struct lfs_config* c, lfs_block_t block, lfs_off_t off, const void* buffer, lfs_size_t size);
+	int (*lfsEraseBlock)(const struct lfs_config* c, lfs_block_t block);
+	int (*lfsSyncBlock)(const struct lfs_config* c);
+	#endif
+	#if defined(ALX_FREE_RTOS) && defined(ALX_FS_MAINTENANCE_THREAD)
+	AlxOsThread alxOsThread_Maintenance;
+	#endif
+	#if defined(ALX_FREE_RTOS)
+	AlxOsThread alxOsThread_ReadInChunks;
+	AlxOsMutex alxOsMutex_ReadInChunks;	// Serializes pipelined reads, reader thread serves one pipeline at a time
+	AlxOsMutex readInChunksJobStart;
+	void* readInChunksPipe;
+	bool readInChunksIsThreadStarted;
+	#endif
 
 	// Info
 	bool wasCtorCalled;
@@ -212,13 +339,24 @@ Alx_Status AlxFs_File_Tell(AlxFs* me, AlxFs_File* file, uint32_t* position);
 Alx_Status AlxFs_File_Rewind(AlxFs* me, AlxFs_File* file);
 Alx_Status AlxFs_File_Size(AlxFs* me, AlxFs_File* file, uint32_t* size);
 Alx_Status AlxFs_File_Truncate(AlxFs* me, AlxFs_File* file, uint32_t size);
+Alx_Status AlxFs_File_Preallocate(AlxFs* me, AlxFs_File* file, uint32_t size, bool contiguous);
 Alx_Status AlxFs_File_ReadInChunks(AlxFs* me, const char* path, uint8_t* chunkBuff, uint32_t chunkLen, Alx_Status(*chunkRead_Callback)(void* ctx, void* chunkData, uint32_t chunkLenActual), void* chunkRead_Callback_Ctx, uint32_t* readLen, AlxOsMutex* alxOsMutex);
+Alx_Status AlxFs_File_ReadInChunks_Pipelined(AlxFs* me, const char* path, uint8_t* chunkBuffA, uint8_t* chunkBuffB, uint32_t chunkLen, Alx_Status(*chunkRead_Callback)(void* ctx, void* chunkData, uint32_t chunkLenActual), void* chunkRead_Callback_Ctx, uint32_t* readLen, AlxOsMutex* alxOsMutex, AlxFs_File_ReadInChunks_Stats* stats);
 Alx_Status AlxFs_File_Trace(AlxFs* me, const char* path, bool bin);
 Alx_Status AlxFs_Dir_Make(AlxFs* me, const char* path);
 Alx_Status AlxFs_Dir_Open(AlxFs* me, AlxFs_Dir* dir, const char* path);
 Alx_Status AlxFs_Dir_Close(AlxFs* me, AlxFs_Dir* dir);
 Alx_Status AlxFs_Dir_Read(AlxFs* me, AlxFs_Dir* dir, AlxFs_Info* info);
 Alx_Status AlxFs_Dir_Trace(AlxFs* me, const char* path, bool fileTrace, bool fileBin);
+Alx_Status AlxFs_Maintenance(AlxFs* me, uint32_t timeBudget_ms);
+#if defined(ALX_FS_STATS)
+void AlxFs_Stats_Get(AlxFs* me, AlxFs_Stats* stats);
+void AlxFs_Stats_Reset(AlxFs* me);
+const char* AlxFs_Stats_GetOpTypeStr(AlxFs_Stats_OpType opType);
+#endif
+#if defined(ALX_FREE_RTOS) && defined(ALX_FS_MAINTENANCE_THREAD)
+Alx_Status AlxFs_Maintenance_Thread_Start(AlxFs* me);
+#endif
 
 
 #endif	// #if defined(ALX_C_LIB)
@@ -37,12 +37,30 @@
 #if defined(ALX_C_LIB)
 
 
+//******************************************************************************
+// Private Types
+//******************************************************************************
+typedef struct
+{
+	AlxFs* alxFs;
+	AlxFs_File* file;
+	const char* path;
+} AlxFsSafe_File_ReadRawStream_Ctx;
+
+
 //******************************************************************************
 // Private Functions
 //******************************************************************************
 Alx_Status AlxFsSafe_File_ReadRaw(AlxFsSafe* me, const char* path, void* data, uint32_t len);
-Alx_Status AlxFsSafe_File_ReadCopy(AlxFsSafe* me, bool isA, const char* path, void* data, uint32_t len, uint32_t* validatedCrc);
-Alx_Status AlxFsSafe_File_WriteCopy(AlxFsSafe* me, bool isA, const char* path, void* data, uint32_t len, uint8_t* buff);
+Alx_Status AlxFsSafe_File_ReadCopy(AlxFsSafe* me, bool isA, const char* path, void* data, uint32_t len, uint32_t* validatedCrc, uint32_t* gen);
+Alx_Status AlxFsSafe_File_ReadCopyGen(AlxFsSafe* me, bool isA, const char* path, uint32_t len, uint32_t* gen);
+Alx_Status AlxFsSafe_File_WriteCopy(AlxFsSafe* me, bool isA, const char* path, void* data, uint32_t len, uint8_t* buff, uint32_t gen);
+uint32_t AlxFsSafe_File_GenNext(AlxFsSafe* me, const char* path, uint32_t len);
+Alx_Status AlxFsSafe_File_CheckRawLen(AlxFsSafe* me, const char* path, uint32_t len);
+Alx_Status AlxFsSafe_File_ReadRawStream_ChunkWrite_Callback(void* ctx, uint32_t offset, void* chunkData, uint32_t chunkLen);
+Alx_Status AlxFsSafe_File_CheckCopyStream(AlxFsSafe* me, bool isA, const char* path, uint32_t len, uint32_t* validatedCrc, uint32_t* gen, Alx_Status(*chunkRead_Callback)(void* ctx, void* chunkData, uint32_t chunkLenActual), void* chunkRead_Callback_Ctx);
+Alx_Status AlxFsSafe_File_WriteCopyStream(AlxFsSafe* me, bool isA, const char* path, uint32_t len, Alx_Status(*chunkWrite_Callback)(void* ctx, uint32_t offset, void* chunkData, uint32_t chunkLen), void* chunkWrite_Callback_Ctx, uint32_t gen);
+Alx_Status AlxFsSafe_File_RepairCopyStream(AlxFsSafe* me, bool isA, const char* path, uint32_t len);
 void AlxFsSafe_PathToPathWithSuffix(bool isA, const char* path, const char* pathWithSuffix);
 
 
@@ -71,6 +89,11 @@ void AlxFsSafe_Ctor
 	// Variables
 	AlxCrc_Ctor(&me->alxCrc, AlxCrc_Config_Ccitt);
 	me->alxCrcLen = AlxCrc_GetLen(&me->alxCrc);
+	#if defined(ALX_FS_SAFE_GEN)
+	me->genLen = sizeof(uint32_t);
+	#else
+	me->genLen = 0;
+	#endif
 
 	// Info
 	me->wasCtorCalled = true;
@@ -87,7 +110,7 @@ Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint
 	//------------------------------------------------------------------------------
 	ALX_FS_SAFE_ASSERT(me->wasCtorCalled == true);
 	ALX_FS_SAFE_ASSERT(strlen(path) <= ALX_FS_SAFE_PATH_LEN_MAX);
-	ALX_FS_SAFE_ASSERT(len <= me->buffLen - me->alxCrcLen);
+	ALX_FS_SAFE_ASSERT(len <= me->buffLen - me->genLen - me->alxCrcLen);
 
 
 	//------------------------------------------------------------------------------
@@ -99,11 +122,47 @@ Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint
 	bool validB = false;
 	uint32_t crcA = 0;
 	uint32_t crcB = 0;
+	uint32_t genA = 0;
+	uint32_t genB = 0;
+	bool wasReadA = false;
 	memset(me->buffOrig, 0, me->buffLen);
 	memset(me->buffA, 0, me->buffLen);
 	memset(me->buffB, 0, me->buffLen);
 
 
+	//------------------------------------------------------------------------------
+	// Fast Path
+	//------------------------------------------------------------------------------
+	#if defined(ALX_FS_SAFE_GEN)
+	{
+		// CopyA is always written first, so if CopyA is valid it holds the newest data.
+		// If CopyB has the same generation, CopyB is in sync and we can skip reading & validating CopyB and Original.
+		// If anything fails, we fall back to full reconciliation below, which reuses CopyA read here.
+		status = AlxFsSafe_File_ReadCopy(me, true, path, me->buffA, len, &crcA, &genA);
+		wasReadA = true;
+		if (status == Alx_Ok)
+		{
+			validA = true;
+			status = AlxFsSafe_File_ReadCopyGen(me, false, path, len, &genB);
+			if (status == Alx_Ok && genA == genB)
+			{
+				// Trace
+				ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_Read - DONE: FastPath() 'CopyA OK & Generation Same -> Use CopyA'");
+
+				// Use CopyA
+				memcpy(data, me->buffA, len);
+
+				// Return
+				return AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA;
+			}
+		}
+
+		// Prepare for full reconciliation
+		genB = 0;
+	}
+	#endif
+
+
 	//------------------------------------------------------------------------------
 	// Read
 	//------------------------------------------------------------------------------
@@ -126,19 +185,22 @@ Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint
 		validOrig = false;
 	}
 
-	// Copy A
-	status = AlxFsSafe_File_ReadCopy(me, true, path, me->buffA, len, &crcA);
-	if (status == Alx_Ok)
-	{
-		validA = true;
-	}
-	else
+	// Copy A, if NOT already read by fast path
+	if (wasReadA == false)
 	{
-		validA = false;
+		status = AlxFsSafe_File_ReadCopy(me, true, path, me->buffA, len, &crcA, &genA);
+		if (status == Alx_Ok)
+		{
+			validA = true;
+		}
+		else
+		{
+			validA = false;
+		}
 	}
 
 	// Copy B
-	status = AlxFsSafe_File_ReadCopy(me, false, path, me->buffB, len, &crcB);
+	status = AlxFsSafe_File_ReadCopy(me, false, path, me->buffB, len, &crcB, &genB);
 	if (status == Alx_Ok)
 	{
 		validB = true;
@@ -166,7 +228,7 @@ Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint
 		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_Read - DONE: CheckValidity() 'Both Copy ERR and Original OK -> Use Original and update CopyA & CopyB with Original'");
 
 		// Update CopyA with Original
-		status = AlxFsSafe_File_WriteCopy(me, true, path, me->buffOrig, len, me->buffA);
+		status = AlxFsSafe_File_WriteCopy(me, true, path, me->buffOrig, len, me->buffA, 0);
 		if (status != Alx_Ok)
 		{
 			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopy(A) status %d", status);
@@ -174,7 +236,7 @@ Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint
 		}
 
 		// Update CopyB with Original
-		status = AlxFsSafe_File_WriteCopy(me, false, path, me->buffOrig, len, me->buffB);
+		status = AlxFsSafe_File_WriteCopy(me, false, path, me->buffOrig, len, me->buffB, 0);
 		if (status != Alx_Ok)
 		{
 			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopy(B) status %d", status);
@@ -204,7 +266,7 @@ Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint
 		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_Read - DONE: CheckValidity() 'Both Copy OK & CRC Different and Original Don't Care -> Use CopyA and update CopyB with CopyA'");
 
 		// Update CopyB with CopyA
-		status = AlxFsSafe_File_WriteCopy(me, false, path, me->buffA, len, me->buffB);
+		status = AlxFsSafe_File_WriteCopy(me, false, path, me->buffA, len, me->buffB, genA);
 		if (status != Alx_Ok)
 		{
 			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopy(B) status %d", status);
@@ -223,7 +285,7 @@ Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint
 		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_Read - DONE: CheckValidity() 'CopyA OK, CopyB ERR and Original Don't Care -> Use CopyA and update CopyB with CopyA'");
 
 		// Update CopyB with CopyA
-		status = AlxFsSafe_File_WriteCopy(me, false, path, me->buffA, len, me->buffB);
+		status = AlxFsSafe_File_WriteCopy(me, false, path, me->buffA, len, me->buffB, genA);
 		if (status != Alx_Ok)
 		{
 			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopy(B) status %d", status);
@@ -242,7 +304,7 @@ Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint
 		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_Read - DONE: CheckValidity() 'CopyA ERR, CopyB OK and Original Don't Care -> Use CopyB and update CopyA with CopyB'");
 
 		// Update CopyA with CopyB
-		status = AlxFsSafe_File_WriteCopy(me, true, path, me->buffB, len, me->buffA);
+		status = AlxFsSafe_File_WriteCopy(me, true, path, me->buffB, len, me->buffA, genB);
 		if (status != Alx_Ok)
 		{
 			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopy(A) status %d", status);
@@ -274,13 +336,14 @@ Alx_Status AlxFsSafe_File_Write(AlxFsSafe* me, const char* path, void* data, uin
 	//------------------------------------------------------------------------------
 	ALX_FS_SAFE_ASSERT(me->wasCtorCalled == true);
 	ALX_FS_SAFE_ASSERT(strlen(path) <= ALX_FS_SAFE_PATH_LEN_MAX);
-	ALX_FS_SAFE_ASSERT(len <= me->buffLen - me->alxCrcLen);
+	ALX_FS_SAFE_ASSERT(len <= me->buffLen - me->genLen - me->alxCrcLen);
 
 
 	//------------------------------------------------------------------------------
 	// Local Variables
 	//------------------------------------------------------------------------------
 	Alx_Status status = Alx_Err;
+	uint32_t gen = AlxFsSafe_File_GenNext(me, path, len);
 	memset(me->buffA, 0, me->buffLen);
 	memset(me->buffB, 0, me->buffLen);
 
@@ -290,7 +353,7 @@ Alx_Status AlxFsSafe_File_Write(AlxFsSafe* me, const char* path, void* data, uin
 	//------------------------------------------------------------------------------
 
 	// Copy A
-	status = AlxFsSafe_File_WriteCopy(me, true, path, data, len, me->buffA);
+	status = AlxFsSafe_File_WriteCopy(me, true, path, data, len, me->buffA, gen);
 	if (status != Alx_Ok)
 	{
 		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopy(A) status %d", status);
@@ -298,7 +361,7 @@ Alx_Status AlxFsSafe_File_Write(AlxFsSafe* me, const char* path, void* data, uin
 	}
 
 	// Copy B
-	status = AlxFsSafe_File_WriteCopy(me, false, path, data, len, me->buffB);
+	status = AlxFsSafe_File_WriteCopy(me, false, path, data, len, me->buffB, gen);
 	if (status != Alx_Ok)
 	{
 		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopy(B) status %d", status);
@@ -306,6 +369,290 @@ Alx_Status AlxFsSafe_File_Write(AlxFsSafe* me, const char* path, void* data, uin
 	}
 
 
+	//------------------------------------------------------------------------------
+	// Return
+	//------------------------------------------------------------------------------
+	return Alx_Ok;
+}
+Alx_Status AlxFsSafe_File_ReadStream(AlxFsSafe* me, const char* path, uint32_t len, Alx_Status(*chunkRead_Callback)(void* ctx, void* chunkData, uint32_t chunkLenActual), void* chunkRead_Callback_Ctx)
+{
+	//------------------------------------------------------------------------------
+	// Assert
+	//------------------------------------------------------------------------------
+	ALX_FS_SAFE_ASSERT(me->wasCtorCalled == true);
+	ALX_FS_SAFE_ASSERT(strlen(path) <= ALX_FS_SAFE_PATH_LEN_MAX);
+	ALX_FS_SAFE_ASSERT(me->buffLen > 0);
+	ALX_FS_SAFE_ASSERT(chunkRead_Callback != NULL);
+
+
+	//------------------------------------------------------------------------------
+	// Local Variables
+	//------------------------------------------------------------------------------
+	Alx_Status status = Alx_Err;
+	bool validOrig = false;
+	bool validA = false;
+	bool validB = false;
+	uint32_t crcA = 0;
+	uint32_t crcB = 0;
+	uint32_t genA = 0;
+	uint32_t genB = 0;
+	bool isFastPathErr = false;
+
+
+	//------------------------------------------------------------------------------
+	// Fast Path
+	//------------------------------------------------------------------------------
+	#if defined(ALX_FS_SAFE_GEN)
+	{
+		// Same as AlxFsSafe_File_Read, if CopyA & CopyB have the same generation, only CopyA is validated
+		// CopyA is read only once, chunks are passed to callback while running CRC is calculated
+		status = AlxFsSafe_File_ReadCopyGen(me, true, path, len, &genA);
+		if (status == Alx_Ok)
+		{
+			status = AlxFsSafe_File_ReadCopyGen(me, false, path, len, &genB);
+		}
+		if (status == Alx_Ok && genA == genB)
+		{
+			status = AlxFsSafe_File_CheckCopyStream(me, true, path, len, &crcA, &genA, chunkRead_Callback, chunkRead_Callback_Ctx);
+			if (status == Alx_Ok)
+			{
+				// Trace
+				ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_ReadStream - DONE: FastPath() 'CopyA OK & Generation Same -> Use CopyA'");
+
+				// Return
+				return AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA;
+			}
+
+			// CopyA invalid, chunks already passed to callback are invalid, so copies are only repaired below & error is returned
+			isFastPathErr = true;
+		}
+
+		// Prepare for full reconciliation
+		crcA = 0;
+		genA = 0;
+		genB = 0;
+	}
+	#endif
+
+
+	//------------------------------------------------------------------------------
+	// Check
+	//------------------------------------------------------------------------------
+
+	// Original
+	if (me->useOrig)
+	{
+		status = AlxFsSafe_File_CheckRawLen(me, path, len);
+		validOrig = (status == Alx_Ok);
+	}
+	else
+	{
+		validOrig = false;
+	}
+
+	// Copy A
+	status = AlxFsSafe_File_CheckCopyStream(me, true, path, len, &crcA, &genA, NULL, NULL);
+	validA = (status == Alx_Ok);
+
+	// Copy B
+	status = AlxFsSafe_File_CheckCopyStream(me, false, path, len, &crcB, &genB, NULL, NULL);
+	validB = (status == Alx_Ok);
+
+
+	//------------------------------------------------------------------------------
+	// Check Validity
+	//------------------------------------------------------------------------------
+	bool isUseA = true;
+	if (validOrig == false && validA == false && validB == false)	// Both Copy ERR and Original ERR -> Return ERR
+	{
+		// Trace
+		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_ReadStream - DONE: CheckValidity() 'Both Copy ERR and Original ERR -> Return ERR'");
+
+		// Return
+		return AlxSafe_BothCopyErr_OrigErr;
+	}
+	else if (validOrig == true && validA == false && validB == false)	// Both Copy ERR and Original OK -> Use Original and update CopyA & CopyB with Original
+	{
+		// Trace
+		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_ReadStream - DONE: CheckValidity() 'Both Copy ERR and Original OK -> Use Original and update CopyA & CopyB with Original'");
+
+		// Update CopyA with Original
+		AlxFs_File file = {};
+		AlxFsSafe_File_ReadRawStream_Ctx ctx = { .alxFs = me->alxFs, .file = &file, .path = path };
+		status = AlxFs_File_Open(me->alxFs, &file, path, "r");
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Open(%s) status %d", path, status);
+			return status;
+		}
+		status = AlxFsSafe_File_WriteCopyStream(me, true, path, len, AlxFsSafe_File_ReadRawStream_ChunkWrite_Callback, &ctx, 0);
+		Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &file);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopyStream(A) status %d", status);
+			return status;
+		}
+		if (statusClose != Alx_Ok)	// Original was read completely & CopyA is verified, but close error is still reported
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", path, statusClose);
+			return statusClose;
+		}
+
+		// Update CopyB with CopyA
+		status = AlxFsSafe_File_RepairCopyStream(me, false, path, len);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_RepairCopyStream(B) status %d", status);
+			return status;
+		}
+
+		// Use Original, CopyA now holds Original & is read, so CRC is checked
+		isUseA = true;
+
+		// Status
+		status = AlxSafe_BothCopyErr_OrigOk_UseOrig;
+	}
+	else if (validA && validB && crcA == crcB)	// Both Copy OK & CRC Same and Original Don't Care -> Use CopyA
+	{
+		// Trace
+		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_ReadStream - DONE: CheckValidity() 'Both Copy OK & CRC Same and Original Don't Care -> Use CopyA'");
+
+		// Use CopyA
+		isUseA = true;
+
+		// Status
+		status = AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA;
+	}
+	else if (validA && validB && crcA != crcB)	// Both Copy OK & CRC Different and Original Don't Care -> Use CopyA and update CopyB with CopyA, CopyA is used because we always write CopyA first and update
+	{
+		// Trace
+		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_ReadStream - DONE: CheckValidity() 'Both Copy OK & CRC Different and Original Don't Care -> Use CopyA and update CopyB with CopyA'");
+
+		// Update CopyB with CopyA
+		status = AlxFsSafe_File_RepairCopyStream(me, false, path, len);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_RepairCopyStream(B) status %d", status);
+			return status;
+		}
+
+		// Use CopyA
+		isUseA = true;
+
+		// Status
+		status = AlxSafe_BothCopyOkCrcDiff_OrigDontCare_UseCopyA;
+	}
+	else if (validA && validB == false)	// CopyA OK, CopyB ERR and Original Don't Care -> Use CopyA and update CopyB with CopyA
+	{
+		// Trace
+		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_ReadStream - DONE: CheckValidity() 'CopyA OK, CopyB ERR and Original Don't Care -> Use CopyA and update CopyB with CopyA'");
+
+		// Update CopyB with CopyA
+		status = AlxFsSafe_File_RepairCopyStream(me, false, path, len);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_RepairCopyStream(B) status %d", status);
+			return status;
+		}
+
+		// Use CopyA
+		isUseA = true;
+
+		// Status
+		status = AlxSafe_CopyAOkCopyBErr_OrigDontCare_UseCopyA;
+	}
+	else if (validA == false && validB)	// CopyA ERR, CopyB OK and Original Don't Care -> Use CopyB and update CopyA with CopyB
+	{
+		// Trace
+		ALX_FS_SAFE_TRACE_INF("AlxFsSafe_File_ReadStream - DONE: CheckValidity() 'CopyA ERR, CopyB OK and Original Don't Care -> Use CopyB and update CopyA with CopyB'");
+
+		// Update CopyA with CopyB
+		status = AlxFsSafe_File_RepairCopyStream(me, true, path, len);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_RepairCopyStream(A) status %d", status);
+			return status;
+		}
+
+		// Use CopyB
+		isUseA = false;
+
+		// Status
+		status = AlxSafe_CopyAErrCopyBOk_OrigDontCare_UseCopyB;
+	}
+	else
+	{
+		ALX_FS_SAFE_ASSERT(false);	// We should never get here
+		return Alx_Err;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Read
+	//------------------------------------------------------------------------------
+
+	// If fast path passed chunks of invalid CopyA to callback, copies are repaired now, but data must be read again by caller
+	if (isFastPathErr)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: FastPath() CopyA invalid after chunks were passed to callback, copies repaired");
+		return Alx_Err;
+	}
+
+	// Read used copy & pass chunks to callback, CRC is checked again, so data changed after check is not accepted
+	uint32_t crcUse = 0;
+	uint32_t genUse = 0;
+	Alx_Status statusRead = AlxFsSafe_File_CheckCopyStream(me, isUseA, path, len, &crcUse, &genUse, chunkRead_Callback, chunkRead_Callback_Ctx);
+	if (statusRead != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_CheckCopyStream(%s) status %d", isUseA ? "A" : "B", statusRead);
+		return statusRead;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Return
+	//------------------------------------------------------------------------------
+	return status;
+}
+Alx_Status AlxFsSafe_File_WriteStream(AlxFsSafe* me, const char* path, uint32_t len, Alx_Status(*chunkWrite_Callback)(void* ctx, uint32_t offset, void* chunkData, uint32_t chunkLen), void* chunkWrite_Callback_Ctx)
+{
+	//------------------------------------------------------------------------------
+	// Assert
+	//------------------------------------------------------------------------------
+	ALX_FS_SAFE_ASSERT(me->wasCtorCalled == true);
+	ALX_FS_SAFE_ASSERT(strlen(path) <= ALX_FS_SAFE_PATH_LEN_MAX);
+	ALX_FS_SAFE_ASSERT(me->buffLen > 0);
+	ALX_FS_SAFE_ASSERT(chunkWrite_Callback != NULL);
+
+
+	//------------------------------------------------------------------------------
+	// Local Variables
+	//------------------------------------------------------------------------------
+	Alx_Status status = Alx_Err;
+	uint32_t gen = AlxFsSafe_File_GenNext(me, path, len);
+
+
+	//------------------------------------------------------------------------------
+	// Write
+	//------------------------------------------------------------------------------
+
+	// Copy A - Written from callback & verified
+	status = AlxFsSafe_File_WriteCopyStream(me, true, path, len, chunkWrite_Callback, chunkWrite_Callback_Ctx, gen);
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_WriteCopyStream(A) status %d", status);
+		return status;
+	}
+
+	// Copy B - Copied from CopyA & verified, so callback is called only once per chunk
+	status = AlxFsSafe_File_RepairCopyStream(me, false, path, len);
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_RepairCopyStream(B) status %d", status);
+		return status;
+	}
+
+
 	//------------------------------------------------------------------------------
 	// Return
 	//------------------------------------------------------------------------------
@@ -374,7 +721,7 @@ Alx_Status AlxFsSafe_File_ReadRaw(AlxFsSafe* me, const char* path, void* data, u
 	//------------------------------------------------------------------------------
 	return Alx_Ok;
 }
-Alx_Status AlxFsSafe_File_ReadCopy(AlxFsSafe* me, bool isA, const char* path, void* data, uint32_t len, uint32_t* validatedCrc)
+Alx_Status AlxFsSafe_File_ReadCopy(AlxFsSafe* me, bool isA, const char* path, void* data, uint32_t len, uint32_t* validatedCrc, uint32_t* gen)
 {
 	//------------------------------------------------------------------------------
 	// Prepare
@@ -385,7 +732,7 @@ Alx_Status AlxFsSafe_File_ReadCopy(AlxFsSafe* me, bool isA, const char* path, vo
 	AlxFsSafe_PathToPathWithSuffix(isA, path, pathWithSuffix);
 
 	// Length
-	uint32_t lenWithCrc = len + me->alxCrcLen;
+	uint32_t lenWithCrc = len + me->genLen + me->alxCrcLen;
 
 
 	//------------------------------------------------------------------------------
@@ -410,65 +757,148 @@ Alx_Status AlxFsSafe_File_ReadCopy(AlxFsSafe* me, bool isA, const char* path, vo
 	}
 
 
+	//------------------------------------------------------------------------------
+	// Get Generation
+	//------------------------------------------------------------------------------
+	memcpy(gen, &((uint8_t*)data)[len], me->genLen);
+
+
 	//------------------------------------------------------------------------------
 	// Return
 	//------------------------------------------------------------------------------
 	return Alx_Ok;
 }
-Alx_Status AlxFsSafe_File_WriteCopy(AlxFsSafe* me, bool isA, const char* path, void* data, uint32_t len, uint8_t* buff)
+Alx_Status AlxFsSafe_File_ReadCopyGen(AlxFsSafe* me, bool isA, const char* path, uint32_t len, uint32_t* gen)
 {
 	//------------------------------------------------------------------------------
 	// Prepare
 	//------------------------------------------------------------------------------
 
 	// Path with Suffix
-	char pathWithSuffix[ALX_FS_SAFE_PATH_LEN_MAX + 2 + 1] = "";	// path + suffix + termination
+	char pathWithSuffix[ALX_FS_SAFE_PATH_LEN_MAX + 1 + 1] = "";	// path + suffix + termination
 	AlxFsSafe_PathToPathWithSuffix(isA, path, pathWithSuffix);
 
-	// CRC
-	uint16_t crc = AlxCrc_Calc(&me->alxCrc, data, len);
-
-	// Data
-	memcpy(buff, data, len);
-	memcpy(&buff[len], &crc, me->alxCrcLen);
-
 	// Length
-	uint32_t lenWithCrc = len + me->alxCrcLen;
+	uint32_t lenWithCrc = len + me->genLen + me->alxCrcLen;
 
 
 	//------------------------------------------------------------------------------
-	// Write
+	// Read
 	//------------------------------------------------------------------------------
 
 	// Local variables
 	Alx_Status status = Alx_Err;
+	Alx_Status statusClose = Alx_Err;
 	AlxFs_File file = {};
+	uint32_t size = 0;
+	uint32_t positionNew = 0;
+	uint32_t lenActual = 0;
 
 	// Open
-	status = AlxFs_File_Open(me->alxFs, &file, pathWithSuffix, "w");
+	status = AlxFs_File_Open(me->alxFs, &file, pathWithSuffix, "r");
 	if (status != Alx_Ok)
 	{
 		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Open(%s) status %d", pathWithSuffix, status);
 		return status;
 	}
 
-	// Write
-	status = AlxFs_File_Write(me->alxFs, &file, buff, lenWithCrc);
-	if (status != Alx_Ok)
+	// Check size, only generation is read, data & CRC are NOT validated
+	status = AlxFs_File_Size(me->alxFs, &file, &size);
+	if (status == Alx_Ok && size != lenWithCrc)
 	{
-		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Write(%s) status %d lenWithCrc %u", pathWithSuffix, status, lenWithCrc);
-		Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &file);
-		if (statusClose != Alx_Ok)
+		ALX_FS_SAFE_TRACE_ERR("FAIL: CheckSize(%s) size %lu lenWithCrc %lu", pathWithSuffix, size, lenWithCrc);
+		status = Alx_Err;
+	}
+
+	// Seek to generation
+	if (status == Alx_Ok)
+	{
+		status = AlxFs_File_Seek(me->alxFs, &file, (int32_t)len, AlxFs_File_Seek_Origin_Set, &positionNew);
+	}
+
+	// Read generation
+	if (status == Alx_Ok)
+	{
+		status = AlxFs_File_Read(me->alxFs, &file, gen, me->genLen, &lenActual);
+		if (status == Alx_Ok && lenActual != me->genLen)
 		{
-			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", pathWithSuffix, statusClose);
-			// TV: TODO - Handle close error
+			ALX_FS_SAFE_TRACE_ERR("FAIL: CheckLen(%s) lenActual %lu genLen %lu", pathWithSuffix, lenActual, me->genLen);
+			status = Alx_Err;
 		}
-		return status;
 	}
 
-	// Close
-	status = AlxFs_File_Close(me->alxFs, &file);
-	if (status != Alx_Ok)
+	// Close, error before close has precedence
+	statusClose = AlxFs_File_Close(me->alxFs, &file);
+	if (statusClose != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", pathWithSuffix, statusClose);
+		if (status == Alx_Ok)
+		{
+			status = statusClose;
+		}
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Return
+	//------------------------------------------------------------------------------
+	return status;
+}
+Alx_Status AlxFsSafe_File_WriteCopy(AlxFsSafe* me, bool isA, const char* path, void* data, uint32_t len, uint8_t* buff, uint32_t gen)
+{
+	//------------------------------------------------------------------------------
+	// Prepare
+	//------------------------------------------------------------------------------
+
+	// Path with Suffix
+	char pathWithSuffix[ALX_FS_SAFE_PATH_LEN_MAX + 2 + 1] = "";	// path + suffix + termination
+	AlxFsSafe_PathToPathWithSuffix(isA, path, pathWithSuffix);
+
+	// Data & Generation
+	memcpy(buff, data, len);
+	memcpy(&buff[len], &gen, me->genLen);
+
+	// CRC
+	uint16_t crc = AlxCrc_Calc(&me->alxCrc, buff, len + me->genLen);
+	memcpy(&buff[len + me->genLen], &crc, me->alxCrcLen);
+
+	// Length
+	uint32_t lenWithCrc = len + me->genLen + me->alxCrcLen;
+
+
+	//------------------------------------------------------------------------------
+	// Write
+	//------------------------------------------------------------------------------
+
+	// Local variables
+	Alx_Status status = Alx_Err;
+	AlxFs_File file = {};
+
+	// Open
+	status = AlxFs_File_Open(me->alxFs, &file, pathWithSuffix, "w");
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Open(%s) status %d", pathWithSuffix, status);
+		return status;
+	}
+
+	// Write
+	status = AlxFs_File_Write(me->alxFs, &file, buff, lenWithCrc);
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Write(%s) status %d lenWithCrc %u", pathWithSuffix, status, lenWithCrc);
+		Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &file);
+		if (statusClose != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", pathWithSuffix, statusClose);
+			// TV: TODO - Handle close error
+		}
+		return status;
+	}
+
+	// Close
+	status = AlxFs_File_Close(me->alxFs, &file);
+	if (status != Alx_Ok)
 	{
 		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", pathWithSuffix, status);
 		// TV: TODO - Handle close error
@@ -476,6 +906,416 @@ Alx_Status AlxFsSafe_File_WriteCopy(AlxFsSafe* me, bool isA, const char* path, v
 	}
 
 
+	//------------------------------------------------------------------------------
+	// Return
+	//------------------------------------------------------------------------------
+	return Alx_Ok;
+}
+uint32_t AlxFsSafe_File_GenNext(AlxFsSafe* me, const char* path, uint32_t len)
+{
+	// Local variables
+	uint32_t gen = 0;
+
+	#if defined(ALX_FS_SAFE_GEN)
+	{
+		// New generation must differ from the one currently in CopyB, so that an interrupted write (CopyA written, CopyB not) is never seen as in sync by fast path
+		uint32_t genA = 0;
+		uint32_t genB = 0;
+		Alx_Status status = AlxFsSafe_File_ReadCopyGen(me, true, path, len, &genA);
+		if (status == Alx_Ok)
+		{
+			gen = genA + 1;
+		}
+		status = AlxFsSafe_File_ReadCopyGen(me, false, path, len, &genB);
+		if (status == Alx_Ok && gen == genB)
+		{
+			gen++;
+		}
+	}
+	#else
+	{
+		(void)me;
+		(void)path;
+		(void)len;
+	}
+	#endif
+
+	// Return
+	return gen;
+}
+Alx_Status AlxFsSafe_File_CheckRawLen(AlxFsSafe* me, const char* path, uint32_t len)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	AlxFs_File file = {};
+	uint32_t size = 0;
+
+	// Open
+	status = AlxFs_File_Open(me->alxFs, &file, path, "r");
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Open(%s) status %d", path, status);
+		return status;
+	}
+
+	// Size
+	status = AlxFs_File_Size(me->alxFs, &file, &size);
+	if (status == Alx_Ok && size != len)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: CheckSize(%s) size %lu len %lu", path, size, len);
+		status = Alx_Err;
+	}
+
+	// Close, error before close has precedence
+	Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &file);
+	if (statusClose != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", path, statusClose);
+		if (status == Alx_Ok)
+		{
+			status = statusClose;
+		}
+	}
+
+	// Return
+	return status;
+}
+Alx_Status AlxFsSafe_File_ReadRawStream_ChunkWrite_Callback(void* ctx, uint32_t offset, void* chunkData, uint32_t chunkLen)
+{
+	// Local variables
+	(void)offset;	// Chunks are requested sequentially
+	AlxFsSafe_File_ReadRawStream_Ctx* rawCtx = (AlxFsSafe_File_ReadRawStream_Ctx*)ctx;
+	uint32_t lenActual = 0;
+
+	// Read
+	Alx_Status status = AlxFs_File_Read(rawCtx->alxFs, rawCtx->file, chunkData, chunkLen, &lenActual);
+	if (status != Alx_Ok || lenActual != chunkLen)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Read(%s) status %d chunkLen %lu lenActual %lu", rawCtx->path, status, chunkLen, lenActual);
+		return Alx_Err;
+	}
+
+	// Return
+	return Alx_Ok;
+}
+Alx_Status AlxFsSafe_File_CheckCopyStream(AlxFsSafe* me, bool isA, const char* path, uint32_t len, uint32_t* validatedCrc, uint32_t* gen, Alx_Status(*chunkRead_Callback)(void* ctx, void* chunkData, uint32_t chunkLenActual), void* chunkRead_Callback_Ctx)
+{
+	//------------------------------------------------------------------------------
+	// If chunkRead_Callback is not NULL, data chunks are also passed to it while CRC is calculated
+	// Passed chunks are valid only if Alx_Ok is returned
+	//------------------------------------------------------------------------------
+
+	//------------------------------------------------------------------------------
+	// Prepare
+	//------------------------------------------------------------------------------
+
+	// Path with Suffix
+	char pathWithSuffix[ALX_FS_SAFE_PATH_LEN_MAX + 1 + 1] = "";	// path + suffix + termination
+	AlxFsSafe_PathToPathWithSuffix(isA, path, pathWithSuffix);
+
+	// Length
+	uint32_t lenTrailer = me->genLen + me->alxCrcLen;
+	uint32_t lenWithCrc = len + lenTrailer;
+
+
+	//------------------------------------------------------------------------------
+	// Read
+	//------------------------------------------------------------------------------
+
+	// Local variables
+	Alx_Status status = Alx_Err;
+	AlxFs_File file = {};
+	uint32_t size = 0;
+	uint32_t lenLeft = len;
+	uint32_t lenActual = 0;
+	uint32_t crc = AlxCrc_Calc_Start(&me->alxCrc);
+	uint8_t trailer[sizeof(uint32_t) + sizeof(uint32_t)] = {};	// gen + crc
+
+	// Open
+	status = AlxFs_File_Open(me->alxFs, &file, pathWithSuffix, "r");
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Open(%s) status %d", pathWithSuffix, status);
+		return status;
+	}
+
+	// Check size
+	status = AlxFs_File_Size(me->alxFs, &file, &size);
+	if (status == Alx_Ok && size != lenWithCrc)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: CheckSize(%s) size %lu lenWithCrc %lu", pathWithSuffix, size, lenWithCrc);
+		status = Alx_Err;
+	}
+
+	// Read data in chunks & calculate running CRC
+	while (status == Alx_Ok && lenLeft > 0)
+	{
+		uint32_t chunkLen = (lenLeft < me->buffLen) ? lenLeft : me->buffLen;
+		status = AlxFs_File_Read(me->alxFs, &file, me->buffA, chunkLen, &lenActual);
+		if (status != Alx_Ok || lenActual != chunkLen)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Read(%s) status %d chunkLen %lu lenActual %lu", pathWithSuffix, status, chunkLen, lenActual);
+			status = Alx_Err;
+			break;
+		}
+		crc = AlxCrc_Calc_Update(&me->alxCrc, crc, me->buffA, chunkLen);
+		if (chunkRead_Callback != NULL)
+		{
+			status = chunkRead_Callback(chunkRead_Callback_Ctx, me->buffA, chunkLen);
+			if (status != Alx_Ok)
+			{
+				ALX_FS_SAFE_TRACE_ERR("FAIL: chunkRead_Callback(%s) status %d", pathWithSuffix, status);
+				break;
+			}
+		}
+		lenLeft = lenLeft - chunkLen;
+	}
+
+	// Read trailer
+	if (status == Alx_Ok)
+	{
+		status = AlxFs_File_Read(me->alxFs, &file, trailer, lenTrailer, &lenActual);
+		if (status != Alx_Ok || lenActual != lenTrailer)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Read(%s) status %d lenTrailer %lu lenActual %lu", pathWithSuffix, status, lenTrailer, lenActual);
+			status = Alx_Err;
+		}
+	}
+
+	// Close, error before close has precedence
+	Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &file);
+	if (statusClose != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", pathWithSuffix, statusClose);
+		if (status == Alx_Ok)
+		{
+			status = statusClose;
+		}
+	}
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Check CRC
+	//------------------------------------------------------------------------------
+	crc = AlxCrc_Calc_Update(&me->alxCrc, crc, trailer, me->genLen);
+	crc = AlxCrc_Calc_Finish(&me->alxCrc, crc);
+	uint32_t crcToCheck = 0;
+	memcpy(&crcToCheck, &trailer[me->genLen], me->alxCrcLen);
+	if (crcToCheck != crc)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: CheckCrc(%s) crcToCheck %lu crc %lu", pathWithSuffix, crcToCheck, crc);
+		return Alx_Err;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Return
+	//------------------------------------------------------------------------------
+	*validatedCrc = crc;
+	memcpy(gen, trailer, me->genLen);
+	return Alx_Ok;
+}
+Alx_Status AlxFsSafe_File_WriteCopyStream(AlxFsSafe* me, bool isA, const char* path, uint32_t len, Alx_Status(*chunkWrite_Callback)(void* ctx, uint32_t offset, void* chunkData, uint32_t chunkLen), void* chunkWrite_Callback_Ctx, uint32_t gen)
+{
+	//------------------------------------------------------------------------------
+	// Prepare
+	//------------------------------------------------------------------------------
+
+	// Path with Suffix
+	char pathWithSuffix[ALX_FS_SAFE_PATH_LEN_MAX + 1 + 1] = "";	// path + suffix + termination
+	AlxFsSafe_PathToPathWithSuffix(isA, path, pathWithSuffix);
+
+	// Length
+	uint32_t lenTrailer = me->genLen + me->alxCrcLen;
+
+
+	//------------------------------------------------------------------------------
+	// Write
+	//------------------------------------------------------------------------------
+
+	// Local variables
+	Alx_Status status = Alx_Err;
+	AlxFs_File file = {};
+	uint32_t offset = 0;
+	uint32_t crc = AlxCrc_Calc_Start(&me->alxCrc);
+	uint8_t trailer[sizeof(uint32_t) + sizeof(uint32_t)] = {};	// gen + crc
+
+	// Open
+	status = AlxFs_File_Open(me->alxFs, &file, pathWithSuffix, "w");
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Open(%s) status %d", pathWithSuffix, status);
+		return status;
+	}
+
+	// Write data in chunks & calculate running CRC
+	while (status == Alx_Ok && offset < len)
+	{
+		uint32_t chunkLen = ((len - offset) < me->buffLen) ? (len - offset) : me->buffLen;
+		status = chunkWrite_Callback(chunkWrite_Callback_Ctx, offset, me->buffA, chunkLen);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: chunkWrite_Callback(%s) status %d offset %lu", pathWithSuffix, status, offset);
+			break;
+		}
+		crc = AlxCrc_Calc_Update(&me->alxCrc, crc, me->buffA, chunkLen);
+		status = AlxFs_File_Write(me->alxFs, &file, me->buffA, chunkLen);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Write(%s) status %d chunkLen %lu", pathWithSuffix, status, chunkLen);
+			break;
+		}
+		offset = offset + chunkLen;
+	}
+
+	// Write trailer last, copy is valid only after trailer is written
+	if (status == Alx_Ok)
+	{
+		memcpy(trailer, &gen, me->genLen);
+		crc = AlxCrc_Calc_Update(&me->alxCrc, crc, trailer, me->genLen);
+		crc = AlxCrc_Calc_Finish(&me->alxCrc, crc);
+		memcpy(&trailer[me->genLen], &crc, me->alxCrcLen);
+		status = AlxFs_File_Write(me->alxFs, &file, trailer, lenTrailer);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Write(%s) status %d lenTrailer %lu", pathWithSuffix, status, lenTrailer);
+		}
+	}
+
+	// Close, error before close has precedence
+	Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &file);
+	if (statusClose != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", pathWithSuffix, statusClose);
+		if (status == Alx_Ok)
+		{
+			status = statusClose;
+		}
+	}
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Verify
+	//------------------------------------------------------------------------------
+	uint32_t crcVerify = 0;
+	uint32_t genVerify = 0;
+	status = AlxFsSafe_File_CheckCopyStream(me, isA, path, len, &crcVerify, &genVerify, NULL, NULL);
+	if (status != Alx_Ok || crcVerify != crc)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_CheckCopyStream(%s) status %d", pathWithSuffix, status);
+		return Alx_Err;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Return
+	//------------------------------------------------------------------------------
+	return Alx_Ok;
+}
+Alx_Status AlxFsSafe_File_RepairCopyStream(AlxFsSafe* me, bool isA, const char* path, uint32_t len)
+{
+	//------------------------------------------------------------------------------
+	// Prepare
+	//------------------------------------------------------------------------------
+
+	// Path with Suffix, copy isA is repaired from the other copy
+	char pathWithSuffixSrc[ALX_FS_SAFE_PATH_LEN_MAX + 1 + 1] = "";	// path + suffix + termination
+	char pathWithSuffixDst[ALX_FS_SAFE_PATH_LEN_MAX + 1 + 1] = "";	// path + suffix + termination
+	AlxFsSafe_PathToPathWithSuffix(!isA, path, pathWithSuffixSrc);
+	AlxFsSafe_PathToPathWithSuffix(isA, path, pathWithSuffixDst);
+
+	// Length
+	uint32_t lenWithCrc = len + me->genLen + me->alxCrcLen;
+
+
+	//------------------------------------------------------------------------------
+	// Copy
+	//------------------------------------------------------------------------------
+
+	// Local variables
+	Alx_Status status = Alx_Err;
+	AlxFs_File fileSrc = {};
+	AlxFs_File fileDst = {};
+	uint32_t lenLeft = lenWithCrc;
+
+	// Open
+	status = AlxFs_File_Open(me->alxFs, &fileSrc, pathWithSuffixSrc, "r");
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Open(%s) status %d", pathWithSuffixSrc, status);
+		return status;
+	}
+	status = AlxFs_File_Open(me->alxFs, &fileDst, pathWithSuffixDst, "w");
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Open(%s) status %d", pathWithSuffixDst, status);
+		Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &fileSrc);
+		if (statusClose != Alx_Ok)	// Open error is returned, source was only read
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d", pathWithSuffixSrc, statusClose);
+		}
+		return status;
+	}
+
+	// Copy data & trailer in chunks
+	while (status == Alx_Ok && lenLeft > 0)
+	{
+		uint32_t chunkLen = (lenLeft < me->buffLen) ? lenLeft : me->buffLen;
+		uint32_t lenActual = 0;
+		status = AlxFs_File_Read(me->alxFs, &fileSrc, me->buffA, chunkLen, &lenActual);
+		if (status != Alx_Ok || lenActual != chunkLen)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Read(%s) status %d chunkLen %lu lenActual %lu", pathWithSuffixSrc, status, chunkLen, lenActual);
+			status = Alx_Err;
+			break;
+		}
+		status = AlxFs_File_Write(me->alxFs, &fileDst, me->buffA, chunkLen);
+		if (status != Alx_Ok)
+		{
+			ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Write(%s) status %d chunkLen %lu", pathWithSuffixDst, status, chunkLen);
+			break;
+		}
+		lenLeft = lenLeft - chunkLen;
+	}
+
+	// Close, error before close has precedence, then destination close error, because destination may not be completely written
+	Alx_Status statusCloseSrc = AlxFs_File_Close(me->alxFs, &fileSrc);
+	Alx_Status statusCloseDst = AlxFs_File_Close(me->alxFs, &fileDst);
+	if (statusCloseSrc != Alx_Ok || statusCloseDst != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFs_File_Close(%s) status %d statusDst %d", pathWithSuffixSrc, statusCloseSrc, statusCloseDst);
+		if (status == Alx_Ok)
+		{
+			status = (statusCloseDst != Alx_Ok) ? statusCloseDst : statusCloseSrc;
+		}
+	}
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Verify
+	//------------------------------------------------------------------------------
+	uint32_t crcVerify = 0;
+	uint32_t genVerify = 0;
+	status = AlxFsSafe_File_CheckCopyStream(me, isA, path, len, &crcVerify, &genVerify, NULL, NULL);
+	if (status != Alx_Ok)
+	{
+		ALX_FS_SAFE_TRACE_ERR("FAIL: AlxFsSafe_File_CheckCopyStream(%s) status %d", pathWithSuffixDst, status);
+		return status;
+	}
+
+
 	//------------------------------------------------------------------------------
 	// Return
 	//------------------------------------------------------------------------------
@@ -97,6 +97,7 @@ typedef struct
 	// Variables,
 	AlxCrc alxCrc;
 	uint32_t alxCrcLen;
+	uint32_t genLen;
 
 	// Info
 	bool wasCtorCalled;
@@ -123,6 +124,8 @@ void AlxFsSafe_Ctor
 //******************************************************************************
 Alx_Status AlxFsSafe_File_Read(AlxFsSafe* me, const char* path, void* data, uint32_t len);
 Alx_Status AlxFsSafe_File_Write(AlxFsSafe* me, const char* path, void* data, uint32_t len);
+Alx_Status AlxFsSafe_File_ReadStream(AlxFsSafe* me, const char* path, uint32_t len, Alx_Status(*chunkRead_Callback)(void* ctx, void* chunkData, uint32_t chunkLenActual), void* chunkRead_Callback_Ctx);
+Alx_Status AlxFsSafe_File_WriteStream(AlxFsSafe* me, const char* path, uint32_t len, Alx_Status(*chunkWrite_Callback)(void* ctx, uint32_t offset, void* chunkData, uint32_t chunkLen), void* chunkWrite_Callback_Ctx);
 
 
 #endif	// #if defined(ALX_C_LIB)
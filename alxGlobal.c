@@ -47,7 +47,7 @@
   */
 void AlxGlobal_DisableIrq(void)
 {
-	#if defined(__GNUC__)
+	#if defined(__GNUC__) && !defined(ALX_PC)
 	__disable_irq();
 	#endif
 }
@@ -57,7 +57,7 @@ void AlxGlobal_DisableIrq(void)
   */
 void AlxGlobal_EnableIrq(void)
 {
-	#if defined(__GNUC__)
+	#if defined(__GNUC__) && !defined(ALX_PC)
 	__enable_irq();
 	#endif
 }
@@ -122,5 +122,22 @@ uint32_t AlxGlobal_Ntohl(uint32_t val)
 	return ret;
 }
 
+/**
+  * @brief FNV-1a hash of null terminated string, used by hash tables of command names & parameter keys
+  * @param[in] str
+  * @return
+  */
+uint32_t AlxGlobal_HashFnv1a(const char* str)
+{
+	uint32_t hash = 2166136261u;
+	while (*str != '\0')
+	{
+		hash = hash ^ (uint8_t)(*str);
+		hash = hash * 16777619u;
+		str++;
+	}
+	return hash;
+}
+
 
 #endif	// #if defined(ALX_C_LIB)
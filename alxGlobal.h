@@ -362,7 +362,8 @@ typedef enum
 	AlxLogger_ErrNoReadLog,
 	AlxNet_Timeout,
 	AlxNet_NotSupported,
-	AlxNtp_NotEnoughSamples
+	AlxNtp_NotEnoughSamples,
+	AlxFs_ErrNoFile
 } Alx_Status;
 
 typedef enum
@@ -513,6 +514,7 @@ void AlxGlobal_EnableIrq(void);
 void AlxGlobal_Ulltoa(uint64_t uint64, char* str);
 void AlxGlobal_Slltoa(int64_t int64, char* str);
 uint32_t AlxGlobal_Ntohl(uint32_t val);
+uint32_t AlxGlobal_HashFnv1a(const char* str);
 
 
 #endif	// #if defined(ALX_C_LIB)
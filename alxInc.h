@@ -104,6 +104,7 @@ extern "C" {
 #include "alxBuild.h"
 #include "alxCanParser.h"
 #include "alxCli.h"
+#include "alxCobs.h"
 #include "alxCrc.h"
 #include "alxDelay.h"
 #include "alxFifo.h"
@@ -119,6 +120,7 @@ extern "C" {
 #include "alxId.h"
 #include "alxInc.h"
 #include "alxInterpLin.h"
+#include "alxJson.h"
 #include "alxLfsConfig.h"
 #include "alxLin.h"
 #include "alxLinFun.h"
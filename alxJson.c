@@ -0,0 +1,387 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxJson.c
+  * @brief		Auralix C Library - ALX JSON Module
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxJson.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB)
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxJson_Member(AlxJson* me, const char* key);
+static void AlxJson_ContainerStart(AlxJson* me, const char* key, char bracket);
+static void AlxJson_ContainerEnd(AlxJson* me, char bracket);
+static void AlxJson_Indent(AlxJson* me);
+static void AlxJson_PutStrEscaped(AlxJson* me, const char* str);
+static void AlxJson_PutStr(AlxJson* me, const char* str);
+static void AlxJson_Put(AlxJson* me, const char* data, uint32_t len);
+static void AlxJson_Flush(AlxJson* me);
+
+
+//******************************************************************************
+// Constructor
+//******************************************************************************
+
+/**
+  * @brief
+  * @param[in,out]	me
+  * @param[in]		write_Callback
+  * @param[in]		write_Callback_Ctx
+  * @param[in,out]	buff
+  * @param[in]		buffLen
+  */
+void AlxJson_Ctor
+(
+	AlxJson* me,
+	Alx_Status(*write_Callback)(void* ctx, const uint8_t* data, uint32_t len),
+	void* write_Callback_Ctx,
+	uint8_t* buff,
+	uint32_t buffLen
+)
+{
+	// Assert
+	ALX_JSON_ASSERT(write_Callback != NULL);
+	ALX_JSON_ASSERT(buffLen > 0);
+
+	// Parameters
+	me->write_Callback = write_Callback;
+	me->write_Callback_Ctx = write_Callback_Ctx;
+	me->buff = buff;
+	me->buffLen = buffLen;
+
+	// Variables
+	me->buffLenUsed = 0;
+	me->depth = 0;
+	me->isPretty = false;
+	me->isCommaNeeded = false;
+	me->status = Alx_Ok;
+
+	// Info
+	me->wasCtorCalled = true;
+}
+
+
+//******************************************************************************
+// Functions
+//******************************************************************************
+
+/**
+  * @brief			Start new document, buff must NOT be used by anyone else until AlxJson_End
+  * @param[in,out]	me
+  * @param[in]		isPretty	If true, each member is on its own line with 4 spaces indent per depth, same as existing CLI responses
+  */
+void AlxJson_Begin(AlxJson* me, bool isPretty)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+
+	// Reset
+	me->buffLenUsed = 0;
+	me->depth = 0;
+	me->isPretty = isPretty;
+	me->isCommaNeeded = false;
+	me->status = Alx_Ok;
+}
+
+/**
+  * @brief			Terminate document with \r\n and write what is left in buff
+  * @param[in,out]	me
+  * @retval			Alx_Ok
+  * @retval			Alx_Err	Containers NOT closed
+  * @retval			Other	First error returned by write_Callback
+  */
+Alx_Status AlxJson_End(AlxJson* me)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+	ALX_JSON_ASSERT(me->depth == 0);
+
+	// Terminate & flush
+	AlxJson_PutStr(me, "\r\n");
+	AlxJson_Flush(me);
+
+	// Return
+	if (me->depth != 0) { ALX_JSON_TRACE("Err: depth %lu", (unsigned long)me->depth); return Alx_Err; }
+	return me->status;
+}
+
+/**
+  * @brief
+  * @param[in,out]	me
+  * @param[in]		key	NULL if root or array element
+  */
+void AlxJson_ObjStart(AlxJson* me, const char* key)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+
+	// Start
+	AlxJson_ContainerStart(me, key, '{');
+}
+
+/**
+  * @brief
+  * @param[in,out]	me
+  */
+void AlxJson_ObjEnd(AlxJson* me)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+
+	// End
+	AlxJson_ContainerEnd(me, '}');
+}
+
+/**
+  * @brief
+  * @param[in,out]	me
+  * @param[in]		key	NULL if root or array element
+  */
+void AlxJson_ArrStart(AlxJson* me, const char* key)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+
+	// Start
+	AlxJson_ContainerStart(me, key, '[');
+}
+
+/**
+  * @brief
+  * @param[in,out]	me
+  */
+void AlxJson_ArrEnd(AlxJson* me)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+
+	// End
+	AlxJson_ContainerEnd(me, ']');
+}
+
+/**
+  * @brief			String value, quoted & escaped
+  * @param[in,out]	me
+  * @param[in]		key	NULL if array element
+  * @param[in]		val
+  */
+void AlxJson_Str(AlxJson* me, const char* key, const char* val)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+
+	// Put
+	AlxJson_Member(me, key);
+	AlxJson_PutStr(me, "\"");
+	AlxJson_PutStrEscaped(me, val);
+	AlxJson_PutStr(me, "\"");
+}
+
+/**
+  * @brief			Already formatted value, written as is, for numbers, true, false & null
+  * @param[in,out]	me
+  * @param[in]		key	NULL if array element
+  * @param[in]		val
+  */
+void AlxJson_Raw(AlxJson* me, const char* key, const char* val)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+
+	// Put
+	AlxJson_Member(me, key);
+	AlxJson_PutStr(me, val);
+}
+
+/**
+  * @brief
+  * @param[in,out]	me
+  * @param[in]		key	NULL if array element
+  * @param[in]		val
+  */
+void AlxJson_Uint32(AlxJson* me, const char* key, uint32_t val)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->wasCtorCalled == true);
+
+	// Format backwards
+	char str[10];
+	uint32_t i = sizeof(str);
+	do
+	{
+		i--;
+		str[i] = (char)('0' + (val % 10));
+		val = val / 10;
+	} while (val > 0);
+
+	// Put
+	AlxJson_Member(me, key);
+	AlxJson_Put(me, &str[i], sizeof(str) - i);
+}
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static void AlxJson_Member(AlxJson* me, const char* key)
+{
+	// Separator & new line, except before first member of root
+	if (me->isCommaNeeded)
+	{
+		AlxJson_PutStr(me, ",");
+	}
+	if (me->depth > 0)
+	{
+		AlxJson_Indent(me);
+	}
+	me->isCommaNeeded = true;
+
+	// Key
+	if (key != NULL)
+	{
+		AlxJson_PutStr(me, "\"");
+		AlxJson_PutStrEscaped(me, key);
+		AlxJson_PutStr(me, "\":");
+	}
+}
+static void AlxJson_ContainerStart(AlxJson* me, const char* key, char bracket)
+{
+	// Member, if pretty and key is used, bracket goes to next line
+	AlxJson_Member(me, key);
+	if ((key != NULL) && (me->depth > 0))
+	{
+		AlxJson_Indent(me);
+	}
+
+	// Bracket
+	AlxJson_Put(me, &bracket, 1);
+	me->depth++;
+	me->isCommaNeeded = false;
+}
+static void AlxJson_ContainerEnd(AlxJson* me, char bracket)
+{
+	// Assert
+	ALX_JSON_ASSERT(me->depth > 0);
+
+	// Bracket on own line
+	me->depth--;
+	AlxJson_Indent(me);
+	AlxJson_Put(me, &bracket, 1);
+	me->isCommaNeeded = true;
+}
+static void AlxJson_Indent(AlxJson* me)
+{
+	// If compact, do nothing
+	if (me->isPretty == false)
+	{
+		return;
+	}
+
+	// New line & 4 spaces per depth
+	AlxJson_PutStr(me, "\r\n");
+	for (uint32_t i = 0; i < me->depth; i++)
+	{
+		AlxJson_PutStr(me, "    ");
+	}
+}
+static void AlxJson_PutStrEscaped(AlxJson* me, const char* str)
+{
+	while (*str != '\0')
+	{
+		// Find run of characters that need no escape, so they are copied at once
+		const char* run = str;
+		while ((*str != '\0') && (*str != '"') && (*str != '\\') && ((uint8_t)*str >= 0x20))
+		{
+			str++;
+		}
+		AlxJson_Put(me, run, (uint32_t)(str - run));
+		if (*str == '\0')
+		{
+			break;
+		}
+
+		// Escape
+		char esc[7] = "";
+		switch (*str)
+		{
+			case '"': strcpy(esc, "\\\""); break;
+			case '\\': strcpy(esc, "\\\\"); break;
+			case '\b': strcpy(esc, "\\b"); break;
+			case '\f': strcpy(esc, "\\f"); break;
+			case '\n': strcpy(esc, "\\n"); break;
+			case '\r': strcpy(esc, "\\r"); break;
+			case '\t': strcpy(esc, "\\t"); break;
+			default: snprintf(esc, sizeof(esc), "\\u%04X", (uint8_t)*str); break;
+		}
+		AlxJson_PutStr(me, esc);
+		str++;
+	}
+}
+static void AlxJson_PutStr(AlxJson* me, const char* str)
+{
+	AlxJson_Put(me, str, strlen(str));
+}
+static void AlxJson_Put(AlxJson* me, const char* data, uint32_t len)
+{
+	while (len > 0)
+	{
+		// If buff full, flush
+		if (me->buffLenUsed == me->buffLen)
+		{
+			AlxJson_Flush(me);
+		}
+
+		// Copy as much as fits
+		uint32_t lenFree = me->buffLen - me->buffLenUsed;
+		uint32_t lenCopy = (len < lenFree) ? len : lenFree;
+		memcpy(&me->buff[me->buffLenUsed], data, lenCopy);
+		me->buffLenUsed = me->buffLenUsed + lenCopy;
+		data = data + lenCopy;
+		len = len - lenCopy;
+	}
+}
+static void AlxJson_Flush(AlxJson* me)
+{
+	// Write, after first error, data is discarded, so that caller only checks status returned by AlxJson_End
+	if ((me->buffLenUsed > 0) && (me->status == Alx_Ok))
+	{
+		me->status = me->write_Callback(me->write_Callback_Ctx, me->buff, me->buffLenUsed);
+		if (me->status != Alx_Ok) { ALX_JSON_TRACE("Err: write_Callback"); }
+	}
+	me->buffLenUsed = 0;
+}
+
+
+#endif	// #if defined(ALX_C_LIB)
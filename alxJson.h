@@ -0,0 +1,133 @@
+﻿/**
+  ******************************************************************************
+  * @file		alxJson.h
+  * @brief		Auralix C Library - ALX JSON Module
+  * @copyright	Copyright (C) Auralix d.o.o. All rights reserved.
+  *
+  * @section License
+  *
+  * SPDX-License-Identifier: GPL-3.0-or-later
+  *
+  * This file is part of Auralix C Library.
+  *
+  * Auralix C Library is free software: you can redistribute it and/or
+  * modify it under the terms of the GNU General Public License
+  * as published by the Free Software Foundation, either version 3
+  * of the License, or (at your option) any later version.
+  *
+  * Auralix C Library is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with Auralix C Library. If not, see <https://www.gnu.org/licenses/>.
+  ******************************************************************************
+  **/
+
+//******************************************************************************
+// Include Guard
+//******************************************************************************
+#ifndef ALX_JSON_H
+#define ALX_JSON_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+//******************************************************************************
+// Includes
+//******************************************************************************
+#include "alxGlobal.h"
+#include "alxTrace.h"
+#include "alxAssert.h"
+
+
+//******************************************************************************
+// Module Guard
+//******************************************************************************
+#if defined(ALX_C_LIB)
+
+
+//******************************************************************************
+// Preprocessor
+//******************************************************************************
+#define ALX_JSON_FILE "alxJson.h"
+
+// Assert //
+#if defined(ALX_JSON_ASSERT_BKPT_ENABLE)
+	#define ALX_JSON_ASSERT(expr) ALX_ASSERT_BKPT(ALX_JSON_FILE, expr)
+#elif defined(ALX_JSON_ASSERT_TRACE_ENABLE)
+	#define ALX_JSON_ASSERT(expr) ALX_ASSERT_TRACE(ALX_JSON_FILE, expr)
+#elif defined(ALX_JSON_ASSERT_RST_ENABLE)
+	#define ALX_JSON_ASSERT(expr) ALX_ASSERT_RST(ALX_JSON_FILE, expr)
+#else
+	#define ALX_JSON_ASSERT(expr) do{} while (false)
+#endif
+
+// Trace //
+#if defined(ALX_JSON_TRACE_ENABLE)
+	#define ALX_JSON_TRACE(...) ALX_TRACE_WRN(ALX_JSON_FILE, __VA_ARGS__)
+#else
+	#define ALX_JSON_TRACE(...) do{} while (false)
+#endif
+
+
+//******************************************************************************
+// Types
+//******************************************************************************
+typedef struct
+{
+	// Parameters
+	Alx_Status(*write_Callback)(void* ctx, const uint8_t* data, uint32_t len);	// Sink, called only when buff is full or on AlxJson_End
+	void* write_Callback_Ctx;
+	uint8_t* buff;
+	uint32_t buffLen;
+
+	// Variables
+	uint32_t buffLenUsed;
+	uint32_t depth;
+	bool isPretty;
+	bool isCommaNeeded;
+	Alx_Status status;	// First sink error, further writes are discarded
+
+	// Info
+	bool wasCtorCalled;
+} AlxJson;
+
+
+//******************************************************************************
+// Constructor
+//******************************************************************************
+void AlxJson_Ctor
+(
+	AlxJson* me,
+	Alx_Status(*write_Callback)(void* ctx, const uint8_t* data, uint32_t len),
+	void* write_Callback_Ctx,
+	uint8_t* buff,
+	uint32_t buffLen
+);
+
+
+//******************************************************************************
+// Functions
+//******************************************************************************
+void AlxJson_Begin(AlxJson* me, bool isPretty);
+Alx_Status AlxJson_End(AlxJson* me);
+void AlxJson_ObjStart(AlxJson* me, const char* key);
+void AlxJson_ObjEnd(AlxJson* me);
+void AlxJson_ArrStart(AlxJson* me, const char* key);
+void AlxJson_ArrEnd(AlxJson* me);
+void AlxJson_Str(AlxJson* me, const char* key, const char* val);
+void AlxJson_Raw(AlxJson* me, const char* key, const char* val);
+void AlxJson_Uint32(AlxJson* me, const char* key, uint32_t val);
+
+
+#endif	// #if defined(ALX_C_LIB)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// #ifndef ALX_JSON_H
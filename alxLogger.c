@@ -624,7 +624,11 @@ Alx_Status AlxLogger_Log_Write(AlxLogger* me, const char* logs, uint32_t numOfLo
 		// Open
 		//------------------------------------------------------------------------------
 		sprintf(path, "/%lu/%lu.csv", me->md.write.dir, me->md.write.file);
+		#if defined(ALX_LOGGER_FILE_PREALLOC_LEN)
+		status = AlxFs_File_Open(me->alxFs, &file, path, (me->md.write.pos == 0) ? "w" : "r+");	// Preallocated file is longer than written data, so it is not appended
+		#else
 		status = AlxFs_File_Open(me->alxFs, &file, path, "a");
+		#endif
 		if (status != Alx_Ok)
 		{
 			ALX_LOGGER_TRACE_WRN("Err: %d, path=%s, logNum=%u, writeLenTotal=%u, numOfLogs=%u", status, path, logNum, writeLenTotal, numOfLogs);
@@ -632,6 +636,36 @@ Alx_Status AlxLogger_Log_Write(AlxLogger* me, const char* logs, uint32_t numOfLo
 		}
 
 
+		//------------------------------------------------------------------------------
+		// Preallocate
+		//------------------------------------------------------------------------------
+		#if defined(ALX_LOGGER_FILE_PREALLOC_LEN)
+		if (me->md.write.pos == 0)	// If new file, allocate contiguous storage for whole file, file is truncated to written data when full, error is not critical
+		{
+			status = AlxFs_File_Preallocate(me->alxFs, &file, ALX_LOGGER_FILE_PREALLOC_LEN, true);
+			if (status != Alx_Ok)
+			{
+				ALX_LOGGER_TRACE_WRN("Err: %d, path=%s, preallocLen=%u", status, path, ALX_LOGGER_FILE_PREALLOC_LEN);
+			}
+		}
+		else	// Else continue after last written log
+		{
+			uint32_t positionNew = 0;
+			status = AlxFs_File_Seek(me->alxFs, &file, (int32_t)me->md.write.pos, AlxFs_File_Seek_Origin_Set, &positionNew);
+			if (status != Alx_Ok)
+			{
+				ALX_LOGGER_TRACE_WRN("Err: %d, path=%s, offset=%u, positionNew=%u", status, path, me->md.write.pos, positionNew);
+				Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &file);
+				if (statusClose != Alx_Ok)
+				{
+					ALX_LOGGER_TRACE_WRN("Err: %d, path=%s", statusClose, path);
+				}
+				return status;
+			}
+		}
+		#endif
+
+
 		//------------------------------------------------------------------------------
 		// Prepare
 		//------------------------------------------------------------------------------
@@ -675,6 +709,27 @@ Alx_Status AlxLogger_Log_Write(AlxLogger* me, const char* logs, uint32_t numOfLo
 		}
 
 
+		//------------------------------------------------------------------------------
+		// Truncate
+		//------------------------------------------------------------------------------
+		#if defined(ALX_LOGGER_FILE_PREALLOC_LEN)
+		if ((me->md.write.log + numOfLogsToWrite) >= me->numOfLogsPerFile)	// If file full, free unused preallocated storage, so file size is size of written logs
+		{
+			status = AlxFs_File_Truncate(me->alxFs, &file, me->md.write.pos + writeLen);
+			if (status != Alx_Ok)
+			{
+				ALX_LOGGER_TRACE_WRN("Err: %d, path=%s, size=%u", status, path, me->md.write.pos + writeLen);
+				Alx_Status statusClose = AlxFs_File_Close(me->alxFs, &file);
+				if (statusClose != Alx_Ok)
+				{
+					ALX_LOGGER_TRACE_WRN("Err: %d, path=%s", statusClose, path);
+				}
+				return status;
+			}
+		}
+		#endif
+
+
 		//------------------------------------------------------------------------------
 		// Close
 		//------------------------------------------------------------------------------
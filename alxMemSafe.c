@@ -37,6 +37,17 @@
 #if defined(ALX_C_LIB)
 
 
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static Alx_Status AlxMemSafe_TransferChunk(AlxMemSafe* me, bool isWrite, bool isDelta, uint32_t addr, uint8_t* buff, bool* isDone);
+static Alx_Status AlxMemSafe_WriteCopy(AlxMemSafe* me, uint32_t addr);
+static Alx_Status AlxMemSafe_WriteChunk(AlxMemSafe* me, bool isDelta, uint32_t addr, uint8_t* buff, uint32_t offset, uint32_t len);
+static uint32_t AlxMemSafe_GetChunkLen(AlxMemSafe* me, uint32_t addr, uint32_t offset, uint32_t lenMax);
+static void AlxMemSafe_ReadDone(AlxMemSafe* me, Alx_Status status, uint8_t* buff);
+static void AlxMemSafe_Retry(AlxMemSafe* me);
+
+
 //******************************************************************************
 // Constructor
 //******************************************************************************
@@ -103,6 +114,11 @@ void AlxMemSafe_Ctor
 	me->isReadErr = false;
 	me->isWriteDone = false;
 	me->isWriteErr = false;
+	me->st = AlxMemSafe_St_Idle;
+	me->stOffset = 0;
+	me->stNumOfTries = 0;
+	me->readData = NULL;
+	me->readStatus = Alx_Err;
 
 	// Info
 	me->wasCtorCalled = true;
@@ -130,12 +146,27 @@ Alx_Status AlxMemSafe_Read(AlxMemSafe* me, uint8_t* data, uint32_t len)
 	// #1 Prepare variables
 	Alx_Status status = Alx_Err;
 
-	// #2 Non-Blocking
+	// #2 Non-Blocking - Start reading, AlxMemSafe_Handle does the rest
 	if (me->nonBlockingEnable)
 	{
-		// TV: TODO
-		ALX_MEM_SAFE_ASSERT(false);
-		return Alx_Err;
+		// #2.1 Check if busy
+		if (me->st != AlxMemSafe_St_Idle)
+		{
+			ALX_MEM_SAFE_TRACE("ErrBusy");
+			return Alx_Err;
+		}
+
+		// #2.2 Start
+		me->readData = data;
+		me->readStatus = Alx_Err;
+		me->isReadDone = false;
+		me->isReadErr = false;
+		me->stOffset = 0;
+		me->stNumOfTries = 0;
+		me->st = AlxMemSafe_St_ReadCopyA;
+
+		// #2.3 Return
+		return Alx_Ok;
 	}
 
 	// #3 Blocking
@@ -286,6 +317,7 @@ Alx_Status AlxMemSafe_Read(AlxMemSafe* me, uint8_t* data, uint32_t len)
 		// #3.3 Set status variables
 		me->isReadDone = true;
 		me->isReadErr = false;
+		me->readStatus = status;
 	}
 
 	// #4 Return
@@ -309,12 +341,30 @@ Alx_Status AlxMemSafe_Write(AlxMemSafe* me, uint8_t* data, uint32_t len)
 	// #1 Prepare variables
 	Alx_Status status = Alx_Err;
 
-	// #2 Non-Blocking
+	// #2 Non-Blocking - Start writing, AlxMemSafe_Handle does the rest
 	if (me->nonBlockingEnable)
 	{
-		// TV: TODO
-		ALX_MEM_SAFE_ASSERT(false);
-		return Alx_Err;
+		// #2.1 Check if busy
+		if (me->st != AlxMemSafe_St_Idle)
+		{
+			ALX_MEM_SAFE_TRACE("ErrBusy");
+			return Alx_Err;
+		}
+
+		// #2.2 Prepare data to write
+		me->crcToWrite = AlxCrc_Calc(me->crc, data, len);
+		memcpy(me->buff1, data, len);
+		memcpy(&me->buff1[len], &me->crcToWrite, me->copyCrcLen);
+
+		// #2.3 Start
+		me->isWriteDone = false;
+		me->isWriteErr = false;
+		me->stOffset = 0;
+		me->stNumOfTries = 0;
+		me->st = AlxMemSafe_St_WriteCopyA;
+
+		// #2.4 Return
+		return Alx_Ok;
 	}
 
 	// #3 Blocking
@@ -340,7 +390,7 @@ Alx_Status AlxMemSafe_Write(AlxMemSafe* me, uint8_t* data, uint32_t len)
 			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrInit"); continue; }
 
 			// Write
-			statusMemRaw = AlxMemRaw_Write(me->memRaw, me->copyAddrA, me->buff1, me->copyLenWithCrc, true, me->memRawReadWriteNumOfTries, me->memRawReadWriteTimeout_ms);
+			statusMemRaw = AlxMemSafe_WriteCopy(me, me->copyAddrA);
 			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrWriteCopyA"); continue; }
 
 			// DeInit
@@ -354,7 +404,7 @@ Alx_Status AlxMemSafe_Write(AlxMemSafe* me, uint8_t* data, uint32_t len)
 			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrInit"); continue; }
 
 			// Write
-			statusMemRaw = AlxMemRaw_Write(me->memRaw, me->copyAddrB, me->buff1, me->copyLenWithCrc, true, me->memRawReadWriteNumOfTries, me->memRawReadWriteTimeout_ms);
+			statusMemRaw = AlxMemSafe_WriteCopy(me, me->copyAddrB);
 			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrWriteCopyB"); continue; }
 
 			// DeInit
@@ -433,5 +483,356 @@ bool AlxMemSafe_IsWriteErr(AlxMemSafe* me)
 	return me->isWriteErr;
 }
 
+/**
+  * @brief			Non-blocking mode only, performs one step of started read or write, must be called periodically until AlxMemSafe_IsBusy returns false
+  * @param[in,out]	me
+  */
+void AlxMemSafe_Handle(AlxMemSafe* me)
+{
+	// Assert
+	ALX_MEM_SAFE_ASSERT(me->wasCtorCalled == true);
+
+	// #1 Prepare variables
+	Alx_Status statusMemRaw = Alx_Err;
+	bool isDone = false;
+
+	// #2 Handle state
+	switch (me->st)
+	{
+		case AlxMemSafe_St_Idle:
+		{
+			// #1 Do Nothing
+
+			// #2 Break
+			break;
+		}
+		case AlxMemSafe_St_ReadCopyA:
+		{
+			// #1 Read CopyA chunk
+			statusMemRaw = AlxMemSafe_TransferChunk(me, false, false, me->copyAddrA, me->buff1, &isDone);
+			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrReadCopyA"); AlxMemSafe_Retry(me); break; }
+
+			// #2 Transition
+			if (isDone)
+			{
+				// #2.1 Check CopyA CRC
+				me->isCopyAValid = AlxCrc_IsOk(me->crc, me->buff1, me->copyLenWithCrc, &me->crcCopyA);
+
+				// #2.2 Change state
+				me->st = AlxMemSafe_St_ReadCopyB;
+			}
+
+			// #3 Break
+			break;
+		}
+		case AlxMemSafe_St_ReadCopyB:
+		{
+			// #1 Read CopyB chunk
+			statusMemRaw = AlxMemSafe_TransferChunk(me, false, false, me->copyAddrB, me->buff2, &isDone);
+			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrReadCopyB"); AlxMemSafe_Retry(me); break; }
+
+			// #2 Transition
+			if (isDone)
+			{
+				// #2.1 Check CopyB CRC
+				me->isCopyBValid = AlxCrc_IsOk(me->crc, me->buff2, me->copyLenWithCrc, &me->crcCopyB);
+
+				// #2.2 Change state
+				me->st = AlxMemSafe_St_ReadHandleCrc;
+			}
+
+			// #3 Break
+			break;
+		}
+		case AlxMemSafe_St_ReadHandleCrc:
+		{
+			// #1 Both CRC NOK
+			if((me->isCopyAValid == false) && (me->isCopyBValid == false))
+			{
+				AlxMemSafe_ReadDone(me, AlxSafe_BothCopyErr_OrigErr, NULL);
+			}
+			// #2 Both CRC OK & Same -> Use CopyA
+			else if ((me->isCopyAValid == true) && (me->isCopyBValid == true) && (me->crcCopyA == me->crcCopyB))
+			{
+				AlxMemSafe_ReadDone(me, AlxSafe_BothCopyOkCrcSame_OrigDontCare_UseCopyA, me->buff1);
+			}
+			// #3 Both CRC OK & Different -> Use CopyA and update CopyB with CopyA (CopyA is used because we always write CopyA first)
+			else if ((me->isCopyAValid == true) && (me->isCopyBValid == true) && (me->crcCopyA != me->crcCopyB))
+			{
+				me->readStatus = AlxSafe_BothCopyOkCrcDiff_OrigDontCare_UseCopyA;
+				me->st = AlxMemSafe_St_ReadUpdateCopyB;
+			}
+			// #4 CopyA OK, CopyB NOK -> Use CopyA and update CopyB with CopyA
+			else if ((me->isCopyAValid == true) && (me->isCopyBValid == false))
+			{
+				me->readStatus = AlxSafe_CopyAOkCopyBErr_OrigDontCare_UseCopyA;
+				me->st = AlxMemSafe_St_ReadUpdateCopyB;
+			}
+			// #5 CopyA NOK & CopyB OK -> Use CopyB and update CopyA with CopyB
+			else if ((me->isCopyAValid == false) && (me->isCopyBValid == true))
+			{
+				me->readStatus = AlxSafe_CopyAErrCopyBOk_OrigDontCare_UseCopyB;
+				me->st = AlxMemSafe_St_ReadUpdateCopyA;
+			}
+			// #6 Assert
+			else
+			{
+				ALX_MEM_SAFE_ASSERT(false);	// We should never get here
+			}
+
+			// #7 Break
+			break;
+		}
+		case AlxMemSafe_St_ReadUpdateCopyA:
+		{
+			// #1 Write CopyB chunk to CopyA
+			statusMemRaw = AlxMemSafe_TransferChunk(me, true, false, me->copyAddrA, me->buff2, &isDone);
+			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("CopyANokCopyBOk_UsedCopyB_WriteErr"); AlxMemSafe_Retry(me); break; }
+
+			// #2 Transition
+			if (isDone)
+			{
+				AlxMemSafe_ReadDone(me, me->readStatus, me->buff2);
+			}
+
+			// #3 Break
+			break;
+		}
+		case AlxMemSafe_St_ReadUpdateCopyB:
+		{
+			// #1 Write CopyA chunk to CopyB
+			statusMemRaw = AlxMemSafe_TransferChunk(me, true, false, me->copyAddrB, me->buff1, &isDone);
+			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("UsedCopyA_WriteErr"); AlxMemSafe_Retry(me); break; }
+
+			// #2 Transition
+			if (isDone)
+			{
+				AlxMemSafe_ReadDone(me, me->readStatus, me->buff1);
+			}
+
+			// #3 Break
+			break;
+		}
+		case AlxMemSafe_St_WriteCopyA:
+		{
+			// #1 Write CopyA chunk
+			statusMemRaw = AlxMemSafe_TransferChunk(me, true, true, me->copyAddrA, me->buff1, &isDone);
+			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrWriteCopyA"); AlxMemSafe_Retry(me); break; }
+
+			// #2 Transition
+			if (isDone)
+			{
+				me->st = AlxMemSafe_St_WriteCopyB;
+			}
+
+			// #3 Break
+			break;
+		}
+		case AlxMemSafe_St_WriteCopyB:
+		{
+			// #1 Write CopyB chunk (use buff1)
+			statusMemRaw = AlxMemSafe_TransferChunk(me, true, true, me->copyAddrB, me->buff1, &isDone);
+			if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrWriteCopyB"); AlxMemSafe_Retry(me); break; }
+
+			// #2 Transition
+			if (isDone)
+			{
+				me->isWriteDone = true;
+				me->isWriteErr = false;
+				me->st = AlxMemSafe_St_Idle;
+			}
+
+			// #3 Break
+			break;
+		}
+		default:
+		{
+			// #1 Assert
+			ALX_MEM_SAFE_ASSERT(false);	// We should never get here
+
+			// #2 Break
+			break;
+		}
+	}
+}
+
+/**
+  * @brief
+  * @param[in,out]	me
+  * @retval			false
+  * @retval			true
+  */
+bool AlxMemSafe_IsBusy(AlxMemSafe* me)
+{
+	// Assert
+	ALX_MEM_SAFE_ASSERT(me->wasCtorCalled == true);
+
+	// #1 Return
+	return me->st != AlxMemSafe_St_Idle;
+}
+
+/**
+  * @brief			Get status of last read, same as returned by blocking AlxMemSafe_Read, valid when AlxMemSafe_IsReadDone returns true
+  * @param[in,out]	me
+  * @return
+  */
+Alx_Status AlxMemSafe_GetReadStatus(AlxMemSafe* me)
+{
+	// Assert
+	ALX_MEM_SAFE_ASSERT(me->wasCtorCalled == true);
+
+	// #1 Return
+	return me->readStatus;
+}
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static Alx_Status AlxMemSafe_TransferChunk(AlxMemSafe* me, bool isWrite, bool isDelta, uint32_t addr, uint8_t* buff, bool* isDone)
+{
+	// #1 Prepare variables
+	Alx_Status statusMemRaw = Alx_Err;
+	uint32_t chunkLen = AlxMemSafe_GetChunkLen(me, addr, me->stOffset, ALX_MEM_SAFE_NON_BLOCKING_CHUNK_LEN);
+	*isDone = false;
+
+	// #2 Init, if first chunk
+	if (me->stOffset == 0)
+	{
+		statusMemRaw = AlxMemRaw_Init(me->memRaw);
+		if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrInit"); return statusMemRaw; }
+	}
+
+	// #3 Read or write chunk
+	if (isWrite)
+	{
+		statusMemRaw = AlxMemSafe_WriteChunk(me, isDelta, addr, buff, me->stOffset, chunkLen);
+	}
+	else
+	{
+		statusMemRaw = AlxMemRaw_Read(me->memRaw, addr + me->stOffset, &buff[me->stOffset], chunkLen, me->memRawReadWriteNumOfTries, me->memRawReadWriteTimeout_ms);
+	}
+	if(statusMemRaw != Alx_Ok) { return statusMemRaw; }
+	me->stOffset = me->stOffset + chunkLen;
+
+	// #4 DeInit, if last chunk
+	if (me->stOffset >= me->copyLenWithCrc)
+	{
+		statusMemRaw = AlxMemRaw_DeInit(me->memRaw);
+		if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrDeInit"); return statusMemRaw; }
+		me->stOffset = 0;
+		*isDone = true;
+	}
+
+	// #5 Return
+	return Alx_Ok;
+}
+static Alx_Status AlxMemSafe_WriteCopy(AlxMemSafe* me, uint32_t addr)
+{
+	// #1 Prepare variables
+	Alx_Status statusMemRaw = Alx_Err;
+	uint32_t offset = 0;
+
+	// #2 Write buff1 in chunks, without ALX_MEM_SAFE_WRITE_DELTA there is only one chunk
+	while (offset < me->copyLenWithCrc)
+	{
+		uint32_t chunkLen = AlxMemSafe_GetChunkLen(me, addr, offset, me->copyLenWithCrc);
+		statusMemRaw = AlxMemSafe_WriteChunk(me, true, addr, me->buff1, offset, chunkLen);
+		if(statusMemRaw != Alx_Ok) { return statusMemRaw; }
+		offset = offset + chunkLen;
+	}
+
+	// #3 Return
+	return Alx_Ok;
+}
+static Alx_Status AlxMemSafe_WriteChunk(AlxMemSafe* me, bool isDelta, uint32_t addr, uint8_t* buff, uint32_t offset, uint32_t len)
+{
+	// #1 Delta - Read stored chunk to buff2 and skip write if it is same.
+	// Power-fail safe, because CopyA is fully updated before CopyB is touched and partially updated copy fails CRC check.
+	#if defined(ALX_MEM_SAFE_WRITE_DELTA)
+	if (isDelta)
+	{
+		ALX_MEM_SAFE_ASSERT(buff != me->buff2);
+		Alx_Status statusMemRaw = AlxMemRaw_Read(me->memRaw, addr + offset, &me->buff2[offset], len, me->memRawReadWriteNumOfTries, me->memRawReadWriteTimeout_ms);
+		if(statusMemRaw != Alx_Ok) { ALX_MEM_SAFE_TRACE("ErrReadDelta"); return statusMemRaw; }
+		if (memcmp(&me->buff2[offset], &buff[offset], len) == 0)
+		{
+			return Alx_Ok;
+		}
+	}
+	#else
+	(void)isDelta;
+	#endif
+
+	// #2 Write
+	return AlxMemRaw_Write(me->memRaw, addr + offset, &buff[offset], len, true, me->memRawReadWriteNumOfTries, me->memRawReadWriteTimeout_ms);
+}
+static uint32_t AlxMemSafe_GetChunkLen(AlxMemSafe* me, uint32_t addr, uint32_t offset, uint32_t lenMax)
+{
+	// #1 Limit to copy length
+	uint32_t lenLeft = me->copyLenWithCrc - offset;
+	uint32_t chunkLen = (lenLeft < lenMax) ? lenLeft : lenMax;
+
+	// #2 Delta - Limit to page boundary, so that each chunk is within single memory page
+	#if defined(ALX_MEM_SAFE_WRITE_DELTA)
+	uint32_t pageLenLeft = ALX_MEM_SAFE_WRITE_DELTA_PAGE_LEN - ((addr + offset) % ALX_MEM_SAFE_WRITE_DELTA_PAGE_LEN);
+	chunkLen = (pageLenLeft < chunkLen) ? pageLenLeft : chunkLen;
+	#else
+	(void)addr;
+	#endif
+
+	// #3 Return
+	return chunkLen;
+}
+static void AlxMemSafe_ReadDone(AlxMemSafe* me, Alx_Status status, uint8_t* buff)
+{
+	// #1 Use copy
+	if (buff != NULL)
+	{
+		memcpy(me->readData, buff, me->copyLen);
+	}
+
+	// #2 Set status variables
+	me->readStatus = status;
+	me->isReadDone = true;
+	me->isReadErr = false;
+	me->st = AlxMemSafe_St_Idle;
+}
+static void AlxMemSafe_Retry(AlxMemSafe* me)
+{
+	// #1 Prepare variables
+	bool isRead = (me->st == AlxMemSafe_St_ReadCopyA) || (me->st == AlxMemSafe_St_ReadCopyB) || (me->st == AlxMemSafe_St_ReadUpdateCopyA) || (me->st == AlxMemSafe_St_ReadUpdateCopyB);
+	me->stOffset = 0;
+	me->stNumOfTries++;
+
+	// #2 All tries used -> Set error
+	if (me->stNumOfTries >= me->memSafeReadWriteNumOfTries)
+	{
+		if (isRead)
+		{
+			me->readStatus = Alx_Err;
+			me->isReadDone = false;
+			me->isReadErr = true;
+		}
+		else
+		{
+			me->isWriteDone = false;
+			me->isWriteErr = true;
+		}
+		me->st = AlxMemSafe_St_Idle;
+		return;
+	}
+
+	// #3 Start again from CopyA, same as blocking
+	if (isRead)
+	{
+		me->st = AlxMemSafe_St_ReadCopyA;
+	}
+	else
+	{
+		me->st = AlxMemSafe_St_WriteCopyA;
+	}
+}
+
 
 #endif	// #if defined(ALX_C_LIB)
@@ -75,10 +75,32 @@ extern "C" {
 	#define ALX_MEM_SAFE_TRACE(...) do{} while (false)
 #endif
 
+// Defines
+#ifndef ALX_MEM_SAFE_NON_BLOCKING_CHUNK_LEN
+	#define ALX_MEM_SAFE_NON_BLOCKING_CHUNK_LEN 32	// Number of bytes read or written per AlxMemSafe_Handle call in non-blocking mode
+#endif
+#if defined(ALX_MEM_SAFE_WRITE_DELTA)
+	#ifndef ALX_MEM_SAFE_WRITE_DELTA_PAGE_LEN
+		#define ALX_MEM_SAFE_WRITE_DELTA_PAGE_LEN 32	// Memory page length, AlxMemSafe_Write compares stored copy page by page and rewrites only changed pages
+	#endif
+#endif
+
 
 //******************************************************************************
 // Types
 //******************************************************************************
+typedef enum
+{
+	AlxMemSafe_St_Idle = 0,
+	AlxMemSafe_St_ReadCopyA = 1,
+	AlxMemSafe_St_ReadCopyB = 2,
+	AlxMemSafe_St_ReadHandleCrc = 3,
+	AlxMemSafe_St_ReadUpdateCopyA = 4,
+	AlxMemSafe_St_ReadUpdateCopyB = 5,
+	AlxMemSafe_St_WriteCopyA = 6,
+	AlxMemSafe_St_WriteCopyB = 7
+} AlxMemSafe_St;
+
 typedef struct
 {
 	// Parameters
@@ -108,6 +130,11 @@ typedef struct
 	bool isReadErr;
 	bool isWriteDone;
 	bool isWriteErr;
+	AlxMemSafe_St st;
+	uint32_t stOffset;
+	uint8_t stNumOfTries;
+	uint8_t* readData;
+	Alx_Status readStatus;
 
 	// Info
 	bool wasCtorCalled;
@@ -145,6 +172,9 @@ bool AlxMemSafe_IsReadDone(AlxMemSafe* me);
 bool AlxMemSafe_IsReadErr(AlxMemSafe* me);
 bool AlxMemSafe_IsWriteDone(AlxMemSafe* me);
 bool AlxMemSafe_IsWriteErr(AlxMemSafe* me);
+void AlxMemSafe_Handle(AlxMemSafe* me);
+bool AlxMemSafe_IsBusy(AlxMemSafe* me);
+Alx_Status AlxMemSafe_GetReadStatus(AlxMemSafe* me);
 
 
 #endif	// #if defined(ALX_C_LIB)
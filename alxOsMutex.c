@@ -63,6 +63,27 @@ void AlxOsMutex_Ctor
 	me->wasCtorCalled = true;
 }
 
+/**
+  * @brief		Mutex with priority inheritance, lock & unlock must be called from same thread, so it can not be used for signaling between threads
+  * @param[in,out] me
+  */
+void AlxOsMutex_CtorPrioInherit
+(
+	AlxOsMutex* me
+)
+{
+	// Variables
+	#if defined(ALX_FREE_RTOS)
+	me->semaphoreHandle = xSemaphoreCreateMutexStatic(&me->semaphore);
+	#endif
+	#if defined(ALX_ZEPHYR)
+	k_mutex_init(&me->mutex);	// Zephyr mutex always has priority inheritance
+	#endif
+
+	// Info
+	me->wasCtorCalled = true;
+}
+
 
 //******************************************************************************
 // Functions
@@ -100,6 +100,10 @@ void AlxOsMutex_Ctor
 (
 	AlxOsMutex* me
 );
+void AlxOsMutex_CtorPrioInherit
+(
+	AlxOsMutex* me
+);
 
 
 //******************************************************************************
@@ -86,6 +86,9 @@ void AlxParamGroup_Ctor
 	me->numOfParamItems = numOfParamItems;
 	me->initNumOfTries = initNumOfTries;
 
+	// Variables
+	me->isValChanged = true;
+
 	// Info
 	me->wasCtorCalled = true;
 	me->isInit = false;
@@ -116,7 +119,13 @@ Alx_Status AlxParamGroup_Init(AlxParamGroup* me)
 	{
 		// #2.1 Read memory
 		Alx_Status statusAlxMemSafeRead = Alx_Err;
+		while (AlxMemSafe_IsBusy(me->memSafe)) { AlxMemSafe_Handle(me->memSafe); }	// Non-blocking memory, finish operation in progress, so that read below is NOT rejected as busy
 		statusAlxMemSafeRead = AlxMemSafe_Read(me->memSafe, me->valStoredBuff, me->len);
+		if (AlxMemSafe_IsBusy(me->memSafe))	// Non-blocking memory, our read was started, init needs its result, so we handle it until done
+		{
+			while (AlxMemSafe_IsBusy(me->memSafe)) { AlxMemSafe_Handle(me->memSafe); }
+			statusAlxMemSafeRead = AlxMemSafe_IsReadDone(me->memSafe) ? AlxMemSafe_GetReadStatus(me->memSafe) : Alx_Err;
+		}
 		memcpy(me->valBuff, me->valStoredBuff, me->len);
 
 		// #2.2 Handle result
@@ -173,6 +182,11 @@ Alx_Status AlxParamGroup_Init(AlxParamGroup* me)
 
 				// Write
 				Alx_Status statusAlxMemSafeWrite = AlxMemSafe_Write(me->memSafe, me->valToStoreBuff, me->len);
+				if (AlxMemSafe_IsBusy(me->memSafe))	// Non-blocking memory, init needs the result, so we handle it until done
+				{
+					while (AlxMemSafe_IsBusy(me->memSafe)) { AlxMemSafe_Handle(me->memSafe); }
+					statusAlxMemSafeWrite = AlxMemSafe_IsWriteErr(me->memSafe) ? Alx_Err : Alx_Ok;
+				}
 				if (statusAlxMemSafeWrite != Alx_Ok)
 				{
 					// Trace
@@ -232,6 +246,20 @@ void AlxParamGroup_Write(AlxParamGroup* me)
 	AlxMemSafe_Write(me->memSafe, me->valToStoreBuff, me->len);
 }
 
+/**
+  * @brief			Handle non-blocking memory, does nothing if memory is blocking
+  * @param[in,out]	me
+  */
+void AlxParamGroup_Handle(AlxParamGroup* me)
+{
+	// Assert
+	ALX_PARAM_GROUP_ASSERT(me->wasCtorCalled == true);
+	ALX_PARAM_GROUP_ASSERT(me->isInit == true);
+
+	// #1 Handle
+	AlxMemSafe_Handle(me->memSafe);
+}
+
 /**
   * @brief
   * @param[in,out]	me
@@ -283,6 +311,37 @@ bool AlxParamGroup_IsValStoredBuffDiff(AlxParamGroup* me)
 		return false;
 }
 
+/**
+  * @brief			Check if any item value was changed since last AlxParamGroup_ParamItemsValToValBuff, without ALX_PARAM_GROUP_VAL_CHANGED_EVENT it always returns true, because values can also be changed through value pointers
+  * @param[in,out]	me
+  * @retval			false
+  * @retval			true
+  */
+bool AlxParamGroup_IsValChanged(AlxParamGroup* me)
+{
+	// Assert
+	ALX_PARAM_GROUP_ASSERT(me->wasCtorCalled == true);
+	ALX_PARAM_GROUP_ASSERT(me->isInit == true);
+
+	// #1 Return
+	#if defined(ALX_PARAM_GROUP_VAL_CHANGED_EVENT)
+	if (me->isValChanged)	// Values were not copied to value buffer yet
+	{
+		return true;
+	}
+	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	{
+		if (AlxParamItem_IsValChanged(*(me->paramItemArr + i)))
+		{
+			return true;
+		}
+	}
+	return false;
+	#else
+	return true;
+	#endif
+}
+
 /**
   * @brief
   * @param[in,out] me
@@ -319,20 +378,24 @@ void AlxParamGroup_ParamItemsValToValBuff(AlxParamGroup* me)
 {
 	// #1 Prepare variables
 	uint32_t valBuffIndex = 0;
+	me->isValChanged = false;
 
 	// #2 Copy
 	for (uint32_t i = 0; i < me->numOfParamItems; i++)
 	{
-		// #2.1 Get value pointer
+		// #2.1 Clear value changed before copy, so that value changed during copy raises it again
+		AlxParamItem_ClearValChanged(*(me->paramItemArr + i));
+
+		// #2.2 Get value pointer
 		void* valPtr = AlxParamItem_GetValPtr(*(me->paramItemArr + i));
 
-		// #2.2 Get value length
+		// #2.3 Get value length
 		uint32_t len = AlxParamItem_GetValLen(*(me->paramItemArr + i));
 
-		// #2.3 Copy
+		// #2.4 Copy
 		memcpy(&me->valBuff[valBuffIndex], valPtr, len);
 
-		// #2.4 Increment
+		// #2.5 Increment
 		valBuffIndex = valBuffIndex + len;
 	}
 }
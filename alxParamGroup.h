@@ -92,6 +92,9 @@ typedef struct
 	uint32_t numOfParamItems;
 	uint8_t initNumOfTries;
 
+	// Variables
+	bool isValChanged;
+
 	// Info
 	bool wasCtorCalled;
 	bool isInit;
@@ -121,9 +124,11 @@ void AlxParamGroup_Ctor
 //******************************************************************************
 Alx_Status AlxParamGroup_Init(AlxParamGroup* me);
 void AlxParamGroup_Write(AlxParamGroup* me);
+void AlxParamGroup_Handle(AlxParamGroup* me);
 bool AlxParamGroup_IsWriteDone(AlxParamGroup* me);
 bool AlxParamGroup_IsWriteErr(AlxParamGroup* me);
 bool AlxParamGroup_IsValStoredBuffDiff(AlxParamGroup* me);
+bool AlxParamGroup_IsValChanged(AlxParamGroup* me);
 void AlxParamGroup_ValBuffToValToStoreBuff(AlxParamGroup* me);
 void AlxParamGroup_ValToStoreBuffToValStoredBuff(AlxParamGroup* me);
 void AlxParamGroup_ParamItemsValToValBuff(AlxParamGroup* me);
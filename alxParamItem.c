@@ -1,4 +1,4 @@
-/**
+﻿/**
   ******************************************************************************
   * @file		alxParamItem.c
   * @brief		Auralix C Library - ALX Parameter Item Module
@@ -37,10 +37,50 @@
 #if defined(ALX_C_LIB)
 
 
+//******************************************************************************
+// Private Defines
+//******************************************************************************
+#define ALX_PARAM_ITEM_BIG_LEN 40	// Words, enough for exact double <-> decimal conversion (up to 2^55 * 10^324)
+
+
+//******************************************************************************
+// Private Types
+//******************************************************************************
+typedef struct
+{
+	uint32_t len;
+	uint32_t word[ALX_PARAM_ITEM_BIG_LEN];	// Little-endian, without leading zero words
+} AlxParamItem_Big;
+
+
+//******************************************************************************
+// Private Variables
+//******************************************************************************
+static const char alxParamItem_digitPairArr[200] =
+{
+	'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+	'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+	'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+	'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+	'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+	'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+	'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+	'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+	'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+	'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+static const double alxParamItem_pow10Arr[23] =
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
 //******************************************************************************
 // Private Functions
 //******************************************************************************
 
+#if !defined(ALX_PARAM_ITEM_DESC_CONST)
 /**
   * @brief
   * @param[in,out]	me
@@ -87,15 +127,86 @@ static void AlxParamItem_Ctor
 	uint8_t* buff,
 	uint32_t buffLen
 );
+#endif
 static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me);
 static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal);
 static void* AlxParamItem_GetValPtr_Private(AlxParamItem* me);
 static Alx_Status AlxParamItem_SetVal(AlxParamItem* me, void* val);
+static void AlxParamItem_ValChanged(AlxParamItem* me, void* valOld);
+static uint32_t AlxParamItem_Utoa(uint64_t val, char* str);
+static uint32_t AlxParamItem_Itoa(int64_t val, char* str);
+static uint32_t AlxParamItem_Dtoa(double val, char* str, bool isFloat);
+static Alx_Status AlxParamItem_Atou(const char* str, uint64_t valMax, uint64_t* val);
+static Alx_Status AlxParamItem_Atoi(const char* str, int64_t valMin, int64_t valMax, int64_t* val);
+static Alx_Status AlxParamItem_Atod(const char* str, double* val, bool isFloat);
+static double AlxParamItem_Pow10Scale(double val, int32_t exp10);
+static void AlxParamItem_FloatToBin(double val, bool isFloat, uint64_t* mant, int32_t* exp2);
+static double AlxParamItem_BinToFloat(uint64_t mant, int32_t exp2, bool isFloat);
+static int32_t AlxParamItem_CmpDecBin(const char* digits, int32_t exp10, uint64_t binMant, int32_t exp2);
+static void AlxParamItem_Big_Set(AlxParamItem_Big* me, uint64_t val);
+static void AlxParamItem_Big_MulAdd(AlxParamItem_Big* me, uint32_t mul, uint32_t add);
+static void AlxParamItem_Big_MulPow10(AlxParamItem_Big* me, uint32_t exp10);
+static void AlxParamItem_Big_ShiftLeft(AlxParamItem_Big* me, uint32_t exp2);
+static void AlxParamItem_Big_Add(AlxParamItem_Big* me, const AlxParamItem_Big* val);
+static void AlxParamItem_Big_Sub(AlxParamItem_Big* me, const AlxParamItem_Big* val);
+static int32_t AlxParamItem_Big_Cmp(const AlxParamItem_Big* a, const AlxParamItem_Big* b);
 
 
 //******************************************************************************
 // Constructor
 //******************************************************************************
+void AlxParamItem_CtorDesc
+(
+	AlxParamItem* me,
+	const AlxParamItem_Desc* desc,
+	AlxParamKvStore* paramKvStore
+)
+{
+	// Parameters
+	me->desc = desc;
+	me->paramKvStore = paramKvStore;
+
+	// Variables
+	if (desc->dataType == AlxParamItem_Arr)
+	{
+		me->val.arr = desc->buff;
+		me->valLen = desc->valLen;
+		memcpy(me->val.arr, desc->valDef.arr, me->valLen);	// Copy default value from descriptor to buffer
+	}
+	else if (desc->dataType == AlxParamItem_Str)
+	{
+		ALX_PARAM_ITEM_ASSERT(strlen(desc->valDef.str) < desc->buffLen);
+		ALX_PARAM_ITEM_ASSERT(desc->buffLen <= ALX_PARAM_ITEM_BUFF_LEN);
+		me->val.str = (char*)desc->buff;
+		me->valLen = strlen(desc->valDef.str) + 1;	// Add +1 for null terminator
+		strcpy(me->val.str, desc->valDef.str);	// Copy default value from descriptor to buffer
+	}
+	else
+	{
+		me->valLen = desc->valLen;
+		memcpy(&me->val, &desc->valDef, me->valLen);
+	}
+	me->pendingStore = false;
+	me->valChanged = false;
+	me->ownerIndex = 0;
+	me->owner = NULL;
+
+	// Check if enum
+	if (desc->enumArr != ALX_NULL)
+	{
+		// Check if enum array value are from low to high
+		ALX_PARAM_ITEM_ASSERT(AlxParamItem_AreEnumArrValFromLowToHigh(me) == true);
+
+		// Check if enum number is on the list
+		ALX_PARAM_ITEM_ASSERT(AlxParamItem_IsEnumOnList(me, (void*)&desc->valDef) == true);
+		ALX_PARAM_ITEM_ASSERT(AlxParamItem_IsEnumOnList(me, (void*)&desc->valMin) == true);
+		ALX_PARAM_ITEM_ASSERT(AlxParamItem_IsEnumOnList(me, (void*)&desc->valMax) == true);
+	}
+
+	// Info
+	me->wasCtorCalled = true;
+}
+#if !defined(ALX_PARAM_ITEM_DESC_CONST)
 void AlxParamItem_CtorUint8
 (
 	AlxParamItem* me,
@@ -551,25 +662,31 @@ void AlxParamItem_CtorBool
 )
 {
 	// Parameters
-	me->dataType = AlxParamItem_Bool;
+	me->desc = &me->descRam;
+	me->descRam.dataType = AlxParamItem_Bool;
 	me->paramKvStore = paramKvStore;
-	me->paramType = paramType;
-	me->key = key;
-	me->id = id;
-	me->groupKey = groupKey;
-	me->groupId = groupId;
-	me->valDef._bool = valDef;
-	me->valMin._bool = ALX_NULL;
-	me->valMax._bool = ALX_NULL;
-	me->valLen = sizeof(bool);
-	me->valOutOfRangeHandle = ALX_NULL;
-	me->valUnit = valUnit;
-	me->valChangeTakesEffectAfterReset = valChangeTakesEffectAfterReset;
-	me->buff = ALX_NULL_PTR;
-	me->buffLen = ALX_NULL;
+	me->descRam.paramType = paramType;
+	me->descRam.key = key;
+	me->descRam.id = id;
+	me->descRam.groupKey = groupKey;
+	me->descRam.groupId = groupId;
+	me->descRam.valDef._bool = valDef;
+	me->descRam.valMin._bool = ALX_NULL;
+	me->descRam.valMax._bool = ALX_NULL;
+	me->descRam.valLen = sizeof(bool);
+	me->descRam.valOutOfRangeHandle = ALX_NULL;
+	me->descRam.valUnit = valUnit;
+	me->descRam.valChangeTakesEffectAfterReset = valChangeTakesEffectAfterReset;
+	me->descRam.buff = ALX_NULL_PTR;
+	me->descRam.buffLen = ALX_NULL;
 
 	// Variables
+	me->valLen = me->descRam.valLen;
 	me->val._bool = valDef;
+	me->pendingStore = false;
+	me->valChanged = false;
+	me->ownerIndex = 0;
+	me->owner = NULL;
 
 	// Info
 	me->wasCtorCalled = true;
@@ -593,25 +710,31 @@ void AlxParamItem_CtorArr
 )
 {
 	// Parameters
-	me->dataType = AlxParamItem_Arr;
+	me->desc = &me->descRam;
+	me->descRam.dataType = AlxParamItem_Arr;
 	me->paramKvStore = paramKvStore;
-	me->paramType = paramType;
-	me->key = key;
-	me->id = id;
-	me->groupKey = groupKey;
-	me->groupId = groupId;
+	me->descRam.paramType = paramType;
+	me->descRam.key = key;
+	me->descRam.id = id;
+	me->descRam.groupKey = groupKey;
+	me->descRam.groupId = groupId;
 	me->val.arr = valBuff;
-	me->valDef.arr = valDefBuff;
-	me->valMin.arr = ALX_NULL_PTR;
-	me->valMax.arr = ALX_NULL_PTR;
-	me->valLen = valBuffLen;
-	me->valOutOfRangeHandle = valOutOfRangeHandle;
-	me->valUnit = valUnit;
-	me->valChangeTakesEffectAfterReset = valChangeTakesEffectAfterReset;
+	me->descRam.valDef.arr = valDefBuff;
+	me->descRam.valMin.arr = ALX_NULL_PTR;
+	me->descRam.valMax.arr = ALX_NULL_PTR;
+	me->descRam.valLen = valBuffLen;
+	me->descRam.valOutOfRangeHandle = valOutOfRangeHandle;
+	me->descRam.valUnit = valUnit;
+	me->descRam.valChangeTakesEffectAfterReset = valChangeTakesEffectAfterReset;
 
 	// Variables
-	memcpy(me->valDef.arr, valDef, me->valLen);			// Copy default value to default value buffer
-	memcpy(me->val.arr, me->valDef.arr, me->valLen);	// Copy default value buffer to main buffer
+	me->valLen = me->descRam.valLen;
+	memcpy(me->descRam.valDef.arr, valDef, me->valLen);			// Copy default value to default value buffer
+	memcpy(me->val.arr, me->descRam.valDef.arr, me->valLen);	// Copy default value buffer to main buffer
+	me->pendingStore = false;
+	me->valChanged = false;
+	me->ownerIndex = 0;
+	me->owner = NULL;
 
 	// Info
 	me->wasCtorCalled = true;
@@ -635,33 +758,40 @@ void AlxParamItem_CtorStr
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(strlen(valDef) < buffLen);
+	ALX_PARAM_ITEM_ASSERT(buffLen <= ALX_PARAM_ITEM_BUFF_LEN);
 
 	// Parameters
-	me->dataType = AlxParamItem_Str;
+	me->desc = &me->descRam;
+	me->descRam.dataType = AlxParamItem_Str;
 	me->paramKvStore = paramKvStore;
-	me->paramType = paramType;
-	me->key = key;
-	me->id = id;
-	me->groupKey = groupKey;
-	me->groupId = groupId;
-	me->valDef.str = (char*)valDef;
-	me->valMin.str = ALX_NULL_PTR;
-	me->valMax.str = ALX_NULL_PTR;
-	me->valLen = strlen(valDef) + 1;	// Add +1 for null terminator
-	me->valOutOfRangeHandle = valOutOfRangeHandle;
-	me->valUnit = valUnit;
-	me->valChangeTakesEffectAfterReset = valChangeTakesEffectAfterReset;
-	me->buff = buff;
-	me->buffLen = buffLen;
+	me->descRam.paramType = paramType;
+	me->descRam.key = key;
+	me->descRam.id = id;
+	me->descRam.groupKey = groupKey;
+	me->descRam.groupId = groupId;
+	me->descRam.valDef.str = (char*)valDef;
+	me->descRam.valMin.str = ALX_NULL_PTR;
+	me->descRam.valMax.str = ALX_NULL_PTR;
+	me->descRam.valLen = strlen(valDef) + 1;	// Add +1 for null terminator
+	me->descRam.valOutOfRangeHandle = valOutOfRangeHandle;
+	me->descRam.valUnit = valUnit;
+	me->descRam.valChangeTakesEffectAfterReset = valChangeTakesEffectAfterReset;
+	me->descRam.buff = buff;
+	me->descRam.buffLen = buffLen;
 
 	// Variables
+	me->valLen = me->descRam.valLen;
 	me->val.str = (char*)buff;
 	strcpy((char*)buff, valDef);	// Copy default value to buffer
 	me->pendingStore = false;
+	me->valChanged = false;
+	me->ownerIndex = 0;
+	me->owner = NULL;
 
 	// Info
 	me->wasCtorCalled = true;
 }
+#endif
 
 
 //******************************************************************************
@@ -695,7 +825,7 @@ AlxParamItem_DataType AlxParamItem_GetDataType(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->dataType;
+	return me->desc->dataType;
 }
 
 /**
@@ -713,7 +843,7 @@ AlxParamItem_ParamType AlxParamItem_GetParamType(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->paramType;
+	return me->desc->paramType;
 }
 
 /**
@@ -727,7 +857,7 @@ const char* AlxParamItem_GetKey(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->key;
+	return me->desc->key;
 }
 
 /**
@@ -741,7 +871,7 @@ uint32_t AlxParamItem_GetId(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->id;
+	return me->desc->id;
 }
 
 /**
@@ -755,7 +885,7 @@ const char* AlxParamItem_GetGroupKey(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->groupKey;
+	return me->desc->groupKey;
 }
 
 /**
@@ -769,7 +899,7 @@ uint32_t AlxParamItem_GetGroupId(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->groupId;
+	return me->desc->groupId;
 }
 
 /**
@@ -799,7 +929,7 @@ AlxParamItem_ValOutOfRangeHandle AlxParamItem_GetValOutOfRangeHandle(AlxParamIte
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->valOutOfRangeHandle;
+	return me->desc->valOutOfRangeHandle;
 }
 
 /**
@@ -813,7 +943,7 @@ const char* AlxParamItem_GetValUnit(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->valUnit;
+	return me->desc->valUnit;
 }
 
 /**
@@ -827,7 +957,7 @@ bool AlxParamItem_GetValChangeTakesEffectAfterReset(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->valChangeTakesEffectAfterReset;
+	return me->desc->valChangeTakesEffectAfterReset;
 }
 
 /**
@@ -841,7 +971,21 @@ uint32_t AlxParamItem_GetBuffLen(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->buffLen;
+	return me->desc->buffLen;
+}
+
+/**
+  * @brief
+  * @param[in,out]	me
+  * @return
+  */
+AlxParamKvStore* AlxParamItem_GetParamKvStore(AlxParamItem* me)
+{
+	// Assert
+	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
+
+	// Return
+	return me->paramKvStore;
 }
 
 /**
@@ -871,7 +1015,7 @@ uint8_t AlxParamItem_GetValUint8(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint8);
 
 	// Return
 	return me->val.uint8;
@@ -886,7 +1030,7 @@ uint16_t AlxParamItem_GetValUint16(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint16);
 
 	// Return
 	return me->val.uint16;
@@ -901,7 +1045,7 @@ uint32_t AlxParamItem_GetValUint32(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint32);
 
 	// Return
 	return me->val.uint32;
@@ -916,7 +1060,7 @@ uint64_t AlxParamItem_GetValUint64(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint64);
 
 	// Return
 	return me->val.uint64;
@@ -931,7 +1075,7 @@ int8_t AlxParamItem_GetValInt8(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int8);
 
 	// Return
 	return me->val.int8;
@@ -946,7 +1090,7 @@ int16_t AlxParamItem_GetValInt16(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int16);
 
 	// Return
 	return me->val.int16;
@@ -961,7 +1105,7 @@ int32_t AlxParamItem_GetValInt32(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int32);
 
 	// Return
 	return me->val.int32;
@@ -976,7 +1120,7 @@ int64_t AlxParamItem_GetValInt64(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int64);
 
 	// Return
 	return me->val.int64;
@@ -991,7 +1135,7 @@ float AlxParamItem_GetValFloat(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Float);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Float);
 
 	// Return
 	return me->val._float;
@@ -1006,7 +1150,7 @@ double AlxParamItem_GetValDouble(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Double);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Double);
 
 	// Return
 	return me->val._double;
@@ -1022,7 +1166,7 @@ bool AlxParamItem_GetValBool(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Bool);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Bool);
 
 	// Return
 	return me->val._bool;
@@ -1037,7 +1181,7 @@ void AlxParamItem_GetValArr(AlxParamItem* me, void* val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Arr);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Arr);
 
 	// Copy
 	memcpy(val, me->val.arr, me->valLen);
@@ -1055,7 +1199,7 @@ Alx_Status AlxParamItem_GetValStr(AlxParamItem* me, char* val, uint32_t maxLenWi
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Str);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Str);
 
 	// Check & Copy if OK
 	Alx_Status status = AlxRange_CheckStr(me->val.str, maxLenWithNullTerm);
@@ -1084,7 +1228,7 @@ Alx_Status AlxParamItem_SetValUint8(AlxParamItem* me, uint8_t val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint8);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1101,7 +1245,7 @@ Alx_Status AlxParamItem_SetValUint16(AlxParamItem* me, uint16_t val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint16);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1118,7 +1262,7 @@ Alx_Status AlxParamItem_SetValUint32(AlxParamItem* me, uint32_t val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint32);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1135,7 +1279,7 @@ Alx_Status AlxParamItem_SetValUint64(AlxParamItem* me, uint64_t val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint64);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1152,7 +1296,7 @@ Alx_Status AlxParamItem_SetValInt8(AlxParamItem* me, int8_t val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int8);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1169,7 +1313,7 @@ Alx_Status AlxParamItem_SetValInt16(AlxParamItem* me, int16_t val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int16);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1186,7 +1330,7 @@ Alx_Status AlxParamItem_SetValInt32(AlxParamItem* me, int32_t val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int32);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1203,7 +1347,7 @@ Alx_Status AlxParamItem_SetValInt64(AlxParamItem* me, int64_t val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int64);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1220,7 +1364,7 @@ Alx_Status AlxParamItem_SetValFloat(AlxParamItem* me, float val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Float);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Float);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1237,7 +1381,7 @@ Alx_Status AlxParamItem_SetValDouble(AlxParamItem* me, double val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Double);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Double);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1254,7 +1398,7 @@ Alx_Status AlxParamItem_SetValBool(AlxParamItem* me, bool val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Bool);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Bool);
 
 	// Set
 	return AlxParamItem_SetVal(me, &val);
@@ -1269,10 +1413,10 @@ void AlxParamItem_SetValArr(AlxParamItem* me, void* val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Arr);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Arr);
 
 	// Set
-	memcpy(me->val.arr, val, me->valLen);
+	AlxParamItem_SetValRaw(me, val);
 }
 
 /**
@@ -1286,12 +1430,118 @@ Alx_Status AlxParamItem_SetValStr(AlxParamItem* me, char* val)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Str);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Str);
 
 	// Set
 	return AlxParamItem_SetVal(me, val);
 }
 
+/**
+  * @brief			Copy valLen bytes to value without range check, used instead of writing through value pointer, so that change is tracked
+  * @param[in,out]	me
+  * @param[in]		val
+  */
+void AlxParamItem_SetValRaw(AlxParamItem* me, void* val)
+{
+	// Assert
+	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
+
+	// Get value pointer
+	void* valPtr = AlxParamItem_GetValPtr_Private(me);
+
+	// Set, if changed, old value is kept for callback, same as in AlxParamItem_SetVal, only Arr can be longer than ALX_PARAM_ITEM_BUFF_LEN
+	if (memcmp(valPtr, val, me->valLen) != 0)
+	{
+		uint8_t valOld[ALX_PARAM_ITEM_BUFF_LEN];
+		bool isValOld = (me->owner != NULL) && (me->valLen <= sizeof(valOld));
+		if (isValOld)
+		{
+			memcpy(valOld, valPtr, me->valLen);
+		}
+		memcpy(valPtr, val, me->valLen);
+		AlxParamItem_ValChanged(me, isValOld ? valOld : NULL);
+	}
+}
+
+/**
+  * @brief			Check value against enum list and min/max without setting it, regardless of valOutOfRangeHandle, val does not have to be aligned
+  * @param[in,out]	me
+  * @param[in]		val
+  * @retval			Alx_Ok
+  * @retval			Alx_Err
+  * @retval			AlxParamItem_ErrEnum
+  */
+Alx_Status AlxParamItem_CheckVal(AlxParamItem* me, void* val)
+{
+	// Assert
+	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
+
+	// Local variables
+	AlxParamItem_Val _val = {};
+
+	// Copy, so that value is aligned
+	if ((me->desc->dataType != AlxParamItem_Arr) && (me->desc->dataType != AlxParamItem_Str))
+	{
+		memcpy(&_val, val, me->valLen);
+	}
+
+	// Check enum
+	if ((me->desc->enumArr != NULL) && (AlxParamItem_IsEnumOnList(me, &_val) == false))
+	{
+		return AlxParamItem_ErrEnum;
+	}
+
+	// Check range
+	if (me->desc->dataType == AlxParamItem_Uint8)
+	{
+		return AlxRange_CheckUint8(_val.uint8, me->desc->valMin.uint8, me->desc->valMax.uint8);
+	}
+	else if (me->desc->dataType == AlxParamItem_Uint16)
+	{
+		return AlxRange_CheckUint16(_val.uint16, me->desc->valMin.uint16, me->desc->valMax.uint16);
+	}
+	else if (me->desc->dataType == AlxParamItem_Uint32)
+	{
+		return AlxRange_CheckUint32(_val.uint32, me->desc->valMin.uint32, me->desc->valMax.uint32);
+	}
+	else if (me->desc->dataType == AlxParamItem_Uint64)
+	{
+		return AlxRange_CheckUint64(_val.uint64, me->desc->valMin.uint64, me->desc->valMax.uint64);
+	}
+	else if (me->desc->dataType == AlxParamItem_Int8)
+	{
+		return AlxRange_CheckInt8(_val.int8, me->desc->valMin.int8, me->desc->valMax.int8);
+	}
+	else if (me->desc->dataType == AlxParamItem_Int16)
+	{
+		return AlxRange_CheckInt16(_val.int16, me->desc->valMin.int16, me->desc->valMax.int16);
+	}
+	else if (me->desc->dataType == AlxParamItem_Int32)
+	{
+		return AlxRange_CheckInt32(_val.int32, me->desc->valMin.int32, me->desc->valMax.int32);
+	}
+	else if (me->desc->dataType == AlxParamItem_Int64)
+	{
+		return AlxRange_CheckInt64(_val.int64, me->desc->valMin.int64, me->desc->valMax.int64);
+	}
+	else if (me->desc->dataType == AlxParamItem_Float)
+	{
+		return AlxRange_CheckFloat(_val._float, me->desc->valMin._float, me->desc->valMax._float);
+	}
+	else if (me->desc->dataType == AlxParamItem_Double)
+	{
+		return AlxRange_CheckDouble(_val._double, me->desc->valMin._double, me->desc->valMax._double);
+	}
+	else if (me->desc->dataType == AlxParamItem_Str)
+	{
+		return AlxRange_CheckStr((char*)val, me->desc->buffLen);
+	}
+	else
+	{
+		return Alx_Ok;	// Bool & Arr have no range
+	}
+}
+
 
 //------------------------------------------------------------------------------
 // Default / Min / Max
@@ -1302,60 +1552,60 @@ void AlxParamItem_SetValToDef(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Local variables
-	void* valDefPtr = NULL;
+	const void* valDefPtr = NULL;	// Descriptor can be in flash
 
 	// Prepare
-	if (me->dataType == AlxParamItem_Uint8)
+	if (me->desc->dataType == AlxParamItem_Uint8)
 	{
-		valDefPtr = &me->valDef.uint8;
+		valDefPtr = &me->desc->valDef.uint8;
 	}
-	else if (me->dataType == AlxParamItem_Uint16)
+	else if (me->desc->dataType == AlxParamItem_Uint16)
 	{
-		valDefPtr = &me->valDef.uint16;
+		valDefPtr = &me->desc->valDef.uint16;
 	}
-	else if (me->dataType == AlxParamItem_Uint32)
+	else if (me->desc->dataType == AlxParamItem_Uint32)
 	{
-		valDefPtr = &me->valDef.uint32;
+		valDefPtr = &me->desc->valDef.uint32;
 	}
-	else if (me->dataType == AlxParamItem_Uint64)
+	else if (me->desc->dataType == AlxParamItem_Uint64)
 	{
-		valDefPtr = &me->valDef.uint64;
+		valDefPtr = &me->desc->valDef.uint64;
 	}
-	else if (me->dataType == AlxParamItem_Int8)
+	else if (me->desc->dataType == AlxParamItem_Int8)
 	{
-		valDefPtr = &me->valDef.int8;
+		valDefPtr = &me->desc->valDef.int8;
 	}
-	else if (me->dataType == AlxParamItem_Int16)
+	else if (me->desc->dataType == AlxParamItem_Int16)
 	{
-		valDefPtr = &me->valDef.int16;
+		valDefPtr = &me->desc->valDef.int16;
 	}
-	else if (me->dataType == AlxParamItem_Int32)
+	else if (me->desc->dataType == AlxParamItem_Int32)
 	{
-		valDefPtr = &me->valDef.int32;
+		valDefPtr = &me->desc->valDef.int32;
 	}
-	else if (me->dataType == AlxParamItem_Int64)
+	else if (me->desc->dataType == AlxParamItem_Int64)
 	{
-		valDefPtr = &me->valDef.int64;
+		valDefPtr = &me->desc->valDef.int64;
 	}
-	else if (me->dataType == AlxParamItem_Float)
+	else if (me->desc->dataType == AlxParamItem_Float)
 	{
-		valDefPtr = &me->valDef._float;
+		valDefPtr = &me->desc->valDef._float;
 	}
-	else if (me->dataType == AlxParamItem_Double)
+	else if (me->desc->dataType == AlxParamItem_Double)
 	{
-		valDefPtr = &me->valDef._double;
+		valDefPtr = &me->desc->valDef._double;
 	}
-	else if (me->dataType == AlxParamItem_Bool)
+	else if (me->desc->dataType == AlxParamItem_Bool)
 	{
-		valDefPtr = &me->valDef._bool;
+		valDefPtr = &me->desc->valDef._bool;
 	}
-	else if (me->dataType == AlxParamItem_Arr)
+	else if (me->desc->dataType == AlxParamItem_Arr)
 	{
 		ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 	}
-	else if (me->dataType == AlxParamItem_Str)
+	else if (me->desc->dataType == AlxParamItem_Str)
 	{
-		valDefPtr =  me->valDef.str;
+		valDefPtr =  me->desc->valDef.str;
 	}
 	else
 	{
@@ -1363,304 +1613,304 @@ void AlxParamItem_SetValToDef(AlxParamItem* me)
 	}
 
 	// Set
-	ALX_PARAM_ITEM_ASSERT(AlxParamItem_SetVal(me, valDefPtr) == Alx_Ok);
+	ALX_PARAM_ITEM_ASSERT(AlxParamItem_SetVal(me, (void*)valDefPtr) == Alx_Ok);
 }
 uint8_t AlxParamItem_GetValDefUint8(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint8);
 
 	// Return
-	return me->valDef.uint8;
+	return me->desc->valDef.uint8;
 }
 uint16_t AlxParamItem_GetValDefUint16(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint16);
 
 	// Return
-	return me->valDef.uint16;
+	return me->desc->valDef.uint16;
 }
 uint32_t AlxParamItem_GetValDefUint32(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint32);
 
 	// Return
-	return me->valDef.uint32;
+	return me->desc->valDef.uint32;
 }
 uint64_t AlxParamItem_GetValDefUint64(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint64);
 
 	// Return
-	return me->valDef.uint64;
+	return me->desc->valDef.uint64;
 }
 int8_t AlxParamItem_GetValDefInt8(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int8);
 
 	// Return
-	return me->valDef.int8;
+	return me->desc->valDef.int8;
 }
 int16_t AlxParamItem_GetValDefInt16(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int16);
 
 	// Return
-	return me->valDef.int16;
+	return me->desc->valDef.int16;
 }
 int32_t AlxParamItem_GetValDefInt32(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int32);
 
 	// Return
-	return me->valDef.int32;
+	return me->desc->valDef.int32;
 }
 int64_t AlxParamItem_GetValDefInt64(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int64);
 
 	// Return
-	return me->valDef.int64;
+	return me->desc->valDef.int64;
 }
 float AlxParamItem_GetValDefFloat(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Float);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Float);
 
 	// Return
-	return me->valDef._float;
+	return me->desc->valDef._float;
 }
 double AlxParamItem_GetValDefDouble(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Double);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Double);
 
 	// Return
-	return me->valDef._double;
+	return me->desc->valDef._double;
 }
 bool AlxParamItem_GetValDefBool(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Bool);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Bool);
 
 	// Return
-	return me->valDef._bool;
+	return me->desc->valDef._bool;
 }
 void* AlxParamItem_GetValDefArr(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Arr);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Arr);
 
 	// Return
-	return me->valDef.arr;
+	return me->desc->valDef.arr;
 }
 const char* AlxParamItem_GetValDefStr(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Str);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Str);
 
 	// Return
-	return me->valDef.str;
+	return me->desc->valDef.str;
 }
 uint8_t AlxParamItem_GetValMinUint8(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint8);
 
 	// Return
-	return me->valMin.uint8;
+	return me->desc->valMin.uint8;
 }
 uint16_t AlxParamItem_GetValMinUint16(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint16);
 
 	// Return
-	return me->valMin.uint16;
+	return me->desc->valMin.uint16;
 }
 uint32_t AlxParamItem_GetValMinUint32(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint32);
 
 	// Return
-	return me->valMin.uint32;
+	return me->desc->valMin.uint32;
 }
 uint64_t AlxParamItem_GetValMinUint64(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint64);
 
 	// Return
-	return me->valMin.uint64;
+	return me->desc->valMin.uint64;
 }
 int8_t AlxParamItem_GetValMinInt8(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int8);
 
 	// Return
-	return me->valMin.int8;
+	return me->desc->valMin.int8;
 }
 int16_t AlxParamItem_GetValMinInt16(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int16);
 
 	// Return
-	return me->valMin.int16;
+	return me->desc->valMin.int16;
 }
 int32_t AlxParamItem_GetValMinInt32(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int32);
 
 	// Return
-	return me->valMin.int32;
+	return me->desc->valMin.int32;
 }
 int64_t AlxParamItem_GetValMinInt64(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int64);
 
 	// Return
-	return me->valMin.int64;
+	return me->desc->valMin.int64;
 }
 float AlxParamItem_GetValMinFloat(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Float);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Float);
 
 	// Return
-	return me->valMin._float;
+	return me->desc->valMin._float;
 }
 double AlxParamItem_GetValMinDouble(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Double);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Double);
 
 	// Return
-	return me->valMin._double;
+	return me->desc->valMin._double;
 }
 uint8_t AlxParamItem_GetValMaxUint8(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint8);
 
 	// Return
-	return me->valMax.uint8;
+	return me->desc->valMax.uint8;
 }
 uint16_t AlxParamItem_GetValMaxUint16(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint16);
 
 	// Return
-	return me->valMax.uint16;
+	return me->desc->valMax.uint16;
 }
 uint32_t AlxParamItem_GetValMaxUint32(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint32);
 
 	// Return
-	return me->valMax.uint32;
+	return me->desc->valMax.uint32;
 }
 uint64_t AlxParamItem_GetValMaxUint64(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint64);
 
 	// Return
-	return me->valMax.uint64;
+	return me->desc->valMax.uint64;
 }
 int8_t AlxParamItem_GetValMaxInt8(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int8);
 
 	// Return
-	return me->valMax.int8;
+	return me->desc->valMax.int8;
 }
 int16_t AlxParamItem_GetValMaxInt16(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int16);
 
 	// Return
-	return me->valMax.int16;
+	return me->desc->valMax.int16;
 }
 int32_t AlxParamItem_GetValMaxInt32(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int32);
 
 	// Return
-	return me->valMax.int32;
+	return me->desc->valMax.int32;
 }
 int64_t AlxParamItem_GetValMaxInt64(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int64);
 
 	// Return
-	return me->valMax.int64;
+	return me->desc->valMax.int64;
 }
 float AlxParamItem_GetValMaxFloat(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Float);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Float);
 
 	// Return
-	return me->valMax._float;
+	return me->desc->valMax._float;
 }
 double AlxParamItem_GetValMaxDouble(AlxParamItem* me)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Double);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Double);
 
 	// Return
-	return me->valMax._double;
+	return me->desc->valMax._double;
 }
 
 
@@ -1673,137 +1923,137 @@ bool AlxParamItem_GetIsEnum(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
 
 	// Return
-	return me->isEnum;
+	return me->desc->isEnum;
 }
 void AlxParamItem_GetEnumArrUint8(AlxParamItem* me, uint8_t** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint8);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (uint8_t*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (uint8_t*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrUint16(AlxParamItem* me, uint16_t** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint16);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (uint16_t*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (uint16_t*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrUint32(AlxParamItem* me, uint32_t** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint32);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (uint32_t*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (uint32_t*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrUint64(AlxParamItem* me, uint64_t** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Uint64);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Uint64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (uint64_t*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (uint64_t*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrInt8(AlxParamItem* me, int8_t** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int8);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int8);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (int8_t*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (int8_t*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrInt16(AlxParamItem* me, int16_t** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int16);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int16);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (int16_t*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (int16_t*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrInt32(AlxParamItem* me, int32_t** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int32);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int32);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (int32_t*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (int32_t*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrInt64(AlxParamItem* me, int64_t** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Int64);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Int64);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (int64_t*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (int64_t*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrFloat(AlxParamItem* me, float** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Float);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Float);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (float*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (float*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 void AlxParamItem_GetEnumArrDouble(AlxParamItem* me, double** enumArr, uint8_t* enumArrLen)
 {
 	// Assert
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_ITEM_ASSERT(me->dataType == AlxParamItem_Double);
-	ALX_PARAM_ITEM_ASSERT(me->isEnum == true);
-	ALX_PARAM_ITEM_ASSERT(me->enumArr != NULL);
-	ALX_PARAM_ITEM_ASSERT(me->enumArrLen != 0);
+	ALX_PARAM_ITEM_ASSERT(me->desc->dataType == AlxParamItem_Double);
+	ALX_PARAM_ITEM_ASSERT(me->desc->isEnum == true);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArr != NULL);
+	ALX_PARAM_ITEM_ASSERT(me->desc->enumArrLen != 0);
 
 	// Return
-	*enumArr = (double*)me->enumArr;
-	*enumArrLen = me->enumArrLen;
+	*enumArr = (double*)me->desc->enumArr;
+	*enumArrLen = me->desc->enumArrLen;
 }
 
 
@@ -1825,7 +2075,7 @@ Alx_Status AlxParamItem_GetVal_StrFormat(AlxParamItem* me, char* val, uint32_t m
 	// Assert
 	//------------------------------------------------------------------------------
 	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
-	if (me->dataType != AlxParamItem_Str)
+	if (me->desc->dataType != AlxParamItem_Str)
 	{
 		ALX_PARAM_ITEM_ASSERT(maxLenWithNullTerm <= ALX_PARAM_ITEM_BUFF_LEN);
 	}
@@ -1845,7 +2095,7 @@ Alx_Status AlxParamItem_GetVal_StrFormat(AlxParamItem* me, char* val, uint32_t m
 	// Handle String
 	//------------------------------------------------------------------------------
 	//------------------------------------------------------------------------------
-	if (me->dataType == AlxParamItem_Str)
+	if (me->desc->dataType == AlxParamItem_Str)
 	{
 		// Check
 		status = AlxRange_CheckStr(me->val.str, maxLenWithNullTerm);
@@ -1874,47 +2124,47 @@ Alx_Status AlxParamItem_GetVal_StrFormat(AlxParamItem* me, char* val, uint32_t m
 	//------------------------------------------------------------------------------
 	// Convert
 	//------------------------------------------------------------------------------
-	if (me->dataType == AlxParamItem_Uint8)
+	if (me->desc->dataType == AlxParamItem_Uint8)
 	{
-		ALX_PARAM_ITEM_ASSERT(sprintf(valStr, "%u", me->val.uint8) >= 0);
+		AlxParamItem_Utoa(me->val.uint8, valStr);
 	}
-	else if (me->dataType == AlxParamItem_Uint16)
+	else if (me->desc->dataType == AlxParamItem_Uint16)
 	{
-		ALX_PARAM_ITEM_ASSERT(sprintf(valStr, "%hu", me->val.uint16) >= 0);
+		AlxParamItem_Utoa(me->val.uint16, valStr);
 	}
-	else if (me->dataType == AlxParamItem_Uint32)
+	else if (me->desc->dataType == AlxParamItem_Uint32)
 	{
-		ALX_PARAM_ITEM_ASSERT(sprintf(valStr, "%lu", me->val.uint32) >= 0);
+		AlxParamItem_Utoa(me->val.uint32, valStr);
 	}
-	else if (me->dataType == AlxParamItem_Uint64)
+	else if (me->desc->dataType == AlxParamItem_Uint64)
 	{
-		ALX_PARAM_ITEM_ASSERT(false);	// TV: TODO
+		AlxParamItem_Utoa(me->val.uint64, valStr);
 	}
-	else if (me->dataType == AlxParamItem_Int8)
+	else if (me->desc->dataType == AlxParamItem_Int8)
 	{
-		ALX_PARAM_ITEM_ASSERT(sprintf(valStr, "%d", me->val.int8) >= 0);
+		AlxParamItem_Itoa(me->val.int8, valStr);
 	}
-	else if (me->dataType == AlxParamItem_Int16)
+	else if (me->desc->dataType == AlxParamItem_Int16)
 	{
-		ALX_PARAM_ITEM_ASSERT(sprintf(valStr, "%hd", me->val.int16) >= 0);
+		AlxParamItem_Itoa(me->val.int16, valStr);
 	}
-	else if (me->dataType == AlxParamItem_Int32)
+	else if (me->desc->dataType == AlxParamItem_Int32)
 	{
-		ALX_PARAM_ITEM_ASSERT(sprintf(valStr, "%ld", me->val.int32) >= 0);
+		AlxParamItem_Itoa(me->val.int32, valStr);
 	}
-	else if (me->dataType == AlxParamItem_Int64)
+	else if (me->desc->dataType == AlxParamItem_Int64)
 	{
-		ALX_PARAM_ITEM_ASSERT(false);	// TV: TODO
+		AlxParamItem_Itoa(me->val.int64, valStr);
 	}
-	else if (me->dataType == AlxParamItem_Float)
+	else if (me->desc->dataType == AlxParamItem_Float)
 	{
-		AlxFtoa(me->val._float, valStr, ALX_PARAM_ITEM_FTOA_PRECISION);
+		AlxParamItem_Dtoa(me->val._float, valStr, true);
 	}
-	else if (me->dataType == AlxParamItem_Double)
+	else if (me->desc->dataType == AlxParamItem_Double)
 	{
-		ALX_PARAM_ITEM_ASSERT(false);	// TV: TODO
+		AlxParamItem_Dtoa(me->val._double, valStr, false);
 	}
-	else if (me->dataType == AlxParamItem_Bool)
+	else if (me->desc->dataType == AlxParamItem_Bool)
 	{
 		if (me->val._bool)
 		{
@@ -1925,11 +2175,11 @@ Alx_Status AlxParamItem_GetVal_StrFormat(AlxParamItem* me, char* val, uint32_t m
 			strcpy(valStr, "false");
 		}
 	}
-	else if (me->dataType == AlxParamItem_Arr)
+	else if (me->desc->dataType == AlxParamItem_Arr)
 	{
 		ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 	}
-	else if (me->dataType == AlxParamItem_Str)
+	else if (me->desc->dataType == AlxParamItem_Str)
 	{
 		ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 	}
@@ -1985,101 +2235,119 @@ Alx_Status AlxParamItem_SetVal_StrFormat(AlxParamItem* me, char* val)
 	//------------------------------------------------------------------------------
 	// Convert
 	//------------------------------------------------------------------------------
-	if (me->dataType == AlxParamItem_Uint8)
+	if (me->desc->dataType == AlxParamItem_Uint8)
 	{
 		// Convert
-		uint8_t valNum = 0;
-		if (sscanf(val, "%hu", &valNum) != 1)
+		uint64_t valNum = 0;
+		if (AlxParamItem_Atou(val, UINT8_MAX, &valNum) != Alx_Ok)
 		{
 			return AlxParamItem_ErrConv;
 		}
 
 		// Set
-		status = AlxParamItem_SetValUint8(me, valNum);
+		status = AlxParamItem_SetValUint8(me, (uint8_t)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Uint16)
+	else if (me->desc->dataType == AlxParamItem_Uint16)
 	{
 		// Convert
-		uint16_t valNum = 0;
-		if (sscanf(val, "%hu", &valNum) != 1)
+		uint64_t valNum = 0;
+		if (AlxParamItem_Atou(val, UINT16_MAX, &valNum) != Alx_Ok)
 		{
 			return AlxParamItem_ErrConv;
 		}
-		status = AlxParamItem_SetValUint16(me, valNum);
+
+		// Set
+		status = AlxParamItem_SetValUint16(me, (uint16_t)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Uint32)
+	else if (me->desc->dataType == AlxParamItem_Uint32)
 	{
 		// Convert
-		uint32_t valNum = 0;
-		if (sscanf(val, "%lu", &valNum) != 1)
+		uint64_t valNum = 0;
+		if (AlxParamItem_Atou(val, UINT32_MAX, &valNum) != Alx_Ok)
 		{
 			return AlxParamItem_ErrConv;
 		}
 
 		// Set
-		status = AlxParamItem_SetValUint32(me, valNum);
+		status = AlxParamItem_SetValUint32(me, (uint32_t)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Uint64)
+	else if (me->desc->dataType == AlxParamItem_Uint64)
 	{
-		ALX_PARAM_ITEM_ASSERT(false);	// TV: TODO
+		// Convert
+		uint64_t valNum = 0;
+		if (AlxParamItem_Atou(val, UINT64_MAX, &valNum) != Alx_Ok)
+		{
+			return AlxParamItem_ErrConv;
+		}
+
+		// Set
+		status = AlxParamItem_SetValUint64(me, (uint64_t)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Int8)
+	else if (me->desc->dataType == AlxParamItem_Int8)
 	{
 		// Convert
-		int8_t valNum = 0;
-		if (sscanf(val, "%hd", &valNum) != 1)
+		int64_t valNum = 0;
+		if (AlxParamItem_Atoi(val, INT8_MIN, INT8_MAX, &valNum) != Alx_Ok)
 		{
 			return AlxParamItem_ErrConv;
 		}
 
 		// Set
-		status = AlxParamItem_SetValInt8(me, valNum);
+		status = AlxParamItem_SetValInt8(me, (int8_t)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Int16)
+	else if (me->desc->dataType == AlxParamItem_Int16)
 	{
 		// Convert
-		int16_t valNum = 0;
-		if (sscanf(val, "%hd", &valNum) != 1)
+		int64_t valNum = 0;
+		if (AlxParamItem_Atoi(val, INT16_MIN, INT16_MAX, &valNum) != Alx_Ok)
 		{
 			return AlxParamItem_ErrConv;
 		}
 
 		// Set
-		status = AlxParamItem_SetValInt16(me, valNum);
+		status = AlxParamItem_SetValInt16(me, (int16_t)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Int32)
+	else if (me->desc->dataType == AlxParamItem_Int32)
 	{
 		// Convert
-		int32_t valNum = 0;
-		if (sscanf(val, "%ld", &valNum) != 1)
+		int64_t valNum = 0;
+		if (AlxParamItem_Atoi(val, INT32_MIN, INT32_MAX, &valNum) != Alx_Ok)
 		{
 			return AlxParamItem_ErrConv;
 		}
 
 		// Set
-		status = AlxParamItem_SetValInt32(me, valNum);
+		status = AlxParamItem_SetValInt32(me, (int32_t)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Int64)
+	else if (me->desc->dataType == AlxParamItem_Int64)
 	{
-		ALX_PARAM_ITEM_ASSERT(false);	// TV: TODO
+		// Convert
+		int64_t valNum = 0;
+		if (AlxParamItem_Atoi(val, INT64_MIN, INT64_MAX, &valNum) != Alx_Ok)
+		{
+			return AlxParamItem_ErrConv;
+		}
+
+		// Set
+		status = AlxParamItem_SetValInt64(me, (int64_t)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Float)
+	else if (me->desc->dataType == AlxParamItem_Float)
 	{
 		// Convert
-		float valNum = 0;
-		if (sscanf(val, "%f", &valNum) != 1)
+		double valNum = 0;
+		if (AlxParamItem_Atod(val, &valNum, true) != Alx_Ok)
 		{
 			return AlxParamItem_ErrConv;
 		}
 
 		// Set
-		status = AlxParamItem_SetValFloat(me, valNum);
+		status = AlxParamItem_SetValFloat(me, (float)valNum);
 	}
-	else if (me->dataType == AlxParamItem_Double)
+	else if (me->desc->dataType == AlxParamItem_Double)
 	{
 		// Convert
 		double valNum = 0;
-		if (sscanf(val, "%lf", &valNum) != 1)
+		if (AlxParamItem_Atod(val, &valNum, false) != Alx_Ok)
 		{
 			return AlxParamItem_ErrConv;
 		}
@@ -2087,7 +2355,7 @@ Alx_Status AlxParamItem_SetVal_StrFormat(AlxParamItem* me, char* val)
 		// Set
 		status = AlxParamItem_SetValDouble(me, valNum);
 	}
-	else if (me->dataType == AlxParamItem_Bool)
+	else if (me->desc->dataType == AlxParamItem_Bool)
 	{
 		// Convert
 		bool valNum = false;
@@ -2123,11 +2391,11 @@ Alx_Status AlxParamItem_SetVal_StrFormat(AlxParamItem* me, char* val)
 		// Set
 		status = AlxParamItem_SetValBool(me, valNum);
 	}
-	else if (me->dataType == AlxParamItem_Arr)
+	else if (me->desc->dataType == AlxParamItem_Arr)
 	{
 		ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 	}
-	else if (me->dataType == AlxParamItem_Str)
+	else if (me->desc->dataType == AlxParamItem_Str)
 	{
 		// Set
 		status = AlxParamItem_SetValStr(me, val);
@@ -2161,39 +2429,30 @@ Alx_Status AlxParamItem_LoadVal(AlxParamItem* me)
 	ALX_PARAM_ITEM_ASSERT(me->paramKvStore != NULL);
 
 	// Local variables
-	void* buff = NULL;
+	uint8_t buff[ALX_PARAM_ITEM_BUFF_LEN] = {};	// Str buffLen is limited to ALX_PARAM_ITEM_BUFF_LEN, numeric types are shorter
 	uint32_t buffLen = 0;
 	uint32_t actualValLen = 0;
 	Alx_Status status = Alx_Err;
 
 	// Set buffLen
-	if (me->dataType == AlxParamItem_Str)
+	if (me->desc->dataType == AlxParamItem_Str)
 	{
-		buffLen = me->buffLen;
+		buffLen = me->desc->buffLen;
 	}
 	else
 	{
 		buffLen = me->valLen;
 	}
 
-	// Allocate memory
-	buff = calloc(buffLen, sizeof(uint8_t));
-	if (buff == NULL)
-	{
-		ALX_PARAM_ITEM_TRACE_ERR("FAIL: calloc()");
-		free(buff);
-		return Alx_Err;
-	}
+	// Check
+	ALX_PARAM_ITEM_ASSERT(buffLen <= sizeof(buff));
 
 	// Get value from Param KV Store
-	status = AlxParamKvStore_Get(me->paramKvStore, me->key, buff, buffLen, &actualValLen);
+	status = AlxParamKvStore_Get(me->paramKvStore, me->desc->key, buff, buffLen, &actualValLen);
 	if (status != Alx_Ok)
 	{
 		// Trace
-		ALX_PARAM_ITEM_TRACE_DBG("AlxParamItem_LoadVal - KV store get ERROR - Key not found, default will be used - %s", me->key);
-
-		// Free memory
-		free(buff);
+		ALX_PARAM_ITEM_TRACE_DBG("AlxParamItem_LoadVal - KV store get ERROR - Key not found, default will be used - %s", me->desc->key);
 
 		// Return
 		return Alx_Ok;
@@ -2201,16 +2460,13 @@ Alx_Status AlxParamItem_LoadVal(AlxParamItem* me)
 
 	// Set Param Item
 	status = AlxParamItem_SetVal(me, buff);
-	me->pendingStore = false;	// TV: TODO - Hack, we had problem, that if loaded val diff than default, pendingStore was set.. we don't want that..
-
-	// Free memory
-	free(buff);
+	AlxParamItem_SetPendingStore(me, false);	// TV: TODO - Hack, we had problem, that if loaded val diff than default, pendingStore was set.. we don't want that..
 
 	// If Param Item set error
 	if (status != Alx_Ok)
 	{
 		// Remove Param KV Store key
-		status = AlxParamKvStore_Remove(me->paramKvStore, me->key);
+		status = AlxParamKvStore_Remove(me->paramKvStore, me->desc->key);
 		if (status != Alx_Ok)
 		{
 			ALX_PARAM_ITEM_TRACE_ERR("FAIL: AlxParamKvStore_Remove()");
@@ -2218,7 +2474,7 @@ Alx_Status AlxParamItem_LoadVal(AlxParamItem* me)
 		}
 
 		// Trace
-		ALX_PARAM_ITEM_TRACE_DBG("AlxParamItem_LoadVal - KV store get OK, param item set ERROR - Key was removed, default will be used - %s", me->key);
+		ALX_PARAM_ITEM_TRACE_DBG("AlxParamItem_LoadVal - KV store get OK, param item set ERROR - Key was removed, default will be used - %s", me->desc->key);
 	}
 
 	// Return
@@ -2226,7 +2482,7 @@ Alx_Status AlxParamItem_LoadVal(AlxParamItem* me)
 }
 
 /**
-  * @brief
+  * @brief			Store value, if pending, inside KV store batch caller has to restore pending store, if batch is aborted or its commit fails
   * @param[in,out]	me
   * @return
   */
@@ -2242,28 +2498,109 @@ Alx_Status AlxParamItem_StoreVal(AlxParamItem* me)
 		return Alx_Ok;
 	}
 
+	// Clear before set, so that value changed during set is stored next time
+	AlxParamItem_SetPendingStore(me, false);
+
 	// Get value pointer
 	void* valPtr = AlxParamItem_GetValPtr_Private(me);
 
 	// Set Param KV Store
-	Alx_Status status = AlxParamKvStore_Set(me->paramKvStore, me->key, valPtr, me->valLen);
+	Alx_Status status = AlxParamKvStore_Set(me->paramKvStore, me->desc->key, valPtr, me->valLen);
 	if (status != Alx_Ok)
 	{
 		ALX_PARAM_ITEM_TRACE_ERR("FAIL: AlxParamKvStore_Set()");
+		AlxParamItem_SetPendingStore(me, true);
 		return Alx_Err;
 	}
 
-	// Clear
-	me->pendingStore = false;
-
 	// Return
 	return Alx_Ok;
 }
 
+/**
+  * @brief			Set or clear pending store, used by owner to restore it, if batch with stored value was aborted or its commit failed
+  * @param[in,out]	me
+  * @param[in]		pendingStore
+  */
+void AlxParamItem_SetPendingStore(AlxParamItem* me, bool pendingStore)
+{
+	// Set
+	me->pendingStore = pendingStore;
+
+	// Set owner bitmap bit, if owned
+	if (me->owner != NULL && me->owner->pendingStoreBitmap != NULL)
+	{
+		uint32_t* word = &me->owner->pendingStoreBitmap[me->ownerIndex / 32];
+		uint32_t mask = 1UL << (me->ownerIndex % 32);
+		if (pendingStore)
+		{
+			*word = *word | mask;
+		}
+		else
+		{
+			*word = *word & ~mask;
+		}
+	}
+}
+
+
+//------------------------------------------------------------------------------
+// Value Changed
+//------------------------------------------------------------------------------
+
+/**
+  * @brief			Set owner, which keeps pending store bitmap & value changed subscriptions for all its items, so that item keeps only its index
+  * @param[in,out]	me
+  * @param[in]		owner
+  * @param[in]		ownerIndex		Index of item in owner, bit of pending store bitmap
+  */
+void AlxParamItem_SetOwner(AlxParamItem* me, AlxParamItem_Owner* owner, uint32_t ownerIndex)
+{
+	// Assert
+	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
+	ALX_PARAM_ITEM_ASSERT(ownerIndex <= UINT16_MAX);
+
+	// Set
+	me->owner = owner;
+	me->ownerIndex = (uint16_t)ownerIndex;
+
+	// Sync bit with current pendingStore
+	AlxParamItem_SetPendingStore(me, me->pendingStore);
+}
+
+/**
+  * @brief			Check if value was changed through setters since last AlxParamItem_ClearValChanged, used by AlxParamGroup, so that it does not have to compare values
+  * @param[in,out]	me
+  * @retval			false
+  * @retval			true
+  */
+bool AlxParamItem_IsValChanged(AlxParamItem* me)
+{
+	// Assert
+	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
+
+	// Return
+	return me->valChanged;
+}
+
+/**
+  * @brief			Clear value changed, before value is read, so that value changed during read raises it again
+  * @param[in,out]	me
+  */
+void AlxParamItem_ClearValChanged(AlxParamItem* me)
+{
+	// Assert
+	ALX_PARAM_ITEM_ASSERT(me->wasCtorCalled == true);
+
+	// Clear
+	me->valChanged = false;
+}
+
 
 //******************************************************************************
 // Private Functions
 //******************************************************************************
+#if !defined(ALX_PARAM_ITEM_DESC_CONST)
 static void AlxParamItem_Ctor
 (
 	AlxParamItem* me,
@@ -2289,31 +2626,37 @@ static void AlxParamItem_Ctor
 )
 {
 	// Parameters
-	me->dataType = dataType;
+	me->desc = &me->descRam;
+	me->descRam.dataType = dataType;
 	me->paramKvStore = paramKvStore;
-	me->paramType = paramType;
-	me->key = key;
-	me->id = id;
-	me->groupKey = groupKey;
-	me->groupId = groupId;
-	memcpy(&me->valDef, valDef, valLen);
-	memcpy(&me->valMin, valMin, valLen);
-	memcpy(&me->valMax, valMax, valLen);
-	me->valLen = valLen;
-	me->valOutOfRangeHandle = valOutOfRangeHandle;
-	me->isEnum = isEnum;
-	me->enumArr = enumArr;
-	me->enumArrLen = enumArrLen;
-	me->valUnit = valUnit;
-	me->valChangeTakesEffectAfterReset = valChangeTakesEffectAfterReset;
-	me->buff = buff;
-	me->buffLen = buffLen;
+	me->descRam.paramType = paramType;
+	me->descRam.key = key;
+	me->descRam.id = id;
+	me->descRam.groupKey = groupKey;
+	me->descRam.groupId = groupId;
+	memcpy(&me->descRam.valDef, valDef, valLen);
+	memcpy(&me->descRam.valMin, valMin, valLen);
+	memcpy(&me->descRam.valMax, valMax, valLen);
+	me->descRam.valLen = valLen;
+	me->descRam.valOutOfRangeHandle = valOutOfRangeHandle;
+	me->descRam.isEnum = isEnum;
+	me->descRam.enumArr = enumArr;
+	me->descRam.enumArrLen = enumArrLen;
+	me->descRam.valUnit = valUnit;
+	me->descRam.valChangeTakesEffectAfterReset = valChangeTakesEffectAfterReset;
+	me->descRam.buff = buff;
+	me->descRam.buffLen = buffLen;
 
 	// Variables
+	me->valLen = me->descRam.valLen;
 	memcpy(&me->val, valDef, valLen);
+	me->pendingStore = false;
+	me->valChanged = false;
+	me->ownerIndex = 0;
+	me->owner = NULL;
 
 	// Check if enum
-	if (me->enumArr != ALX_NULL)
+	if (me->descRam.enumArr != ALX_NULL)
 	{
 		// Check if enum array value are from low to high
 		ALX_PARAM_ITEM_ASSERT(AlxParamItem_AreEnumArrValFromLowToHigh(me) == true);
@@ -2327,16 +2670,17 @@ static void AlxParamItem_Ctor
 	// Info
 	me->wasCtorCalled = true;
 }
+#endif
 static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 {
 	// Check if enum array values are from low to high
-	for (uint8_t i = 0; i < me->enumArrLen - 1; i++)
+	for (uint8_t i = 0; i < me->desc->enumArrLen - 1; i++)
 	{
-		if (me->dataType == AlxParamItem_Uint8)
+		if (me->desc->dataType == AlxParamItem_Uint8)
 		{
 			// Dereference
-			uint8_t _enumArrValCurrent = *((uint8_t*)me->enumArr + i);
-			uint8_t _enumArrValNext = *((uint8_t*)me->enumArr + i + 1);
+			uint8_t _enumArrValCurrent = *((uint8_t*)me->desc->enumArr + i);
+			uint8_t _enumArrValNext = *((uint8_t*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2344,11 +2688,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint16)
+		else if (me->desc->dataType == AlxParamItem_Uint16)
 		{
 			// Dereference
-			uint16_t _enumArrValCurrent = *((uint16_t*)me->enumArr + i);
-			uint16_t _enumArrValNext = *((uint16_t*)me->enumArr + i + 1);
+			uint16_t _enumArrValCurrent = *((uint16_t*)me->desc->enumArr + i);
+			uint16_t _enumArrValNext = *((uint16_t*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2356,11 +2700,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint32)
+		else if (me->desc->dataType == AlxParamItem_Uint32)
 		{
 			// Dereference
-			uint32_t _enumArrValCurrent = *((uint32_t*)me->enumArr + i);
-			uint32_t _enumArrValNext = *((uint32_t*)me->enumArr + i + 1);
+			uint32_t _enumArrValCurrent = *((uint32_t*)me->desc->enumArr + i);
+			uint32_t _enumArrValNext = *((uint32_t*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2368,11 +2712,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint64)
+		else if (me->desc->dataType == AlxParamItem_Uint64)
 		{
 			// Dereference
-			uint64_t _enumArrValCurrent = *((uint64_t*)me->enumArr + i);
-			uint64_t _enumArrValNext = *((uint64_t*)me->enumArr + i + 1);
+			uint64_t _enumArrValCurrent = *((uint64_t*)me->desc->enumArr + i);
+			uint64_t _enumArrValNext = *((uint64_t*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2380,11 +2724,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int8)
+		else if (me->desc->dataType == AlxParamItem_Int8)
 		{
 			// Dereference
-			int8_t _enumArrValCurrent = *((int8_t*)me->enumArr + i);
-			int8_t _enumArrValNext = *((int8_t*)me->enumArr + i + 1);
+			int8_t _enumArrValCurrent = *((int8_t*)me->desc->enumArr + i);
+			int8_t _enumArrValNext = *((int8_t*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2392,11 +2736,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int16)
+		else if (me->desc->dataType == AlxParamItem_Int16)
 		{
 			// Dereference
-			uint16_t _enumArrValCurrent = *((uint16_t*)me->enumArr + i);
-			uint16_t _enumArrValNext = *((uint16_t*)me->enumArr + i + 1);
+			uint16_t _enumArrValCurrent = *((uint16_t*)me->desc->enumArr + i);
+			uint16_t _enumArrValNext = *((uint16_t*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2404,11 +2748,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int32)
+		else if (me->desc->dataType == AlxParamItem_Int32)
 		{
 			// Dereference
-			uint32_t _enumArrValCurrent = *((uint32_t*)me->enumArr + i);
-			uint32_t _enumArrValNext = *((uint32_t*)me->enumArr + i + 1);
+			uint32_t _enumArrValCurrent = *((uint32_t*)me->desc->enumArr + i);
+			uint32_t _enumArrValNext = *((uint32_t*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2416,11 +2760,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int64)
+		else if (me->desc->dataType == AlxParamItem_Int64)
 		{
 			// Dereference
-			uint64_t _enumArrValCurrent = *((uint64_t*)me->enumArr + i);
-			uint64_t _enumArrValNext = *((uint64_t*)me->enumArr + i + 1);
+			uint64_t _enumArrValCurrent = *((uint64_t*)me->desc->enumArr + i);
+			uint64_t _enumArrValNext = *((uint64_t*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2428,11 +2772,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Float)
+		else if (me->desc->dataType == AlxParamItem_Float)
 		{
 			// Dereference
-			float _enumArrValCurrent = *((float*)me->enumArr + i);
-			float _enumArrValNext = *((float*)me->enumArr + i + 1);
+			float _enumArrValCurrent = *((float*)me->desc->enumArr + i);
+			float _enumArrValNext = *((float*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2440,11 +2784,11 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Double)
+		else if (me->desc->dataType == AlxParamItem_Double)
 		{
 			// Dereference
-			double _enumArrValCurrent = *((double*)me->enumArr + i);
-			double _enumArrValNext = *((double*)me->enumArr + i + 1);
+			double _enumArrValCurrent = *((double*)me->desc->enumArr + i);
+			double _enumArrValNext = *((double*)me->desc->enumArr + i + 1);
 
 			// If enum array value current is NOT less then enum array value next, return false (enum array values are NOT from low to high)
 			if ((_enumArrValCurrent < _enumArrValNext) == false)
@@ -2452,15 +2796,15 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 				return false;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Bool)
+		else if (me->desc->dataType == AlxParamItem_Bool)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
-		else if (me->dataType == AlxParamItem_Arr)
+		else if (me->desc->dataType == AlxParamItem_Arr)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
-		else if (me->dataType == AlxParamItem_Str)
+		else if (me->desc->dataType == AlxParamItem_Str)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
@@ -2476,13 +2820,13 @@ static bool AlxParamItem_AreEnumArrValFromLowToHigh(AlxParamItem* me)
 static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 {
 	// Check if enum value is on the list
-	for (uint8_t i = 0; i < me->enumArrLen; i++)
+	for (uint8_t i = 0; i < me->desc->enumArrLen; i++)
 	{
-		if (me->dataType == AlxParamItem_Uint8)
+		if (me->desc->dataType == AlxParamItem_Uint8)
 		{
 			// Dereference
 			uint8_t _enumVal = *(uint8_t*)enumVal;
-			uint8_t _enumArrVal = *((uint8_t*)me->enumArr + i);
+			uint8_t _enumArrVal = *((uint8_t*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2490,11 +2834,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint16)
+		else if (me->desc->dataType == AlxParamItem_Uint16)
 		{
 			// Dereference
 			uint16_t _enumVal = *(uint16_t*)enumVal;
-			uint16_t _enumArrVal = *((uint16_t*)me->enumArr + i);
+			uint16_t _enumArrVal = *((uint16_t*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2502,11 +2846,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint32)
+		else if (me->desc->dataType == AlxParamItem_Uint32)
 		{
 			// Dereference
 			uint32_t _enumVal = *(uint32_t*)enumVal;
-			uint32_t _enumArrVal = *((uint32_t*)me->enumArr + i);
+			uint32_t _enumArrVal = *((uint32_t*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2514,11 +2858,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint64)
+		else if (me->desc->dataType == AlxParamItem_Uint64)
 		{
 			// Dereference
 			uint64_t _enumVal = *(uint64_t*)enumVal;
-			uint64_t _enumArrVal = *((uint64_t*)me->enumArr + i);
+			uint64_t _enumArrVal = *((uint64_t*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2526,11 +2870,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int8)
+		else if (me->desc->dataType == AlxParamItem_Int8)
 		{
 			// Dereference
 			int8_t _enumVal = *(int8_t*)enumVal;
-			int8_t _enumArrVal = *((int8_t*)me->enumArr + i);
+			int8_t _enumArrVal = *((int8_t*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2538,11 +2882,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int16)
+		else if (me->desc->dataType == AlxParamItem_Int16)
 		{
 			// Dereference
 			uint16_t _enumVal = *(uint16_t*)enumVal;
-			uint16_t _enumArrVal = *((uint16_t*)me->enumArr + i);
+			uint16_t _enumArrVal = *((uint16_t*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2550,11 +2894,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int32)
+		else if (me->desc->dataType == AlxParamItem_Int32)
 		{
 			// Dereference
 			uint32_t _enumVal = *(uint32_t*)enumVal;
-			uint32_t _enumArrVal = *((uint32_t*)me->enumArr + i);
+			uint32_t _enumArrVal = *((uint32_t*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2562,11 +2906,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int64)
+		else if (me->desc->dataType == AlxParamItem_Int64)
 		{
 			// Dereference
 			uint64_t _enumVal = *(uint64_t*)enumVal;
-			uint64_t _enumArrVal = *((uint64_t*)me->enumArr + i);
+			uint64_t _enumArrVal = *((uint64_t*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2574,11 +2918,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Float)
+		else if (me->desc->dataType == AlxParamItem_Float)
 		{
 			// Dereference
 			float _enumVal = *(float*)enumVal;
-			float _enumArrVal = *((float*)me->enumArr + i);
+			float _enumArrVal = *((float*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2586,11 +2930,11 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Double)
+		else if (me->desc->dataType == AlxParamItem_Double)
 		{
 			// Dereference
 			double _enumVal = *(double*)enumVal;
-			double _enumArrVal = *((double*)me->enumArr + i);
+			double _enumArrVal = *((double*)me->desc->enumArr + i);
 
 			// If enum value is on the list, return true
 			if (_enumVal == _enumArrVal)
@@ -2598,15 +2942,15 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 				return true;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Bool)
+		else if (me->desc->dataType == AlxParamItem_Bool)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
-		else if (me->dataType == AlxParamItem_Arr)
+		else if (me->desc->dataType == AlxParamItem_Arr)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
-		else if (me->dataType == AlxParamItem_Str)
+		else if (me->desc->dataType == AlxParamItem_Str)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
@@ -2621,13 +2965,13 @@ static bool AlxParamItem_IsEnumOnList(AlxParamItem* me, void* enumVal)
 }
 static void* AlxParamItem_GetValPtr_Private(AlxParamItem* me)
 {
-	if (me->dataType == AlxParamItem_Arr)
+	if (me->desc->dataType == AlxParamItem_Arr)
 	{
 		void* ptr = NULL;
-		memcpy(&ptr, &me->val, 4);
+		memcpy(&ptr, &me->val, sizeof(ptr));
 		return ptr;
 	}
-	else if (me->dataType == AlxParamItem_Str)
+	else if (me->desc->dataType == AlxParamItem_Str)
 	{
 		return me->val.str;
 	}
@@ -2643,21 +2987,21 @@ static Alx_Status AlxParamItem_SetVal(AlxParamItem* me, void* val)
 	//------------------------------------------------------------------------------
 	Alx_Status status = Alx_Err;
 	void* valPtr = AlxParamItem_GetValPtr_Private(me);
-	void* oldValPtr = NULL;
-	uint32_t oldValLen = 0;
+	uint8_t oldVal[ALX_PARAM_ITEM_BUFF_LEN];	// Str buffLen is limited to ALX_PARAM_ITEM_BUFF_LEN, numeric types are shorter
+	uint32_t oldValLen = me->valLen;
 
 
 	//------------------------------------------------------------------------------
 	// Handle Enum
 	//------------------------------------------------------------------------------
-	if (me->enumArr != NULL)
+	if (me->desc->enumArr != NULL)
 	{
 		// Check if enum is on the list
 		bool isEnumOnList = AlxParamItem_IsEnumOnList(me, val);
 		if (isEnumOnList == false)
 		{
 			// If handle assert selected, then assert, else return
-			if (me->valOutOfRangeHandle == AlxParamItem_Assert)
+			if (me->desc->valOutOfRangeHandle == AlxParamItem_Assert)
 			{
 				ALX_PARAM_ITEM_ASSERT(false);
 				return AlxParamItem_ErrEnum;
@@ -2673,143 +3017,125 @@ static Alx_Status AlxParamItem_SetVal(AlxParamItem* me, void* val)
 	// Handle Set Old
 	//------------------------------------------------------------------------------
 
-	// Set oldValLen
-	if (me->dataType == AlxParamItem_Str)
-	{
-		oldValLen = me->buffLen;
-	}
-	else
-	{
-		oldValLen = me->valLen;
-	}
-
-	// Allocate memory
-	oldValPtr = calloc(oldValLen, sizeof(uint8_t));
-	if (oldValPtr == NULL)
-	{
-		ALX_PARAM_ITEM_TRACE_ERR("FAIL: calloc()");
-		free(oldValPtr);
-		return Alx_Err;
-	}
-
 	// Set oldVal
-	memcpy(oldValPtr, valPtr, me->valLen);
+	ALX_PARAM_ITEM_ASSERT(oldValLen <= sizeof(oldVal));
+	memcpy(oldVal, valPtr, oldValLen);
 
 
 	//------------------------------------------------------------------------------
 	// Handle Set New
 	//------------------------------------------------------------------------------
-	if (me->dataType == AlxParamItem_Bool)
+	if (me->desc->dataType == AlxParamItem_Bool)
 	{
 		bool _val = *(bool*)val;
 		me->val._bool = _val;
 		status = Alx_Ok;
 	}
-	else if ((me->valOutOfRangeHandle == AlxParamItem_Assert) || (me->valOutOfRangeHandle == AlxParamItem_Ignore))
+	else if ((me->desc->valOutOfRangeHandle == AlxParamItem_Assert) || (me->desc->valOutOfRangeHandle == AlxParamItem_Ignore))
 	{
 		// Set
-		if (me->dataType == AlxParamItem_Uint8)
+		if (me->desc->dataType == AlxParamItem_Uint8)
 		{
 			uint8_t _val = *(uint8_t*)val;
-			status = AlxRange_CheckUint8(_val, me->valMin.uint8, me->valMax.uint8);
+			status = AlxRange_CheckUint8(_val, me->desc->valMin.uint8, me->desc->valMax.uint8);
 			if (status == Alx_Ok)
 			{
 				me->val.uint8 = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint16)
+		else if (me->desc->dataType == AlxParamItem_Uint16)
 		{
 			uint16_t _val = *(uint16_t*)val;
-			status = AlxRange_CheckUint16(_val, me->valMin.uint16, me->valMax.uint16);
+			status = AlxRange_CheckUint16(_val, me->desc->valMin.uint16, me->desc->valMax.uint16);
 			if (status == Alx_Ok)
 			{
 				me->val.uint16 = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint32)
+		else if (me->desc->dataType == AlxParamItem_Uint32)
 		{
 			uint32_t _val = *(uint32_t*)val;
-			status = AlxRange_CheckUint32(_val, me->valMin.uint32, me->valMax.uint32);
+			status = AlxRange_CheckUint32(_val, me->desc->valMin.uint32, me->desc->valMax.uint32);
 			if (status == Alx_Ok)
 			{
 				me->val.uint32 = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Uint64)
+		else if (me->desc->dataType == AlxParamItem_Uint64)
 		{
 			uint64_t _val = *(uint64_t*)val;
-			status = AlxRange_CheckUint64(_val, me->valMin.uint64, me->valMax.uint64);
+			status = AlxRange_CheckUint64(_val, me->desc->valMin.uint64, me->desc->valMax.uint64);
 			if (status == Alx_Ok)
 			{
 				me->val.uint64 = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int8)
+		else if (me->desc->dataType == AlxParamItem_Int8)
 		{
 			int8_t _val = *(int8_t*)val;
-			status = AlxRange_CheckInt8(_val, me->valMin.int8, me->valMax.int8);
+			status = AlxRange_CheckInt8(_val, me->desc->valMin.int8, me->desc->valMax.int8);
 			if (status == Alx_Ok)
 			{
 				me->val.int8 = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int16)
+		else if (me->desc->dataType == AlxParamItem_Int16)
 		{
 			int16_t _val = *(int16_t*)val;
-			status = AlxRange_CheckInt16(_val, me->valMin.int16, me->valMax.int16);
+			status = AlxRange_CheckInt16(_val, me->desc->valMin.int16, me->desc->valMax.int16);
 			if (status == Alx_Ok)
 			{
 				me->val.int16 = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int32)
+		else if (me->desc->dataType == AlxParamItem_Int32)
 		{
 			int32_t _val = *(int32_t*)val;
-			status = AlxRange_CheckInt32(_val, me->valMin.int32, me->valMax.int32);
+			status = AlxRange_CheckInt32(_val, me->desc->valMin.int32, me->desc->valMax.int32);
 			if (status == Alx_Ok)
 			{
 				me->val.int32 = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Int64)
+		else if (me->desc->dataType == AlxParamItem_Int64)
 		{
 			int64_t _val = *(int64_t*)val;
-			status = AlxRange_CheckInt64(_val, me->valMin.int64, me->valMax.int64);
+			status = AlxRange_CheckInt64(_val, me->desc->valMin.int64, me->desc->valMax.int64);
 			if (status == Alx_Ok)
 			{
 				me->val.int64 = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Float)
+		else if (me->desc->dataType == AlxParamItem_Float)
 		{
 			float _val = *(float*)val;
-			status = AlxRange_CheckFloat(_val, me->valMin._float, me->valMax._float);
+			status = AlxRange_CheckFloat(_val, me->desc->valMin._float, me->desc->valMax._float);
 			if (status == Alx_Ok)
 			{
 				me->val._float = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Double)
+		else if (me->desc->dataType == AlxParamItem_Double)
 		{
 			double _val = *(double*)val;
-			status = AlxRange_CheckDouble(_val, me->valMin._double, me->valMax._double);
+			status = AlxRange_CheckDouble(_val, me->desc->valMin._double, me->desc->valMax._double);
 			if (status == Alx_Ok)
 			{
 				me->val._double = _val;
 			}
 		}
-		else if (me->dataType == AlxParamItem_Bool)
+		else if (me->desc->dataType == AlxParamItem_Bool)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
-		else if (me->dataType == AlxParamItem_Arr)
+		else if (me->desc->dataType == AlxParamItem_Arr)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
-		else if (me->dataType == AlxParamItem_Str)
+		else if (me->desc->dataType == AlxParamItem_Str)
 		{
 			char* _val = (char*)val;
-			status = AlxRange_CheckStr(_val, me->buffLen);
+			status = AlxRange_CheckStr(_val, me->desc->buffLen);
 			if (status == Alx_Ok)
 			{
 				strcpy(me->val.str, _val);
@@ -2822,87 +3148,87 @@ static Alx_Status AlxParamItem_SetVal(AlxParamItem* me, void* val)
 		}
 
 		// If ValOutOfRangeHandle_Assert and status is NOT OK, assert
-		if ((me->valOutOfRangeHandle == AlxParamItem_Assert) && (status != Alx_Ok))
+		if ((me->desc->valOutOfRangeHandle == AlxParamItem_Assert) && (status != Alx_Ok))
 		{
 			ALX_PARAM_ITEM_ASSERT(false);
 			status = Alx_Err;
 		}
 	}
-	else if (me->valOutOfRangeHandle == AlxParamItem_Bound)
+	else if (me->desc->valOutOfRangeHandle == AlxParamItem_Bound)
 	{
 		// Set
-		if (me->dataType == AlxParamItem_Uint8)
+		if (me->desc->dataType == AlxParamItem_Uint8)
 		{
 			uint8_t _val = *(uint8_t*)val;
-			status = AlxBound_Uint8(&_val, me->valMin.uint8, me->valMax.uint8);
+			status = AlxBound_Uint8(&_val, me->desc->valMin.uint8, me->desc->valMax.uint8);
 			me->val.uint8 = _val;
 		}
-		else if (me->dataType == AlxParamItem_Uint16)
+		else if (me->desc->dataType == AlxParamItem_Uint16)
 		{
 			uint16_t _val = *(uint16_t*)val;
-			status = AlxBound_Uint16(&_val, me->valMin.uint16, me->valMax.uint16);
+			status = AlxBound_Uint16(&_val, me->desc->valMin.uint16, me->desc->valMax.uint16);
 			me->val.uint16 = _val;
 		}
-		else if (me->dataType == AlxParamItem_Uint32)
+		else if (me->desc->dataType == AlxParamItem_Uint32)
 		{
 			uint32_t _val = *(uint32_t*)val;
-			status = AlxBound_Uint32(&_val, me->valMin.uint32, me->valMax.uint32);
+			status = AlxBound_Uint32(&_val, me->desc->valMin.uint32, me->desc->valMax.uint32);
 			me->val.uint32 = _val;
 		}
-		else if (me->dataType == AlxParamItem_Uint64)
+		else if (me->desc->dataType == AlxParamItem_Uint64)
 		{
 			uint64_t _val = *(uint64_t*)val;
-			status = AlxBound_Uint64(&_val, me->valMin.uint64, me->valMax.uint64);
+			status = AlxBound_Uint64(&_val, me->desc->valMin.uint64, me->desc->valMax.uint64);
 			me->val.uint64 = _val;
 		}
-		else if (me->dataType == AlxParamItem_Int8)
+		else if (me->desc->dataType == AlxParamItem_Int8)
 		{
 			int8_t _val = *(int8_t*)val;
-			status = AlxBound_Int8(&_val, me->valMin.int8, me->valMax.int8);
+			status = AlxBound_Int8(&_val, me->desc->valMin.int8, me->desc->valMax.int8);
 			me->val.int8 = _val;
 		}
-		else if (me->dataType == AlxParamItem_Int16)
+		else if (me->desc->dataType == AlxParamItem_Int16)
 		{
 			int16_t _val = *(int16_t*)val;
-			status = AlxBound_Int16(&_val, me->valMin.int16, me->valMax.int16);
+			status = AlxBound_Int16(&_val, me->desc->valMin.int16, me->desc->valMax.int16);
 			me->val.int16 = _val;
 		}
-		else if (me->dataType == AlxParamItem_Int32)
+		else if (me->desc->dataType == AlxParamItem_Int32)
 		{
 			int32_t _val = *(int32_t*)val;
-			status = AlxBound_Int32(&_val, me->valMin.int32, me->valMax.int32);
+			status = AlxBound_Int32(&_val, me->desc->valMin.int32, me->desc->valMax.int32);
 			me->val.int32 = _val;
 		}
-		else if (me->dataType == AlxParamItem_Int64)
+		else if (me->desc->dataType == AlxParamItem_Int64)
 		{
 			int64_t _val = *(int64_t*)val;
-			status = AlxBound_Int64(&_val, me->valMin.int64, me->valMax.int64);
+			status = AlxBound_Int64(&_val, me->desc->valMin.int64, me->desc->valMax.int64);
 			me->val.int64 = _val;
 		}
-		else if (me->dataType == AlxParamItem_Float)
+		else if (me->desc->dataType == AlxParamItem_Float)
 		{
 			float _val = *(float*)val;
-			status = AlxBound_Float(&_val, me->valMin._float, me->valMax._float);
+			status = AlxBound_Float(&_val, me->desc->valMin._float, me->desc->valMax._float);
 			me->val._float = _val;
 		}
-		else if (me->dataType == AlxParamItem_Double)
+		else if (me->desc->dataType == AlxParamItem_Double)
 		{
 			double _val = *(double*)val;
-			status = AlxBound_Double(&_val, me->valMin._double, me->valMax._double);
+			status = AlxBound_Double(&_val, me->desc->valMin._double, me->desc->valMax._double);
 			me->val._double = _val;
 		}
-		else if (me->dataType == AlxParamItem_Bool)
+		else if (me->desc->dataType == AlxParamItem_Bool)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
-		else if (me->dataType == AlxParamItem_Arr)
+		else if (me->desc->dataType == AlxParamItem_Arr)
 		{
 			ALX_PARAM_ITEM_ASSERT(false);	// We should never get here
 		}
-		else if (me->dataType == AlxParamItem_Str)
+		else if (me->desc->dataType == AlxParamItem_Str)
 		{
 			char* _val = (char*)val;
-			status = AlxBound_Str(me->val.str, _val, me->buffLen);
+			status = AlxBound_Str(me->val.str, _val, me->desc->buffLen);
 			me->valLen = strlen(me->val.str) + 1;	// Add +1 for null terminator
 		}
 		else
@@ -2918,26 +3244,765 @@ static Alx_Status AlxParamItem_SetVal(AlxParamItem* me, void* val)
 
 
 	//------------------------------------------------------------------------------
-	// Handle Pending Store
+	// Handle Pending Store, value is compared instead of checking status, because value bound to min or max is also changed
 	//------------------------------------------------------------------------------
-	if (status == Alx_Ok)
+	if ((oldValLen != me->valLen) || (memcmp(oldVal, valPtr, me->valLen) != 0))
 	{
-		if (memcmp(oldValPtr, valPtr, me->valLen) != 0)
-		{
-			me->pendingStore = true;
-		}
+		AlxParamItem_ValChanged(me, oldVal);
 	}
 
 
 	//------------------------------------------------------------------------------
 	// Return
 	//------------------------------------------------------------------------------
+	return status;
+}
+static void AlxParamItem_ValChanged(AlxParamItem* me, void* valOld)
+{
+	// Set pending store & value changed
+	AlxParamItem_SetPendingStore(me, true);
+	me->valChanged = true;
+
+	// Notify owner, it calls subscribed callbacks & sets subscribed event flags
+	if (me->owner != NULL && me->owner->valChanged != NULL)
+	{
+		me->owner->valChanged(me->owner->valChanged_Ctx, me->ownerIndex, valOld);
+	}
+}
+static uint32_t AlxParamItem_Utoa(uint64_t val, char* str)
+{
+	// Local variables
+	char buff[20];	// Max uint64_t number of digits
+	uint32_t i = sizeof(buff);
+
+	// Convert upper part, two digits at once, so that 64-bit division is used only for values above uint32_t
+	while (val > UINT32_MAX)
+	{
+		uint32_t pair = (uint32_t)(val % 100);
+		val = val / 100;
+		i = i - 2;
+		memcpy(&buff[i], &alxParamItem_digitPairArr[pair * 2], 2);
+	}
+
+	// Convert lower part, two digits at once
+	uint32_t val32 = (uint32_t)val;
+	while (val32 >= 100)
+	{
+		uint32_t pair = val32 % 100;
+		val32 = val32 / 100;
+		i = i - 2;
+		memcpy(&buff[i], &alxParamItem_digitPairArr[pair * 2], 2);
+	}
+	if (val32 >= 10)
+	{
+		i = i - 2;
+		memcpy(&buff[i], &alxParamItem_digitPairArr[val32 * 2], 2);
+	}
+	else
+	{
+		i = i - 1;
+		buff[i] = (char)('0' + val32);
+	}
 
-	// Free memory
-	free(oldValPtr);
+	// Copy
+	uint32_t len = sizeof(buff) - i;
+	memcpy(str, &buff[i], len);
+	str[len] = '\0';
 
 	// Return
-	return status;
+	return len;
+}
+static uint32_t AlxParamItem_Itoa(int64_t val, char* str)
+{
+	// If negative, add sign
+	if (val < 0)
+	{
+		str[0] = '-';
+		return 1 + AlxParamItem_Utoa((uint64_t)0 - (uint64_t)val, &str[1]);
+	}
+
+	// Return
+	return AlxParamItem_Utoa((uint64_t)val, str);
+}
+static uint32_t AlxParamItem_Dtoa(double val, char* str, bool isFloat)
+{
+	// Local variables
+	char* ptr = str;
+	char digits[20] = "";
+	uint32_t len = 0;
+	uint64_t mant = 0;
+	int32_t exp2 = 0;
+	AlxParamItem_Big r;
+	AlxParamItem_Big s;
+	AlxParamItem_Big mPlus;
+	AlxParamItem_Big mMinus;
+	AlxParamItem_Big sum;
+
+	// Handle special values
+	if (isnan(val))
+	{
+		strcpy(str, "nan");
+		return 3;
+	}
+	if (signbit(val))
+	{
+		*ptr++ = '-';
+		val = -val;
+	}
+	if (isinf(val))
+	{
+		strcpy(ptr, "inf");
+		return (ptr - str) + 3;
+	}
+	if (val == 0)
+	{
+		strcpy(ptr, "0");
+		return (ptr - str) + 1;
+	}
+
+	// Shortest digits, which convert back to the same value, are found exactly with big integers (Steele & White / Burger & Dybvig free-format algorithm)
+	AlxParamItem_FloatToBin(val, isFloat, &mant, &exp2);
+	uint32_t mantBits = isFloat ? 24 : 53;
+	bool isEven = (mant & 1) == 0;	// Round half to even on parse, so boundaries themselves convert back
+	bool isBoundary = (mant == ((uint64_t)1 << (mantBits - 1))) && (exp2 != (isFloat ? -149 : -1074));	// Lower neighbour is 2 times closer
+
+	// Value and half distances to neighbours as fractions r/s, mPlus/s, mMinus/s
+	AlxParamItem_Big_Set(&r, mant << (isBoundary ? 2 : 1));
+	AlxParamItem_Big_Set(&s, isBoundary ? 4 : 2);
+	AlxParamItem_Big_Set(&mPlus, isBoundary ? 2 : 1);
+	AlxParamItem_Big_Set(&mMinus, 1);
+	if (exp2 >= 0)
+	{
+		AlxParamItem_Big_ShiftLeft(&r, (uint32_t)exp2);
+		AlxParamItem_Big_ShiftLeft(&mPlus, (uint32_t)exp2);
+		AlxParamItem_Big_ShiftLeft(&mMinus, (uint32_t)exp2);
+	}
+	else
+	{
+		AlxParamItem_Big_ShiftLeft(&s, (uint32_t)-exp2);
+	}
+
+	// Estimate decimal exponent from binary exponent, estimate is never too high and at most 1 too low
+	int32_t mantLen = 0;
+	for (uint64_t mantTmp = mant; mantTmp != 0; mantTmp = mantTmp >> 1)
+	{
+		mantLen++;
+	}
+	double exp10Est = ((double)(exp2 + mantLen - 1) * 0.30102999566398114) - 1e-10;
+	int32_t exp10 = (int32_t)exp10Est;
+	if (exp10Est > (double)exp10)
+	{
+		exp10++;
+	}
+	if (exp10 >= 0)
+	{
+		AlxParamItem_Big_MulPow10(&s, (uint32_t)exp10);
+	}
+	else
+	{
+		AlxParamItem_Big_MulPow10(&r, (uint32_t)-exp10);
+		AlxParamItem_Big_MulPow10(&mPlus, (uint32_t)-exp10);
+		AlxParamItem_Big_MulPow10(&mMinus, (uint32_t)-exp10);
+	}
+	sum = r;
+	AlxParamItem_Big_Add(&sum, &mPlus);
+	int32_t cmp = AlxParamItem_Big_Cmp(&sum, &s);
+	if (isEven ? (cmp >= 0) : (cmp > 0))	// Estimate too low
+	{
+		AlxParamItem_Big_MulAdd(&s, 10, 0);
+		exp10++;
+	}
+
+	// Generate digits, until rest is within half distance to neighbour
+	while (len < sizeof(digits))
+	{
+		AlxParamItem_Big_MulAdd(&r, 10, 0);
+		AlxParamItem_Big_MulAdd(&mPlus, 10, 0);
+		AlxParamItem_Big_MulAdd(&mMinus, 10, 0);
+		char digit = '0';
+		while (AlxParamItem_Big_Cmp(&r, &s) >= 0)
+		{
+			AlxParamItem_Big_Sub(&r, &s);
+			digit++;
+		}
+		cmp = AlxParamItem_Big_Cmp(&r, &mMinus);
+		bool isLow = isEven ? (cmp <= 0) : (cmp < 0);
+		sum = r;
+		AlxParamItem_Big_Add(&sum, &mPlus);
+		cmp = AlxParamItem_Big_Cmp(&sum, &s);
+		bool isHigh = isEven ? (cmp >= 0) : (cmp > 0);
+		if (isLow && isHigh)	// Both digits convert back, take nearer one
+		{
+			sum = r;
+			AlxParamItem_Big_Add(&sum, &r);
+			isLow = AlxParamItem_Big_Cmp(&sum, &s) < 0;
+		}
+		if (isLow)
+		{
+			digits[len++] = digit;
+			break;
+		}
+		if (isHigh)
+		{
+			digits[len++] = digit + 1;
+			break;
+		}
+		digits[len++] = digit;
+	}
+	int32_t exp10Use = exp10 - 1;	// Exponent of first digit
+
+	// Remove trailing zeros
+	while ((len > 1) && (digits[len - 1] == '0'))
+	{
+		len--;
+	}
+
+	// Fixed notation, if exponent is small
+	if ((exp10Use >= -5) && (exp10Use < 17))
+	{
+		if (exp10Use < 0)
+		{
+			*ptr++ = '0';
+			*ptr++ = '.';
+			for (int32_t i = 0; i < -exp10Use - 1; i++)
+			{
+				*ptr++ = '0';
+			}
+			memcpy(ptr, digits, len);
+			ptr = ptr + len;
+		}
+		else
+		{
+			uint32_t lenInt = (uint32_t)exp10Use + 1;
+			for (uint32_t i = 0; i < lenInt; i++)
+			{
+				*ptr++ = (i < len) ? digits[i] : '0';
+			}
+			if (len > lenInt)
+			{
+				*ptr++ = '.';
+				memcpy(ptr, &digits[lenInt], len - lenInt);
+				ptr = ptr + len - lenInt;
+			}
+		}
+		*ptr = '\0';
+	}
+
+	// Else scientific notation
+	else
+	{
+		*ptr++ = digits[0];
+		if (len > 1)
+		{
+			*ptr++ = '.';
+			memcpy(ptr, &digits[1], len - 1);
+			ptr = ptr + len - 1;
+		}
+		*ptr++ = 'e';
+		ptr = ptr + AlxParamItem_Itoa(exp10Use, ptr);
+	}
+
+	// Return
+	return ptr - str;
+}
+static Alx_Status AlxParamItem_Atou(const char* str, uint64_t valMax, uint64_t* val)
+{
+	// Local variables
+	const char* ptr = str;
+	uint64_t _val = 0;
+
+	// Skip sign
+	if (*ptr == '+')
+	{
+		ptr++;
+	}
+
+	// Check empty
+	if (*ptr == '\0')
+	{
+		return AlxParamItem_ErrConv;
+	}
+
+	// Convert, only digits are allowed
+	for (; *ptr != '\0'; ptr++)
+	{
+		if ((*ptr < '0') || (*ptr > '9'))
+		{
+			return AlxParamItem_ErrConv;
+		}
+		uint32_t digit = (uint32_t)(*ptr - '0');
+		if (_val > (valMax - digit) / 10)	// Overflow
+		{
+			return AlxParamItem_ErrConv;
+		}
+		_val = (_val * 10) + digit;
+	}
+
+	// Return
+	*val = _val;
+	return Alx_Ok;
+}
+static Alx_Status AlxParamItem_Atoi(const char* str, int64_t valMin, int64_t valMax, int64_t* val)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint64_t _val = 0;
+
+	// Convert
+	if (str[0] == '-')
+	{
+		if (str[1] == '+')
+		{
+			return AlxParamItem_ErrConv;
+		}
+		status = AlxParamItem_Atou(&str[1], (uint64_t)0 - (uint64_t)valMin, &_val);
+		*val = (int64_t)((uint64_t)0 - _val);
+	}
+	else
+	{
+		status = AlxParamItem_Atou(str, (uint64_t)valMax, &_val);
+		*val = (int64_t)_val;
+	}
+
+	// Return
+	return status;
+}
+static Alx_Status AlxParamItem_Atod(const char* str, double* val, bool isFloat)
+{
+	// Local variables
+	const char* ptr = str;
+	bool isNeg = false;
+	bool isDigit = false;
+	const char* digits = NULL;
+	uint64_t mant = 0;
+	uint32_t numOfDigits = 0;
+	int32_t exp10 = 0;
+
+	// Sign
+	if ((*ptr == '-') || (*ptr == '+'))
+	{
+		isNeg = (*ptr == '-');
+		ptr++;
+	}
+
+	// Special values
+	if ((strcmp(ptr, "inf") == 0) || (strcmp(ptr, "INF") == 0))
+	{
+		*val = isNeg ? -INFINITY : INFINITY;
+		return Alx_Ok;
+	}
+	if ((strcmp(ptr, "nan") == 0) || (strcmp(ptr, "NAN") == 0))
+	{
+		*val = NAN;
+		return Alx_Ok;
+	}
+
+	// Integer part, digits above uint64_t precision are only counted, all digits are used for correction below
+	for (; (*ptr >= '0') && (*ptr <= '9'); ptr++)
+	{
+		isDigit = true;
+		if ((digits == NULL) && (*ptr != '0'))
+		{
+			digits = ptr;
+		}
+		if (numOfDigits < 19)
+		{
+			mant = (mant * 10) + (uint64_t)(*ptr - '0');
+			numOfDigits = numOfDigits + ((mant != 0) ? 1 : 0);
+		}
+		else
+		{
+			exp10++;
+		}
+	}
+
+	// Fraction part
+	if (*ptr == '.')
+	{
+		for (ptr++; (*ptr >= '0') && (*ptr <= '9'); ptr++)
+		{
+			isDigit = true;
+			if ((digits == NULL) && (*ptr != '0'))
+			{
+				digits = ptr;
+			}
+			if (numOfDigits < 19)
+			{
+				mant = (mant * 10) + (uint64_t)(*ptr - '0');
+				numOfDigits = numOfDigits + ((mant != 0) ? 1 : 0);
+				exp10--;
+			}
+		}
+	}
+	if (isDigit == false)
+	{
+		return AlxParamItem_ErrConv;
+	}
+
+	// Exponent
+	if ((*ptr == 'e') || (*ptr == 'E'))
+	{
+		bool isExpNeg = false;
+		int32_t exp = 0;
+		ptr++;
+		if ((*ptr == '-') || (*ptr == '+'))
+		{
+			isExpNeg = (*ptr == '-');
+			ptr++;
+		}
+		if ((*ptr < '0') || (*ptr > '9'))
+		{
+			return AlxParamItem_ErrConv;
+		}
+		for (; (*ptr >= '0') && (*ptr <= '9'); ptr++)
+		{
+			if (exp < 10000)	// Limit, result is already 0 or inf
+			{
+				exp = (exp * 10) + (*ptr - '0');
+			}
+		}
+		exp10 = exp10 + (isExpNeg ? -exp : exp);
+	}
+
+	// Check trailing characters
+	if (*ptr != '\0')
+	{
+		return AlxParamItem_ErrConv;
+	}
+
+	// Handle zero, underflow & overflow, value is in [10^(numOfDigits + exp10 - 1), 10^(numOfDigits + exp10))
+	double _val = 0;
+	if ((mant == 0) || (((int32_t)numOfDigits + exp10) < -324))	// Below half of smallest denormal
+	{
+		*val = isNeg ? -0.0 : 0.0;
+		return Alx_Ok;
+	}
+	if (((int32_t)numOfDigits + exp10) > 310)	// Above largest double
+	{
+		*val = isNeg ? -INFINITY : INFINITY;
+		return Alx_Ok;
+	}
+
+	// Approximate, result can be few units in last place off, because scaling is done in double
+	_val = AlxParamItem_Pow10Scale((double)mant, exp10);
+	if (isFloat)
+	{
+		_val = (float)_val;
+	}
+	uint64_t binMant = 0;
+	int32_t exp2 = 0;
+	if (isinf(_val))
+	{
+		binMant = ((uint64_t)1 << (isFloat ? 24 : 53)) - 1;
+		exp2 = isFloat ? 104 : 971;
+	}
+	else
+	{
+		AlxParamItem_FloatToBin(_val, isFloat, &binMant, &exp2);
+	}
+
+	// Correct, until exact decimal value 0.digits * 10^(numOfDigits + exp10) is within half distance to neighbours, ties to even
+	exp10 = (int32_t)numOfDigits + exp10;
+	uint64_t binMantMin = (uint64_t)1 << (isFloat ? 23 : 52);
+	int32_t exp2Min = isFloat ? -149 : -1074;
+	int32_t exp2Max = isFloat ? 104 : 971;
+	for (;;)
+	{
+		bool isOdd = (binMant & 1) != 0;
+		int32_t cmp = AlxParamItem_CmpDecBin(digits, exp10, (binMant * 2) + 1, exp2 - 1);
+		if ((cmp > 0) || ((cmp == 0) && isOdd))	// Above half distance to upper neighbour
+		{
+			binMant++;
+			if (binMant == (binMantMin * 2))
+			{
+				binMant = binMantMin;
+				exp2++;
+			}
+			if (exp2 > exp2Max)
+			{
+				*val = isNeg ? -INFINITY : INFINITY;
+				return Alx_Ok;
+			}
+			continue;
+		}
+		if (binMant == 0)
+		{
+			break;
+		}
+		bool isBoundary = (binMant == binMantMin) && (exp2 != exp2Min);	// Lower neighbour is 2 times closer
+		cmp = isBoundary
+			? AlxParamItem_CmpDecBin(digits, exp10, (binMant * 4) - 1, exp2 - 2)
+			: AlxParamItem_CmpDecBin(digits, exp10, (binMant * 2) - 1, exp2 - 1);
+		if ((cmp < 0) || ((cmp == 0) && isOdd))	// Below half distance to lower neighbour
+		{
+			binMant--;
+			if (isBoundary)
+			{
+				binMant = (binMant * 2) + 1;
+				exp2--;
+			}
+			continue;
+		}
+		break;
+	}
+	_val = AlxParamItem_BinToFloat(binMant, exp2, isFloat);
+
+	// Return
+	*val = isNeg ? -_val : _val;
+	return Alx_Ok;
+}
+static double AlxParamItem_Pow10Scale(double val, int32_t exp10)
+{
+	// If zero, return
+	if (val == 0)
+	{
+		return val;
+	}
+
+	// Scale in steps of 1e22, which is the largest power of 10 exactly representable in double
+	while (exp10 > 22)
+	{
+		val = val * 1e22;
+		exp10 = exp10 - 22;
+	}
+	while (exp10 < -22)
+	{
+		val = val / 1e22;
+		exp10 = exp10 + 22;
+	}
+
+	// Scale rest, single rounding, if val has at most 53 bits
+	if (exp10 >= 0)
+	{
+		return val * alxParamItem_pow10Arr[exp10];
+	}
+	else
+	{
+		return val / alxParamItem_pow10Arr[-exp10];
+	}
+}
+
+static void AlxParamItem_FloatToBin(double val, bool isFloat, uint64_t* mant, int32_t* exp2)
+{
+	// Get finite positive float or double as mant * 2^exp2, mant is normalized, except for denormals
+	if (isFloat)
+	{
+		float valFloat = (float)val;
+		uint32_t bits = 0;
+		memcpy(&bits, &valFloat, sizeof(bits));
+		uint32_t exp = (bits >> 23) & 0xFF;
+		*mant = bits & 0x7FFFFF;
+		*exp2 = -149;
+		if (exp != 0)
+		{
+			*mant = *mant | 0x800000;
+			*exp2 = (int32_t)exp - 150;
+		}
+	}
+	else
+	{
+		uint64_t bits = 0;
+		memcpy(&bits, &val, sizeof(bits));
+		uint32_t exp = (uint32_t)(bits >> 52) & 0x7FF;
+		*mant = bits & 0xFFFFFFFFFFFFF;
+		*exp2 = -1074;
+		if (exp != 0)
+		{
+			*mant = *mant | 0x10000000000000;
+			*exp2 = (int32_t)exp - 1075;
+		}
+	}
+}
+static double AlxParamItem_BinToFloat(uint64_t mant, int32_t exp2, bool isFloat)
+{
+	// Inverse of AlxParamItem_FloatToBin, mant & exp2 must be in range
+	if (isFloat)
+	{
+		uint32_t bits = (uint32_t)mant;
+		if (mant & 0x800000)
+		{
+			bits = ((uint32_t)(exp2 + 150) << 23) | (bits & 0x7FFFFF);
+		}
+		float valFloat = 0;
+		memcpy(&valFloat, &bits, sizeof(valFloat));
+		return valFloat;
+	}
+	else
+	{
+		uint64_t bits = mant;
+		if (mant & 0x10000000000000)
+		{
+			bits = ((uint64_t)(exp2 + 1075) << 52) | (bits & 0xFFFFFFFFFFFFF);
+		}
+		double valDouble = 0;
+		memcpy(&valDouble, &bits, sizeof(valDouble));
+		return valDouble;
+	}
+}
+static int32_t AlxParamItem_CmpDecBin(const char* digits, int32_t exp10, uint64_t binMant, int32_t exp2)
+{
+	// Compare 0.digits * 10^exp10 with binMant * 2^exp2 exactly, decimal digits of binary value are generated one by one, so number of digits is not limited
+	AlxParamItem_Big r;
+	AlxParamItem_Big s;
+	AlxParamItem_Big_Set(&r, binMant);
+	AlxParamItem_Big_Set(&s, 1);
+	if (exp2 >= 0)
+	{
+		AlxParamItem_Big_ShiftLeft(&r, (uint32_t)exp2);
+	}
+	else
+	{
+		AlxParamItem_Big_ShiftLeft(&s, (uint32_t)-exp2);
+	}
+	if (exp10 >= 0)
+	{
+		AlxParamItem_Big_MulPow10(&s, (uint32_t)exp10);
+	}
+	else
+	{
+		AlxParamItem_Big_MulPow10(&r, (uint32_t)-exp10);
+	}
+
+	// If binary value is not below 10^exp10, decimal value is lower
+	if (AlxParamItem_Big_Cmp(&r, &s) >= 0)
+	{
+		return -1;
+	}
+
+	// Compare digit by digit, decimal point is skipped
+	for (; ((*digits >= '0') && (*digits <= '9')) || (*digits == '.'); digits++)
+	{
+		if (*digits == '.')
+		{
+			continue;
+		}
+		AlxParamItem_Big_MulAdd(&r, 10, 0);
+		char digit = '0';
+		while (AlxParamItem_Big_Cmp(&r, &s) >= 0)
+		{
+			AlxParamItem_Big_Sub(&r, &s);
+			digit++;
+		}
+		if (*digits != digit)
+		{
+			return (*digits > digit) ? 1 : -1;
+		}
+	}
+
+	// Return
+	return (r.len == 0) ? 0 : -1;
+}
+static void AlxParamItem_Big_Set(AlxParamItem_Big* me, uint64_t val)
+{
+	me->len = 0;
+	while (val != 0)
+	{
+		me->word[me->len++] = (uint32_t)val;
+		val = val >> 32;
+	}
+}
+static void AlxParamItem_Big_MulAdd(AlxParamItem_Big* me, uint32_t mul, uint32_t add)
+{
+	uint64_t carry = add;
+	for (uint32_t i = 0; i < me->len; i++)
+	{
+		uint64_t prod = ((uint64_t)me->word[i] * mul) + carry;
+		me->word[i] = (uint32_t)prod;
+		carry = prod >> 32;
+	}
+	if (carry != 0)
+	{
+		ALX_PARAM_ITEM_ASSERT(me->len < ALX_PARAM_ITEM_BIG_LEN);
+		me->word[me->len++] = (uint32_t)carry;
+	}
+}
+static void AlxParamItem_Big_MulPow10(AlxParamItem_Big* me, uint32_t exp10)
+{
+	// Multiply in steps of 1e9, which is the largest power of 10 in uint32_t
+	while (exp10 >= 9)
+	{
+		AlxParamItem_Big_MulAdd(me, 1000000000, 0);
+		exp10 = exp10 - 9;
+	}
+	if (exp10 > 0)
+	{
+		AlxParamItem_Big_MulAdd(me, (uint32_t)alxParamItem_pow10Arr[exp10], 0);
+	}
+}
+static void AlxParamItem_Big_ShiftLeft(AlxParamItem_Big* me, uint32_t exp2)
+{
+	// If zero, return
+	if (me->len == 0)
+	{
+		return;
+	}
+
+	// Shift from top word down, so words are not overwritten before they are read
+	uint32_t wordShift = exp2 / 32;
+	uint32_t bitShift = exp2 % 32;
+	ALX_PARAM_ITEM_ASSERT(me->len + wordShift < ALX_PARAM_ITEM_BIG_LEN);
+	me->word[me->len + wordShift] = 0;
+	for (uint32_t i = me->len; i-- > 0;)
+	{
+		if (bitShift != 0)
+		{
+			me->word[i + wordShift + 1] |= me->word[i] >> (32 - bitShift);
+		}
+		me->word[i + wordShift] = me->word[i] << bitShift;
+	}
+	memset(me->word, 0, wordShift * sizeof(uint32_t));
+	me->len = me->len + wordShift + 1;
+	if (me->word[me->len - 1] == 0)
+	{
+		me->len--;
+	}
+}
+static void AlxParamItem_Big_Add(AlxParamItem_Big* me, const AlxParamItem_Big* val)
+{
+	uint64_t carry = 0;
+	uint32_t len = (me->len > val->len) ? me->len : val->len;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		uint64_t sum = carry + ((i < me->len) ? me->word[i] : 0) + ((i < val->len) ? val->word[i] : 0);
+		me->word[i] = (uint32_t)sum;
+		carry = sum >> 32;
+	}
+	me->len = len;
+	if (carry != 0)
+	{
+		ALX_PARAM_ITEM_ASSERT(me->len < ALX_PARAM_ITEM_BIG_LEN);
+		me->word[me->len++] = (uint32_t)carry;
+	}
+}
+static void AlxParamItem_Big_Sub(AlxParamItem_Big* me, const AlxParamItem_Big* val)
+{
+	// me must not be less than val
+	uint64_t borrow = 0;
+	for (uint32_t i = 0; i < me->len; i++)
+	{
+		uint64_t diff = (uint64_t)me->word[i] - ((i < val->len) ? val->word[i] : 0) - borrow;
+		me->word[i] = (uint32_t)diff;
+		borrow = (diff >> 32) & 1;
+	}
+	while ((me->len > 0) && (me->word[me->len - 1] == 0))
+	{
+		me->len--;
+	}
+}
+static int32_t AlxParamItem_Big_Cmp(const AlxParamItem_Big* a, const AlxParamItem_Big* b)
+{
+	if (a->len != b->len)
+	{
+		return (a->len > b->len) ? 1 : -1;
+	}
+	for (uint32_t i = a->len; i-- > 0;)
+	{
+		if (a->word[i] != b->word[i])
+		{
+			return (a->word[i] > b->word[i]) ? 1 : -1;
+		}
+	}
+	return 0;
 }
 
 
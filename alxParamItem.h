@@ -44,7 +44,6 @@ extern "C" {
 #include "alxAssert.h"
 #include "alxBound.h"
 #include "alxRange.h"
-#include "alxFtoa.h"
 #include "alxParamKvStore.h"
 
 
@@ -83,6 +82,32 @@ extern "C" {
 	#define ALX_PARAM_ITEM_TRACE_DBG(...) do{} while (false)
 #endif
 
+// Defines
+#ifndef ALX_PARAM_ITEM_BUFF_LEN
+	#define ALX_PARAM_ITEM_BUFF_LEN 128	// Max string format and Str value length with null terminator, stack buffers of this length are used instead of heap
+#endif
+
+// Desc //
+// Const descriptor initializers, so that descriptor tables can be placed in flash, parameters are in the same order as matching AlxParamItem_Ctor
+#define ALX_PARAM_ITEM_DESC_NUM(dataType, valMember, valType, paramType, key, id, groupKey, groupId, valDef, valMin, valMax, valOutOfRangeHandle, isEnum, enumArr, enumArrLen, valUnit, valChangeTakesEffectAfterReset) \
+	{ dataType, paramType, key, id, groupKey, groupId, { .valMember = valDef }, { .valMember = valMin }, { .valMember = valMax }, sizeof(valType), valOutOfRangeHandle, isEnum, (void*)(enumArr), enumArrLen, valUnit, valChangeTakesEffectAfterReset, ALX_NULL_PTR, ALX_NULL }
+#define ALX_PARAM_ITEM_DESC_UINT8(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Uint8, uint8, uint8_t, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_UINT16(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Uint16, uint16, uint16_t, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_UINT32(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Uint32, uint32, uint32_t, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_UINT64(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Uint64, uint64, uint64_t, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_INT8(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Int8, int8, int8_t, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_INT16(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Int16, int16, int16_t, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_INT32(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Int32, int32, int32_t, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_INT64(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Int64, int64, int64_t, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_FLOAT(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Float, _float, float, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_DOUBLE(...) ALX_PARAM_ITEM_DESC_NUM(AlxParamItem_Double, _double, double, __VA_ARGS__)
+#define ALX_PARAM_ITEM_DESC_BOOL(paramType, key, id, groupKey, groupId, valDef, valUnit, valChangeTakesEffectAfterReset) \
+	{ AlxParamItem_Bool, paramType, key, id, groupKey, groupId, { ._bool = valDef }, { ._bool = ALX_NULL }, { ._bool = ALX_NULL }, sizeof(bool), ALX_NULL, false, ALX_NULL_PTR, ALX_NULL, valUnit, valChangeTakesEffectAfterReset, ALX_NULL_PTR, ALX_NULL }
+#define ALX_PARAM_ITEM_DESC_ARR(paramType, key, id, groupKey, groupId, valDef, valBuff, valBuffLen, valOutOfRangeHandle, valUnit, valChangeTakesEffectAfterReset) \
+	{ AlxParamItem_Arr, paramType, key, id, groupKey, groupId, { .arr = (void*)(valDef) }, { .arr = ALX_NULL_PTR }, { .arr = ALX_NULL_PTR }, valBuffLen, valOutOfRangeHandle, false, ALX_NULL_PTR, ALX_NULL, valUnit, valChangeTakesEffectAfterReset, (uint8_t*)(valBuff), valBuffLen }
+#define ALX_PARAM_ITEM_DESC_STR(paramType, key, id, groupKey, groupId, valDef, valOutOfRangeHandle, valUnit, valChangeTakesEffectAfterReset, buff, buffLen) \
+	{ AlxParamItem_Str, paramType, key, id, groupKey, groupId, { .str = (char*)(valDef) }, { .str = ALX_NULL_PTR }, { .str = ALX_NULL_PTR }, ALX_NULL, valOutOfRangeHandle, false, ALX_NULL_PTR, ALX_NULL, valUnit, valChangeTakesEffectAfterReset, buff, buffLen }
+
 
 //******************************************************************************
 // Types
@@ -139,13 +164,7 @@ typedef union
 
 typedef struct
 {
-	// Defines
-	#define ALX_PARAM_ITEM_BUFF_LEN 128
-	#define ALX_PARAM_ITEM_FTOA_PRECISION 6
-
-	// Parameters
 	AlxParamItem_DataType dataType;								// General
-	AlxParamKvStore* paramKvStore;								// N/A
 	AlxParamItem_ParamType paramType;							// General
 	const char* key;											// General
 	uint32_t id;												// General
@@ -163,10 +182,31 @@ typedef struct
 	bool valChangeTakesEffectAfterReset;						// General
 	uint8_t* buff;												// N/A
 	uint32_t buffLen;											// General
+} AlxParamItem_Desc;
+
+typedef struct
+{
+	uint32_t* pendingStoreBitmap;								// Bit per item index, kept equal to item pendingStore, so that owner can find pending items without checking all items
+	void (*valChanged)(void* ctx, uint32_t index, void* valOld);	// Called by item after its value is changed, so that subscriptions are kept by owner, not by each item
+	void* valChanged_Ctx;
+} AlxParamItem_Owner;
+
+typedef struct
+{
+	// Parameters
+	const AlxParamItem_Desc* desc;								// General
+	AlxParamKvStore* paramKvStore;								// N/A
+	#if !defined(ALX_PARAM_ITEM_DESC_CONST)
+	AlxParamItem_Desc descRam;									// N/A
+	#endif
 
 	// Variables
 	AlxParamItem_Val val;										// General
+	uint32_t valLen;											// General
 	bool pendingStore;											// N/A
+	bool valChanged;											// N/A
+	uint16_t ownerIndex;										// N/A
+	AlxParamItem_Owner* owner;									// N/A
 
 	// Info
 	bool wasCtorCalled;											// N/A
@@ -176,6 +216,13 @@ typedef struct
 //******************************************************************************
 // Constructor
 //******************************************************************************
+void AlxParamItem_CtorDesc
+(
+	AlxParamItem* me,
+	const AlxParamItem_Desc* desc,
+	AlxParamKvStore* paramKvStore
+);
+#if !defined(ALX_PARAM_ITEM_DESC_CONST)
 void AlxParamItem_CtorUint8
 (
 	AlxParamItem* me,
@@ -412,6 +459,7 @@ void AlxParamItem_CtorStr
 	uint8_t* buff,
 	uint32_t buffLen
 );
+#endif
 
 
 //******************************************************************************
@@ -433,6 +481,7 @@ AlxParamItem_ValOutOfRangeHandle AlxParamItem_GetValOutOfRangeHandle(AlxParamIte
 const char* AlxParamItem_GetValUnit(AlxParamItem* me);
 bool AlxParamItem_GetValChangeTakesEffectAfterReset(AlxParamItem* me);
 uint32_t AlxParamItem_GetBuffLen(AlxParamItem* me);
+AlxParamKvStore* AlxParamItem_GetParamKvStore(AlxParamItem* me);
 void* AlxParamItem_GetValPtr(AlxParamItem* me);
 
 
@@ -470,6 +519,8 @@ Alx_Status AlxParamItem_SetValDouble(AlxParamItem* me, double val);
 Alx_Status AlxParamItem_SetValBool(AlxParamItem* me, bool val);
 void AlxParamItem_SetValArr(AlxParamItem* me, void* val);
 Alx_Status AlxParamItem_SetValStr(AlxParamItem* me, char* val);
+void AlxParamItem_SetValRaw(AlxParamItem* me, void* val);
+Alx_Status AlxParamItem_CheckVal(AlxParamItem* me, void* val);
 
 
 //------------------------------------------------------------------------------
@@ -539,6 +590,15 @@ Alx_Status AlxParamItem_SetVal_StrFormat(AlxParamItem* me, char* val);
 //------------------------------------------------------------------------------
 Alx_Status AlxParamItem_LoadVal(AlxParamItem* me);
 Alx_Status AlxParamItem_StoreVal(AlxParamItem* me);
+void AlxParamItem_SetPendingStore(AlxParamItem* me, bool pendingStore);
+
+
+//------------------------------------------------------------------------------
+// Value Changed
+//------------------------------------------------------------------------------
+void AlxParamItem_SetOwner(AlxParamItem* me, AlxParamItem_Owner* owner, uint32_t ownerIndex);
+bool AlxParamItem_IsValChanged(AlxParamItem* me);
+void AlxParamItem_ClearValChanged(AlxParamItem* me);
 
 
 #endif	// #if defined(ALX_C_LIB)
@@ -25,6 +25,8 @@
   ******************************************************************************
   **/
 
+
+
 //******************************************************************************
 // Includes
 //******************************************************************************
@@ -37,17 +39,53 @@
 #if defined(ALX_C_LIB)
 
 
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+#if defined(ALX_PARAM_KV_STORE_LOG)
+static Alx_Status AlxParamKvStore_Log_Load(AlxParamKvStore* me);
+static Alx_Status AlxParamKvStore_Log_Compact(AlxParamKvStore* me);
+static Alx_Status AlxParamKvStore_Log_ReadRec(AlxParamKvStore* me, uint32_t offset, uint32_t* recLen);
+static Alx_Status AlxParamKvStore_Log_AppendRec(AlxParamKvStore* me, const char* key, void* data, uint32_t len, uint8_t flags, uint32_t* offset);
+static Alx_Status AlxParamKvStore_Log_Find(AlxParamKvStore* me, const char* key, uint32_t* index, bool* isFound);
+static Alx_Status AlxParamKvStore_Log_IndexRec(AlxParamKvStore* me, uint32_t offset);
+static Alx_Status AlxParamKvStore_Log_Apply(AlxParamKvStore* me, uint32_t offsetStart, uint32_t offsetEnd);
+#endif
+
+
 //******************************************************************************
 // Constructor
 //******************************************************************************
 void AlxParamKvStore_Ctor
 (
 	AlxParamKvStore* me,
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	AlxParamKvStore_LogIndexEntry* logIndex,
+	uint32_t logIndexLen,
+	uint8_t* logBuff,
+	uint32_t logBuffLen,
+	#endif
 	AlxFs* fs
 )
 {
 	// Parameters
 	me->fs = fs;
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	me->logIndex = logIndex;
+	me->logIndexLen = logIndexLen;
+	me->logBuff = logBuff;
+	me->logBuffLen = logBuffLen;
+	#endif
+
+	// Variables
+	me->isBatch = false;
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	AlxCrc_Ctor(&me->logCrc, AlxCrc_Config_Ccitt);
+	me->logCrcLen = AlxCrc_GetLen(&me->logCrc);
+	memset(&me->logFile, 0, sizeof(me->logFile));
+	me->logLen = 0;
+	me->logBatchOffset = 0;
+	#endif
 
 	// Info
 	me->wasCtorCalled = true;
@@ -81,6 +119,12 @@ Alx_Status AlxParamKvStore_Init(AlxParamKvStore* me)
 		if (status != Alx_Ok) { return status; }
 	}
 
+	// Load log & build index
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	status = AlxParamKvStore_Log_Load(me);
+	if (status != Alx_Ok) { return status; }
+	#endif
+
 	// Trace
 	ALX_PARAM_KV_STORE_TRACE_INF("AlxParamKvStore_Init - DONE");
 
@@ -95,6 +139,13 @@ Alx_Status AlxParamKvStore_DeInit(AlxParamKvStore* me)
 	// Assert
 	ALX_PARAM_KV_STORE_ASSERT(me->wasCtorCalled == true);
 	ALX_PARAM_KV_STORE_ASSERT(me->isInit == true);
+	ALX_PARAM_KV_STORE_ASSERT(me->isBatch == false);
+
+	// Close log
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	Alx_Status statusClose = AlxFs_File_Close(me->fs, &me->logFile);
+	if (statusClose != Alx_Ok) { return statusClose; }
+	#endif
 
 	// UnMount FS
 	Alx_Status status = AlxFs_UnMount(me->fs);
@@ -112,6 +163,25 @@ Alx_Status AlxParamKvStore_Get(AlxParamKvStore* me, const char* key, void* data,
 	ALX_PARAM_KV_STORE_ASSERT(me->wasCtorCalled == true);
 	ALX_PARAM_KV_STORE_ASSERT(me->isInit == true);
 
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t index = 0;
+	bool isFound = false;
+
+	// Find, record is read to logBuff
+	status = AlxParamKvStore_Log_Find(me, key, &index, &isFound);
+	if (status != Alx_Ok) { return status; }
+	if (isFound == false) { return Alx_Err; }
+	if (me->logBuff[1] & ALX_PARAM_KV_STORE_LOG_REC_FLAG_DEL) { return Alx_Err; }
+
+	// Copy value
+	uint32_t keyLen = me->logBuff[0];
+	uint32_t valLen = (uint32_t)me->logBuff[2] | ((uint32_t)me->logBuff[3] << 8);
+	uint32_t len = (valLen < lenMax) ? valLen : lenMax;
+	memcpy(data, &me->logBuff[ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + keyLen], len);
+	*lenActual = len;
+	#else
 	// Local variables
 	AlxFs_File file;
 	Alx_Status status = Alx_Err;
@@ -127,6 +197,7 @@ Alx_Status AlxParamKvStore_Get(AlxParamKvStore* me, const char* key, void* data,
 	// Close File
 	status = AlxFs_File_Close(me->fs, &file);
 	if (status != Alx_Ok) { return status; }
+	#endif
 
 	// Return
 	return Alx_Ok;
@@ -137,6 +208,52 @@ Alx_Status AlxParamKvStore_Set(AlxParamKvStore* me, const char* key, void* data,
 	ALX_PARAM_KV_STORE_ASSERT(me->wasCtorCalled == true);
 	ALX_PARAM_KV_STORE_ASSERT(me->isInit == true);
 
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t index = 0;
+	bool isFound = false;
+	uint32_t offset = 0;
+	uint32_t recLen = ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + strlen(key) + len + me->logCrcLen;
+	uint32_t recLenCommit = me->isBatch ? (ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + ALX_PARAM_KV_STORE_LOG_REC_COMMIT_VAL_LEN + me->logCrcLen) : 0;	// In batch, space for commit record is reserved
+
+	// Check
+	if (strlen(key) == 0 || strlen(key) > ALX_PARAM_KV_STORE_LOG_KEY_LEN_MAX || len > 0xFFFF || recLen > me->logBuffLen)
+	{
+		ALX_PARAM_KV_STORE_TRACE_WRN("Err: key %s len %u recLen %u", key, len, recLen);
+		return Alx_Err;
+	}
+
+	// Compact, if record does not fit, in batch log is not compacted, because batch records are not in index yet
+	if (me->logLen + recLen + recLenCommit > ALX_PARAM_KV_STORE_LOG_LEN_MAX && me->isBatch == false)
+	{
+		status = AlxParamKvStore_Log_Compact(me);
+		if (status != Alx_Ok) { return status; }
+	}
+	if (me->logLen + recLen + recLenCommit > ALX_PARAM_KV_STORE_LOG_LEN_MAX)
+	{
+		ALX_PARAM_KV_STORE_TRACE_WRN("Err: log full, logLen %u recLen %u", me->logLen, recLen);
+		return Alx_Err;
+	}
+
+	// Append batch record, index is updated on commit
+	if (me->isBatch)
+	{
+		return AlxParamKvStore_Log_AppendRec(me, key, data, len, ALX_PARAM_KV_STORE_LOG_REC_FLAG_BATCH, &offset);
+	}
+
+	// Find index entry
+	status = AlxParamKvStore_Log_Find(me, key, &index, &isFound);
+	if (status != Alx_Ok) { return status; }
+
+	// Append record
+	status = AlxParamKvStore_Log_AppendRec(me, key, data, len, 0, &offset);
+	if (status != Alx_Ok) { return status; }
+
+	// Update index
+	me->logIndex[index].keyHash = AlxGlobal_HashFnv1a(key);
+	me->logIndex[index].offset = offset;
+	#else
 	// Local variables
 	AlxFs_File file;
 	Alx_Status status = Alx_Err;
@@ -152,6 +269,7 @@ Alx_Status AlxParamKvStore_Set(AlxParamKvStore* me, const char* key, void* data,
 	// Close File
 	status = AlxFs_File_Close(me->fs, &file);
 	if (status != Alx_Ok) { return status; }
+	#endif
 
 	// Return
 	return Alx_Ok;
@@ -162,13 +280,457 @@ Alx_Status AlxParamKvStore_Remove(AlxParamKvStore* me, const char* key)
 	ALX_PARAM_KV_STORE_ASSERT(me->wasCtorCalled == true);
 	ALX_PARAM_KV_STORE_ASSERT(me->isInit == true);
 
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t index = 0;
+	bool isFound = false;
+	uint32_t offset = 0;
+	uint32_t recLen = ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + strlen(key) + me->logCrcLen;
+	uint32_t recLenCommit = me->isBatch ? (ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + ALX_PARAM_KV_STORE_LOG_REC_COMMIT_VAL_LEN + me->logCrcLen) : 0;	// In batch, space for commit record is reserved
+
+	// Find, in batch key is checked against committed values
+	status = AlxParamKvStore_Log_Find(me, key, &index, &isFound);
+	if (status != Alx_Ok) { return status; }
+	if (isFound == false || (me->logBuff[1] & ALX_PARAM_KV_STORE_LOG_REC_FLAG_DEL)) { return Alx_Err; }
+
+	// Compact, if record does not fit, removed key is dropped from log by compaction, so index has to be searched again, in batch log is not compacted
+	if (me->logLen + recLen + recLenCommit > ALX_PARAM_KV_STORE_LOG_LEN_MAX && me->isBatch == false)
+	{
+		status = AlxParamKvStore_Log_Compact(me);
+		if (status != Alx_Ok) { return status; }
+		status = AlxParamKvStore_Log_Find(me, key, &index, &isFound);
+		if (status != Alx_Ok) { return status; }
+	}
+	if (me->logLen + recLen + recLenCommit > ALX_PARAM_KV_STORE_LOG_LEN_MAX)
+	{
+		ALX_PARAM_KV_STORE_TRACE_WRN("Err: log full, logLen %u recLen %u", me->logLen, recLen);
+		return Alx_Err;
+	}
+
+	// Append batch delete record, index is updated on commit
+	if (me->isBatch)
+	{
+		return AlxParamKvStore_Log_AppendRec(me, key, NULL, 0, ALX_PARAM_KV_STORE_LOG_REC_FLAG_DEL | ALX_PARAM_KV_STORE_LOG_REC_FLAG_BATCH, &offset);
+	}
+
+	// Append delete record
+	status = AlxParamKvStore_Log_AppendRec(me, key, NULL, 0, ALX_PARAM_KV_STORE_LOG_REC_FLAG_DEL, &offset);
+	if (status != Alx_Ok) { return status; }
+
+	// Update index
+	me->logIndex[index].keyHash = AlxGlobal_HashFnv1a(key);
+	me->logIndex[index].offset = offset;
+	#else
 	// Remove FS
 	Alx_Status status = AlxFs_Remove(me->fs, key);
 	if (status != Alx_Ok) { return status; }
+	#endif
+
+	// Return
+	return Alx_Ok;
+}
+Alx_Status AlxParamKvStore_BeginBatch(AlxParamKvStore* me)
+{
+	// Assert
+	ALX_PARAM_KV_STORE_ASSERT(me->wasCtorCalled == true);
+	ALX_PARAM_KV_STORE_ASSERT(me->isInit == true);
+	ALX_PARAM_KV_STORE_ASSERT(me->isBatch == false);
+
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	// Compact in advance, if log is more than half full, because log is not compacted during batch
+	if (me->logLen > ALX_PARAM_KV_STORE_LOG_LEN_MAX / 2)
+	{
+		Alx_Status status = AlxParamKvStore_Log_Compact(me);
+		if (status != Alx_Ok) { return status; }
+	}
+
+	// Batch records are appended from end of log
+	me->logBatchOffset = me->logLen;
+	#else
+	// Without log, each Set & Remove is written immediately, so batch is not atomic and can not be aborted
+	#endif
+
+	// Set isBatch
+	me->isBatch = true;
+
+	// Return
+	return Alx_Ok;
+}
+Alx_Status AlxParamKvStore_Commit(AlxParamKvStore* me)
+{
+	// Assert
+	ALX_PARAM_KV_STORE_ASSERT(me->wasCtorCalled == true);
+	ALX_PARAM_KV_STORE_ASSERT(me->isInit == true);
+	ALX_PARAM_KV_STORE_ASSERT(me->isBatch == true);
+
+	// Clear isBatch
+	me->isBatch = false;
+
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t offset = 0;
+	uint8_t val[ALX_PARAM_KV_STORE_LOG_REC_COMMIT_VAL_LEN] =
+	{
+		(uint8_t)(me->logBatchOffset & 0xFF),
+		(uint8_t)((me->logBatchOffset >> 8) & 0xFF),
+		(uint8_t)((me->logBatchOffset >> 16) & 0xFF),
+		(uint8_t)((me->logBatchOffset >> 24) & 0xFF)
+	};
+
+	// Check, if batch is empty, there is nothing to commit
+	if (me->logLen == me->logBatchOffset)
+	{
+		return Alx_Ok;
+	}
+
+	// Append commit record, all batch records are committed with its sync, if it fails, batch records are discarded
+	status = AlxParamKvStore_Log_AppendRec(me, "", val, sizeof(val), ALX_PARAM_KV_STORE_LOG_REC_FLAG_COMMIT, &offset);
+	if (status != Alx_Ok)
+	{
+		me->logLen = me->logBatchOffset;
+		AlxFs_File_Truncate(me->fs, &me->logFile, me->logBatchOffset);
+		return status;
+	}
+
+	// Update index
+	status = AlxParamKvStore_Log_Apply(me, me->logBatchOffset, offset);
+	if (status != Alx_Ok) { return status; }
+	#endif
+
+	// Return
+	return Alx_Ok;
+}
+Alx_Status AlxParamKvStore_AbortBatch(AlxParamKvStore* me)
+{
+	// Assert
+	ALX_PARAM_KV_STORE_ASSERT(me->wasCtorCalled == true);
+	ALX_PARAM_KV_STORE_ASSERT(me->isInit == true);
+	ALX_PARAM_KV_STORE_ASSERT(me->isBatch == true);
+
+	// Clear isBatch
+	me->isBatch = false;
+
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	// Discard batch records, if truncate fails, they are overwritten by next append or dropped by AlxParamKvStore_Log_Load, because they have no commit record
+	me->logLen = me->logBatchOffset;
+	Alx_Status status = AlxFs_File_Truncate(me->fs, &me->logFile, me->logBatchOffset);
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+	#endif
+
+	// Return
+	return Alx_Ok;
+}
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+#if defined(ALX_PARAM_KV_STORE_LOG)
+static Alx_Status AlxParamKvStore_Log_Load(AlxParamKvStore* me)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t size = 0;
+	uint32_t offset = 0;
+	uint32_t offsetValid = 0;
+	uint32_t offsetBatch = ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY;
+	uint32_t recLen = 0;
+
+	// Open log, if it does not exist, compaction was interrupted after old log was removed, so tmp log is renamed, if it also does not exist, new log is created
+	// Any other open error is returned, so existing log is never truncated because of transient error
+	status = AlxFs_File_Open(me->fs, &me->logFile, ALX_PARAM_KV_STORE_LOG_PATH, "r+");
+	if (status == AlxFs_ErrNoFile)
+	{
+		status = AlxFs_Rename(me->fs, ALX_PARAM_KV_STORE_LOG_PATH_TMP, ALX_PARAM_KV_STORE_LOG_PATH);
+		if (status == Alx_Ok)
+		{
+			ALX_PARAM_KV_STORE_TRACE_INF("AlxParamKvStore_Log_Load - Interrupted compaction recovered");
+		}
+		status = AlxFs_File_Open(me->fs, &me->logFile, ALX_PARAM_KV_STORE_LOG_PATH, "r+");
+		if (status == AlxFs_ErrNoFile)
+		{
+			status = AlxFs_File_Open(me->fs, &me->logFile, ALX_PARAM_KV_STORE_LOG_PATH, "w+");
+		}
+	}
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+
+	// Size
+	status = AlxFs_File_Size(me->fs, &me->logFile, &size);
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+
+	// Clear index
+	for (uint32_t i = 0; i < me->logIndexLen; i++)
+	{
+		me->logIndex[i].keyHash = 0;
+		me->logIndex[i].offset = ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY;
+	}
+
+	// Scan log, latest record of each key wins, batch records are applied when their commit record is found, scan stops at first invalid record (torn write)
+	while (offset < size)
+	{
+		// Read record
+		status = AlxParamKvStore_Log_ReadRec(me, offset, &recLen);
+		if (status != Alx_Ok) { break; }
+
+		// Update index
+		uint8_t flags = me->logBuff[1];
+		if (flags & ALX_PARAM_KV_STORE_LOG_REC_FLAG_COMMIT)
+		{
+			// Apply batch records from batch offset stored in commit record
+			const uint8_t* val = &me->logBuff[ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN];
+			uint32_t batchOffset = (uint32_t)val[0] | ((uint32_t)val[1] << 8) | ((uint32_t)val[2] << 16) | ((uint32_t)val[3] << 24);
+			status = AlxParamKvStore_Log_Apply(me, batchOffset, offset);
+			if (status != Alx_Ok) { return status; }
+			offsetBatch = ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY;
+		}
+		else if (flags & ALX_PARAM_KV_STORE_LOG_REC_FLAG_BATCH)
+		{
+			// Batch record, applied when commit record is found
+			if (offsetBatch == ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY)
+			{
+				offsetBatch = offset;
+			}
+		}
+		else
+		{
+			status = AlxParamKvStore_Log_IndexRec(me, offset);
+			if (status != Alx_Ok) { return status; }
+			offsetBatch = ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY;	// Preceding batch records without commit record were aborted
+		}
+
+		// Next
+		offset = offset + recLen;
+		if (offsetBatch == ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY)
+		{
+			offsetValid = offset;
+		}
+	}
+
+	// Cut off invalid tail & batch records without commit record (interrupted batch)
+	if (offsetValid < size)
+	{
+		ALX_PARAM_KV_STORE_TRACE_WRN("Err: invalid record or uncommitted batch, log truncated from %u to %u", size, offsetValid);
+		status = AlxFs_File_Truncate(me->fs, &me->logFile, offsetValid);
+		if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+	}
+	me->logLen = offsetValid;
+
+	// Return
+	return Alx_Ok;
+}
+static Alx_Status AlxParamKvStore_Log_Compact(AlxParamKvStore* me)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	AlxFs_File file = {};
+	uint32_t recLen = 0;
+
+	// Trace
+	ALX_PARAM_KV_STORE_TRACE_INF("AlxParamKvStore_Log_Compact - START logLen %u", me->logLen);
+
+	// Copy latest records of all not removed keys to tmp log
+	status = AlxFs_File_Open(me->fs, &file, ALX_PARAM_KV_STORE_LOG_PATH_TMP, "w");
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+	for (uint32_t i = 0; i < me->logIndexLen; i++)
+	{
+		if (me->logIndex[i].offset == ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY) { continue; }
+		status = AlxParamKvStore_Log_ReadRec(me, me->logIndex[i].offset, &recLen);
+		if (status != Alx_Ok) { break; }
+		if (me->logBuff[1] & ALX_PARAM_KV_STORE_LOG_REC_FLAG_DEL) { continue; }
+		if (me->logBuff[1] & ALX_PARAM_KV_STORE_LOG_REC_FLAG_BATCH)
+		{
+			// Committed batch record is copied without batch flag, because its commit record is not copied
+			me->logBuff[1] = me->logBuff[1] & (uint8_t)~ALX_PARAM_KV_STORE_LOG_REC_FLAG_BATCH;
+			uint16_t crc = AlxCrc_Calc(&me->logCrc, me->logBuff, recLen - me->logCrcLen);
+			memcpy(&me->logBuff[recLen - me->logCrcLen], &crc, me->logCrcLen);
+		}
+		status = AlxFs_File_Write(me->fs, &file, me->logBuff, recLen);
+		if (status != Alx_Ok) { break; }
+	}
+	Alx_Status statusClose = AlxFs_File_Close(me->fs, &file);
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+	if (statusClose != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", statusClose); return statusClose; }
+
+	// Replace log with tmp log, if interrupted, it is recovered by AlxParamKvStore_Log_Load
+	status = AlxFs_File_Close(me->fs, &me->logFile);
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+	status = AlxFs_Remove(me->fs, ALX_PARAM_KV_STORE_LOG_PATH);
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+	status = AlxFs_Rename(me->fs, ALX_PARAM_KV_STORE_LOG_PATH_TMP, ALX_PARAM_KV_STORE_LOG_PATH);
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+
+	// Reload
+	status = AlxParamKvStore_Log_Load(me);
+	if (status != Alx_Ok) { return status; }
+
+	// Trace
+	ALX_PARAM_KV_STORE_TRACE_INF("AlxParamKvStore_Log_Compact - DONE logLen %u", me->logLen);
+
+	// Return
+	return Alx_Ok;
+}
+static Alx_Status AlxParamKvStore_Log_ReadRec(AlxParamKvStore* me, uint32_t offset, uint32_t* recLen)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t positionNew = 0;
+	uint32_t lenActual = 0;
+
+	// Seek
+	status = AlxFs_File_Seek(me->fs, &me->logFile, (int32_t)offset, AlxFs_File_Seek_Origin_Set, &positionNew);
+	if (status != Alx_Ok) { return status; }
+
+	// Read header
+	status = AlxFs_File_Read(me->fs, &me->logFile, me->logBuff, ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN, &lenActual);
+	if (status != Alx_Ok || lenActual != ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN) { return Alx_Err; }
+
+	// Check length, commit record has no key
+	uint32_t keyLen = me->logBuff[0];
+	uint32_t valLen = (uint32_t)me->logBuff[2] | ((uint32_t)me->logBuff[3] << 8);
+	uint32_t len = ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + keyLen + valLen + me->logCrcLen;
+	bool isCommit = (me->logBuff[1] & ALX_PARAM_KV_STORE_LOG_REC_FLAG_COMMIT) != 0;
+	if (isCommit && (keyLen != 0 || valLen != ALX_PARAM_KV_STORE_LOG_REC_COMMIT_VAL_LEN)) { return Alx_Err; }
+	if (isCommit == false && keyLen == 0) { return Alx_Err; }
+	if (keyLen > ALX_PARAM_KV_STORE_LOG_KEY_LEN_MAX || len > me->logBuffLen) { return Alx_Err; }
+
+	// Read key, value & CRC
+	status = AlxFs_File_Read(me->fs, &me->logFile, &me->logBuff[ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN], len - ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN, &lenActual);
+	if (status != Alx_Ok || lenActual != len - ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN) { return Alx_Err; }
+
+	// Check CRC
+	uint32_t validatedCrc = 0;
+	if (AlxCrc_IsOk(&me->logCrc, me->logBuff, len, &validatedCrc) == false) { return Alx_Err; }
+
+	// Return
+	*recLen = len;
+	return Alx_Ok;
+}
+static Alx_Status AlxParamKvStore_Log_AppendRec(AlxParamKvStore* me, const char* key, void* data, uint32_t len, uint8_t flags, uint32_t* offset)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t positionNew = 0;
+	uint32_t keyLen = strlen(key);
+	uint32_t lenWithoutCrc = ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + keyLen + len;
+
+	// Prepare record
+	me->logBuff[0] = (uint8_t)keyLen;
+	me->logBuff[1] = flags;
+	me->logBuff[2] = (uint8_t)(len & 0xFF);
+	me->logBuff[3] = (uint8_t)((len >> 8) & 0xFF);
+	memcpy(&me->logBuff[ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN], key, keyLen);
+	if (len > 0)
+	{
+		memcpy(&me->logBuff[ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN + keyLen], data, len);
+	}
+	uint16_t crc = AlxCrc_Calc(&me->logCrc, me->logBuff, lenWithoutCrc);
+	memcpy(&me->logBuff[lenWithoutCrc], &crc, me->logCrcLen);
+
+	// Seek to end of valid log
+	status = AlxFs_File_Seek(me->fs, &me->logFile, (int32_t)me->logLen, AlxFs_File_Seek_Origin_Set, &positionNew);
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+
+	// Write & sync, record is committed with sync, batch records are not synced, they are committed with sync of commit record
+	status = AlxFs_File_Write(me->fs, &me->logFile, me->logBuff, lenWithoutCrc + me->logCrcLen);
+	if (status == Alx_Ok && (flags & ALX_PARAM_KV_STORE_LOG_REC_FLAG_BATCH) == 0)
+	{
+		status = AlxFs_File_Sync(me->fs, &me->logFile);
+	}
+	if (status != Alx_Ok)
+	{
+		ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status);
+		return status;
+	}
+
+	// Return
+	*offset = me->logLen;
+	me->logLen = me->logLen + lenWithoutCrc + me->logCrcLen;
+	return Alx_Ok;
+}
+static Alx_Status AlxParamKvStore_Log_Find(AlxParamKvStore* me, const char* key, uint32_t* index, bool* isFound)
+{
+	// Local variables
+	uint32_t hash = AlxGlobal_HashFnv1a(key);
+	uint32_t keyLen = strlen(key);
+	uint32_t recLen = 0;
+
+	// Linear probing, entry with same hash is checked by comparing key of its record, which stays in logBuff
+	for (uint32_t i = 0; i < me->logIndexLen; i++)
+	{
+		uint32_t j = (hash + i) % me->logIndexLen;
+		if (me->logIndex[j].offset == ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY)
+		{
+			*index = j;
+			*isFound = false;
+			return Alx_Ok;
+		}
+		if (me->logIndex[j].keyHash == hash)
+		{
+			Alx_Status status = AlxParamKvStore_Log_ReadRec(me, me->logIndex[j].offset, &recLen);
+			if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+			if (me->logBuff[0] == keyLen && memcmp(&me->logBuff[ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN], key, keyLen) == 0)
+			{
+				*index = j;
+				*isFound = true;
+				return Alx_Ok;
+			}
+		}
+	}
+
+	// Index full
+	ALX_PARAM_KV_STORE_TRACE_WRN("Err: index full");
+	return Alx_Err;
+}
+static Alx_Status AlxParamKvStore_Log_IndexRec(AlxParamKvStore* me, uint32_t offset)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t index = 0;
+	bool isFound = false;
+	char key[ALX_PARAM_KV_STORE_LOG_KEY_LEN_MAX + 1] = "";
+
+	// Get key, record at offset must be in logBuff
+	uint32_t keyLen = me->logBuff[0];
+	memcpy(key, &me->logBuff[ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN], keyLen);
+	key[keyLen] = '\0';
+
+	// Find index entry
+	status = AlxParamKvStore_Log_Find(me, key, &index, &isFound);
+	if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+
+	// Update index
+	me->logIndex[index].keyHash = AlxGlobal_HashFnv1a(key);
+	me->logIndex[index].offset = offset;
+
+	// Return
+	return Alx_Ok;
+}
+static Alx_Status AlxParamKvStore_Log_Apply(AlxParamKvStore* me, uint32_t offsetStart, uint32_t offsetEnd)
+{
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t offset = offsetStart;
+	uint32_t recLen = 0;
+
+	// Update index with all records in range
+	while (offset < offsetEnd)
+	{
+		status = AlxParamKvStore_Log_ReadRec(me, offset, &recLen);
+		if (status != Alx_Ok) { ALX_PARAM_KV_STORE_TRACE_WRN("Err: %d", status); return status; }
+		if ((me->logBuff[1] & ALX_PARAM_KV_STORE_LOG_REC_FLAG_COMMIT) == 0)
+		{
+			status = AlxParamKvStore_Log_IndexRec(me, offset);
+			if (status != Alx_Ok) { return status; }
+		}
+		offset = offset + recLen;
+	}
 
 	// Return
 	return Alx_Ok;
 }
+#endif
 
 
 #endif	// #if defined(ALX_C_LIB)
@@ -43,6 +43,7 @@ extern "C" {
 #include "alxTrace.h"
 #include "alxAssert.h"
 #include "alxFs.h"
+#include "alxCrc.h"
 
 
 //******************************************************************************
@@ -76,14 +77,62 @@ extern "C" {
 	#define ALX_PARAM_KV_STORE_TRACE_INF(...) do{} while (false)
 #endif
 
+// Defines
+#if defined(ALX_PARAM_KV_STORE_LOG)
+	#ifndef ALX_PARAM_KV_STORE_LOG_PATH
+		#define ALX_PARAM_KV_STORE_LOG_PATH "/paramKvStoreLog.bin"	// Log file path
+	#endif
+	#ifndef ALX_PARAM_KV_STORE_LOG_PATH_TMP
+		#define ALX_PARAM_KV_STORE_LOG_PATH_TMP "/paramKvStoreLogTmp.bin"	// Log file path used while log is compacted
+	#endif
+	#ifndef ALX_PARAM_KV_STORE_LOG_LEN_MAX
+		#define ALX_PARAM_KV_STORE_LOG_LEN_MAX 32768	// Log is compacted when next record would not fit
+	#endif
+	#ifndef ALX_PARAM_KV_STORE_LOG_KEY_LEN_MAX
+		#define ALX_PARAM_KV_STORE_LOG_KEY_LEN_MAX 64	// Max key length without termination
+	#endif
+#endif
+
 
 //******************************************************************************
 // Types
 //******************************************************************************
+#if defined(ALX_PARAM_KV_STORE_LOG)
 typedef struct
 {
+	uint32_t keyHash;
+	uint32_t offset;	// Offset of latest record of key in log, ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY if entry is empty
+} AlxParamKvStore_LogIndexEntry;
+#endif
+
+typedef struct
+{
+	// Defines
+	#define ALX_PARAM_KV_STORE_LOG_OFFSET_EMPTY 0xFFFFFFFF
+	#define ALX_PARAM_KV_STORE_LOG_REC_HEADER_LEN 4	// keyLen (1) + flags (1) + valLen (2)
+	#define ALX_PARAM_KV_STORE_LOG_REC_FLAG_DEL 0x01
+	#define ALX_PARAM_KV_STORE_LOG_REC_FLAG_BATCH 0x02	// Record belongs to batch, it is valid only if followed by commit record
+	#define ALX_PARAM_KV_STORE_LOG_REC_FLAG_COMMIT 0x04	// Record without key, which commits batch records from offset stored as its value
+	#define ALX_PARAM_KV_STORE_LOG_REC_COMMIT_VAL_LEN 4	// Batch offset (4), little-endian
+
 	// Parameters
 	AlxFs* fs;
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	AlxParamKvStore_LogIndexEntry* logIndex;
+	uint32_t logIndexLen;
+	uint8_t* logBuff;
+	uint32_t logBuffLen;
+	#endif
+
+	// Variables
+	bool isBatch;
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	AlxCrc logCrc;
+	uint32_t logCrcLen;
+	AlxFs_File logFile;
+	uint32_t logLen;
+	uint32_t logBatchOffset;
+	#endif
 
 	// Info
 	bool wasCtorCalled;
@@ -97,6 +146,12 @@ typedef struct
 void AlxParamKvStore_Ctor
 (
 	AlxParamKvStore* me,
+	#if defined(ALX_PARAM_KV_STORE_LOG)
+	AlxParamKvStore_LogIndexEntry* logIndex,
+	uint32_t logIndexLen,
+	uint8_t* logBuff,
+	uint32_t logBuffLen,
+	#endif
 	AlxFs* fs
 );
 
@@ -109,6 +164,9 @@ Alx_Status AlxParamKvStore_DeInit(AlxParamKvStore* me);
 Alx_Status AlxParamKvStore_Get(AlxParamKvStore* me, const char* key, void* data, uint32_t lenMax, uint32_t* lenActual);
 Alx_Status AlxParamKvStore_Set(AlxParamKvStore* me, const char* key, void* data, uint32_t len);
 Alx_Status AlxParamKvStore_Remove(AlxParamKvStore* me, const char* key);
+Alx_Status AlxParamKvStore_BeginBatch(AlxParamKvStore* me);
+Alx_Status AlxParamKvStore_Commit(AlxParamKvStore* me);
+Alx_Status AlxParamKvStore_AbortBatch(AlxParamKvStore* me);
 
 
 #endif	// #if defined(ALX_C_LIB)
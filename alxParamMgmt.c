@@ -37,6 +37,28 @@
 #if defined(ALX_C_LIB)
 
 
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static AlxParamItem* AlxParamMgmt_FindById(AlxParamMgmt* me, uint32_t id);
+static AlxParamItem* AlxParamMgmt_FindByKey(AlxParamMgmt* me, const char* key);
+static Alx_Status AlxParamMgmt_StoreVal(AlxParamMgmt* me, bool all, uint32_t groupId);
+static Alx_Status AlxParamMgmt_StoreVal_Batch(AlxParamMgmt* me, bool all, uint32_t groupId, bool* isPendingOther);
+static void AlxParamMgmt_StoreVal_Restore(AlxParamMgmt* me);
+static void AlxParamMgmt_ValChanged(void* ctx, uint32_t index, void* valOld);
+static AlxParamMgmt_ValChangedSub* AlxParamMgmt_ValChangedSub_Get(AlxParamMgmt* me, bool all, uint32_t groupId);
+static void AlxParamMgmt_ValChangedSub_Free(AlxParamMgmt_ValChangedSub* sub);
+static void AlxParamMgmt_Snapshot_PutLe(uint8_t* data, uint64_t val, uint32_t len);
+static uint64_t AlxParamMgmt_Snapshot_GetLe(uint8_t* data, uint32_t len);
+static void AlxParamMgmt_Snapshot_ValToLe(uint8_t* data, void* val, uint32_t valLen, uint8_t dataType);
+static void AlxParamMgmt_Snapshot_LeToVal(void* val, uint8_t* data, uint32_t valLen, uint8_t dataType);
+static Alx_Status AlxParamMgmt_Snapshot_Stage(AlxParamMgmt* me, uint8_t* data, uint32_t len);
+static void AlxParamMgmt_Snapshot_Apply(AlxParamMgmt* me, uint8_t* data, uint32_t len);
+#if defined(ALX_PARAM_MGMT_INDEX)
+static void AlxParamMgmt_Index_Build(AlxParamMgmt* me);
+#endif
+
+
 //******************************************************************************
 // Constructor
 //******************************************************************************
@@ -44,13 +66,46 @@ void AlxParamMgmt_Ctor
 (
 	AlxParamMgmt* me,
 	AlxParamItem* paramItemArr,
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	uint16_t* idIndex,
+	uint16_t* keyIndex,
+	uint32_t keyIndexLen,
+	#endif
+	uint32_t* bitmap,
 	uint32_t numOfParamItems
 )
 {
 	// Parameters
 	me->paramItemArr = paramItemArr;
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	me->idIndex = idIndex;
+	me->keyIndex = keyIndex;
+	me->keyIndexLen = keyIndexLen;
+	#endif
+	me->bitmap = bitmap;
 	me->numOfParamItems = numOfParamItems;
 
+	// Variables
+	memset(bitmap, 0, ALX_PARAM_MGMT_BITMAP_LEN(numOfParamItems) * sizeof(uint32_t));
+	me->pendingStoreBitmap = bitmap;
+	me->scratchBitmap = bitmap + ALX_PARAM_MGMT_BITMAP_WORD_LEN(numOfParamItems);
+	me->owner.pendingStoreBitmap = me->pendingStoreBitmap;
+	me->owner.valChanged = AlxParamMgmt_ValChanged;
+	me->owner.valChanged_Ctx = me;
+	memset(me->valChangedSubArr, 0, sizeof(me->valChangedSubArr));
+	AlxCrc_Ctor(&me->snapshotCrc, AlxCrc_Config_Ccitt);
+
+	// Set owner to items, items must already be constructed, all items are tracked in pending store bitmap
+	for (uint32_t i = 0; i < numOfParamItems; i++)
+	{
+		AlxParamItem_SetOwner(&paramItemArr[i], &me->owner, i);
+	}
+
+	// Build index, items must already be constructed
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	AlxParamMgmt_Index_Build(me);
+	#endif
+
 	// Info
 	me->wasCtorCalled = true;
 }
@@ -197,6 +252,22 @@ uint32_t AlxParamMgmt_ByIndex_GetValLen(AlxParamMgmt* me, uint32_t index)
 	// Return
 	return AlxParamItem_GetValLen(ptr);
 }
+uint32_t AlxParamMgmt_ByIndex_GetValLenMax(AlxParamMgmt* me, uint32_t index)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
+	ALX_PARAM_MGMT_ASSERT(index < me->numOfParamItems);
+
+	// Get pointer
+	AlxParamItem* ptr = &me->paramItemArr[index];
+
+	// Return
+	if (AlxParamItem_GetDataType(ptr) == AlxParamItem_Str)
+	{
+		return AlxParamItem_GetBuffLen(ptr);
+	}
+	return AlxParamItem_GetValLen(ptr);
+}
 Alx_Status AlxParamMgmt_ByIndex_GetVal_StrFormat(AlxParamMgmt* me, uint32_t index, char* val, uint32_t maxLenWithNullTerm)
 {
 	// Assert
@@ -222,28 +293,38 @@ Alx_Status AlxParamMgmt_ByKey_SetVal_StrFormat(AlxParamMgmt* me, char* key, char
 	// Assert
 	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-	// Loop through all parameters
-	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	// Find
+	AlxParamItem* ptr = AlxParamMgmt_FindByKey(me, key);
+	if (ptr == NULL)
 	{
-		// Get pointer
-		AlxParamItem* ptr = &me->paramItemArr[i];
+		// If we are here, key was not found, so we return ERROR
+		return Alx_Err;
+	}
 
-		// Get key
-		const char* _key = AlxParamItem_GetKey(ptr);
+	// Set
+	Alx_Status status = AlxParamItem_SetVal_StrFormat(ptr, val);
 
-		// If key match, set value
-		if (strcmp(key, _key) == 0)
-		{
-			// Set
-			Alx_Status status = AlxParamItem_SetVal_StrFormat(ptr, val);
+	// Return
+	return status;
+}
+Alx_Status AlxParamMgmt_ByKey_GetIndex(AlxParamMgmt* me, const char* key, uint32_t* index)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-			// Return
-			return status;
-		}
+	// Find
+	AlxParamItem* ptr = AlxParamMgmt_FindByKey(me, key);
+	if (ptr == NULL)
+	{
+		// If we are here, key was not found, so we return ERROR
+		return Alx_Err;
 	}
 
-	// If we are here, key was not found, so we return ERROR
-	return Alx_Err;
+	// Set, index stays valid for lifetime of me, so it can be cached for ByIndex functions
+	*index = (uint32_t)(ptr - me->paramItemArr);
+
+	// Return
+	return Alx_Ok;
 }
 
 
@@ -255,105 +336,136 @@ Alx_Status AlxParamMgmt_ById_GetValLen(AlxParamMgmt* me, uint32_t id, uint32_t*
 	// Assert
 	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-	// Loop through all parameters
-	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	// Find
+	AlxParamItem* ptr = AlxParamMgmt_FindById(me, id);
+	if (ptr == NULL)
 	{
-		// Get pointer
-		AlxParamItem* ptr = &me->paramItemArr[i];
-
-		// Get id
-		uint32_t _id = AlxParamItem_GetId(ptr);
-
-		// If id match, set value
-		if (id == _id)
-		{
-			// Get
-			uint32_t _valLen = AlxParamItem_GetValLen(ptr);
+		// If we are here, id was not found, so we return ERROR
+		return Alx_Err;
+	}
 
-			// Set
-			*valLen = _valLen;
+	// Get
+	uint32_t _valLen = AlxParamItem_GetValLen(ptr);
 
-			// Return
-			return Alx_Ok;
-		}
-	}
+	// Set
+	*valLen = _valLen;
 
-	// If we are here, id was not found, so we return ERROR
-	return Alx_Err;
+	// Return
+	return Alx_Ok;
 }
 Alx_Status AlxParamMgmt_ById_Get(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len)
 {
 	// Assert
 	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-	// Loop through all parameters
-	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	// Find
+	AlxParamItem* ptr = AlxParamMgmt_FindById(me, id);
+	if (ptr == NULL)
 	{
-		// Get pointer
-		AlxParamItem* ptr = &me->paramItemArr[i];
+		// If we are here, id was not found, so we return ERROR
+		return Alx_Err;
+	}
 
-		// Get id
-		uint32_t _id = AlxParamItem_GetId(ptr);
+	// Get valPtr
+	void* valPtr = AlxParamItem_GetValPtr(ptr);
 
-		// If id match, get value
-		if (id == _id)
-		{
-			// Get valPtr
-			void* valPtr = AlxParamItem_GetValPtr(ptr);
+	// Get valLen
+	uint32_t valLen = AlxParamItem_GetValLen(ptr);
 
-			// Get valLen
-			uint32_t valLen = AlxParamItem_GetValLen(ptr);
+	// Check len
+	ALX_PARAM_MGMT_ASSERT(len >= valLen);
 
-			// Check len
-			ALX_PARAM_MGMT_ASSERT(len >= valLen);
+	// Copy
+	memcpy(val, valPtr, valLen);
 
-			// Copy
-			memcpy(val, valPtr, valLen);
+	// Return
+	return Alx_Ok;
+}
+Alx_Status AlxParamMgmt_ById_Set(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-			// Return
-			return Alx_Ok;
-		}
+	// Find
+	AlxParamItem* ptr = AlxParamMgmt_FindById(me, id);
+	if (ptr == NULL)
+	{
+		// If we are here, id was not found, so we return ERROR
+		return Alx_Err;
 	}
 
-	// If we are here, id was not found, so we return ERROR
-	return Alx_Err;
+	// Check len
+	ALX_PARAM_MGMT_ASSERT(len >= AlxParamItem_GetValLen(ptr));
+
+	// Copy, change is tracked by item
+	AlxParamItem_SetValRaw(ptr, val);
+
+	// Return
+	return Alx_Ok;
 }
-Alx_Status AlxParamMgmt_ById_Set(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len)
+Alx_Status AlxParamMgmt_ById_CheckVal(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len)
 {
 	// Assert
 	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-	// Loop through all parameters
-	for (uint32_t i = 0; i < me->numOfParamItems; i++)
-	{
-		// Get pointer
-		AlxParamItem* ptr = &me->paramItemArr[i];
+	// Find
+	AlxParamItem* ptr = AlxParamMgmt_FindById(me, id);
+	if (ptr == NULL) { ALX_PARAM_MGMT_TRACE("Err: id %lu not found", id); return Alx_Err; }
 
-		// Get id
-		uint32_t _id = AlxParamItem_GetId(ptr);
+	// Check len, Str must be null terminated within len, other types must match exactly
+	if (AlxParamItem_GetDataType(ptr) == AlxParamItem_Str)
+	{
+		if ((len == 0) || (memchr(val, '\0', len) == NULL)) { ALX_PARAM_MGMT_TRACE("Err: id %lu str", id); return Alx_Err; }
+	}
+	else
+	{
+		if (len != AlxParamItem_GetValLen(ptr)) { ALX_PARAM_MGMT_TRACE("Err: id %lu len", id); return Alx_Err; }
+	}
 
-		// If id match, get value
-		if (id == _id)
-		{
-			// Get valPtr
-			void* valPtr = AlxParamItem_GetValPtr(ptr);
+	// Check enum & range
+	return AlxParamItem_CheckVal(ptr, val);
+}
+Alx_Status AlxParamMgmt_ById_SetVal(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-			// Get valLen
-			uint32_t valLen = AlxParamItem_GetValLen(ptr);
+	// Check, unlike AlxParamMgmt_ById_Set, value is rejected if NOT valid
+	Alx_Status status = AlxParamMgmt_ById_CheckVal(me, id, val, len);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
 
-			// Check len
-			ALX_PARAM_MGMT_ASSERT(len >= valLen);
+	// Set, change is tracked by item
+	AlxParamItem* ptr = AlxParamMgmt_FindById(me, id);
+	if (AlxParamItem_GetDataType(ptr) == AlxParamItem_Str)
+	{
+		return AlxParamItem_SetValStr(ptr, (char*)val);
+	}
+	AlxParamItem_SetValRaw(ptr, val);
 
-			// Copy
-			memcpy(valPtr, val, valLen);
+	// Return
+	return Alx_Ok;
+}
+Alx_Status AlxParamMgmt_ById_GetIndex(AlxParamMgmt* me, uint32_t id, uint32_t* index)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-			// Return
-			return Alx_Ok;
-		}
+	// Find
+	AlxParamItem* ptr = AlxParamMgmt_FindById(me, id);
+	if (ptr == NULL)
+	{
+		// If we are here, id was not found, so we return ERROR
+		return Alx_Err;
 	}
 
-	// If we are here, id was not found, so we return ERROR
-	return Alx_Err;
+	// Set
+	*index = (uint32_t)(ptr - me->paramItemArr);
+
+	// Return
+	return Alx_Ok;
 }
 
 
@@ -456,42 +568,278 @@ Alx_Status AlxParamMgmt_StoreVal_Group(AlxParamMgmt* me, uint32_t groupId)
 	// Assert
 	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
-	// Loop through all parameters
+	// Store pending values of group
+	return AlxParamMgmt_StoreVal(me, false, groupId);
+}
+Alx_Status AlxParamMgmt_StoreVal_All(AlxParamMgmt* me)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
+
+	// Store all pending values
+	return AlxParamMgmt_StoreVal(me, true, 0);
+}
+
+
+//------------------------------------------------------------------------------
+// Value Changed
+//------------------------------------------------------------------------------
+void AlxParamMgmt_SetValChangedCallback_Group(AlxParamMgmt* me, uint32_t groupId, void (*valChanged_Callback)(void* ctx, uint32_t id, void* valOld, void* valNew), void* valChanged_Callback_Ctx)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
+
+	// Subscribe, one callback per group, NULL unsubscribes
+	AlxParamMgmt_ValChangedSub* sub = AlxParamMgmt_ValChangedSub_Get(me, false, groupId);
+	if (sub == NULL)
+	{
+		return;
+	}
+	sub->valChanged_Callback = valChanged_Callback;
+	sub->valChanged_Callback_Ctx = valChanged_Callback_Ctx;
+	AlxParamMgmt_ValChangedSub_Free(sub);
+}
+void AlxParamMgmt_SetValChangedCallback_All(AlxParamMgmt* me, void (*valChanged_Callback)(void* ctx, uint32_t id, void* valOld, void* valNew), void* valChanged_Callback_Ctx)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
+
+	// Subscribe, one global callback, it is called in addition to group callback, NULL unsubscribes
+	AlxParamMgmt_ValChangedSub* sub = AlxParamMgmt_ValChangedSub_Get(me, true, 0);
+	if (sub == NULL)
+	{
+		return;
+	}
+	sub->valChanged_Callback = valChanged_Callback;
+	sub->valChanged_Callback_Ctx = valChanged_Callback_Ctx;
+	AlxParamMgmt_ValChangedSub_Free(sub);
+}
+void AlxParamMgmt_SetValChangedEventFlag_Group(AlxParamMgmt* me, uint32_t groupId, AlxOsEventFlagGroup* eventFlagGroup, uint32_t eventFlags)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
+
+	// Subscribe, one event flag group per group, NULL unsubscribes
+	AlxParamMgmt_ValChangedSub* sub = AlxParamMgmt_ValChangedSub_Get(me, false, groupId);
+	if (sub == NULL)
+	{
+		return;
+	}
+	sub->eventFlagGroup = eventFlagGroup;
+	sub->eventFlags = eventFlags;
+	AlxParamMgmt_ValChangedSub_Free(sub);
+}
+void AlxParamMgmt_SetValChangedEventFlag_All(AlxParamMgmt* me, AlxOsEventFlagGroup* eventFlagGroup, uint32_t eventFlags)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
+
+	// Subscribe, one global event flag group, NULL unsubscribes
+	AlxParamMgmt_ValChangedSub* sub = AlxParamMgmt_ValChangedSub_Get(me, true, 0);
+	if (sub == NULL)
+	{
+		return;
+	}
+	sub->eventFlagGroup = eventFlagGroup;
+	sub->eventFlags = eventFlags;
+	AlxParamMgmt_ValChangedSub_Free(sub);
+}
+
+
+//------------------------------------------------------------------------------
+// Snapshot
+//------------------------------------------------------------------------------
+Alx_Status AlxParamMgmt_ExportSnapshot(AlxParamMgmt* me, uint8_t* data, uint32_t lenMax, uint32_t* lenActual)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
+
+	// Local variables
+	uint32_t crcLen = AlxCrc_GetLen(&me->snapshotCrc);
+	uint32_t offset = ALX_PARAM_MGMT_SNAPSHOT_HEADER_LEN;
+	uint16_t ver = ALX_PARAM_MGMT_SNAPSHOT_VER;
+	uint16_t numOfRecs = 0;
+
+	// Check len
+	if (lenMax < ALX_PARAM_MGMT_SNAPSHOT_HEADER_LEN + crcLen)
+	{
+		ALX_PARAM_MGMT_TRACE("Err: lenMax");
+		return Alx_Err;
+	}
+
+	// Loop through all parameters, only AlxParamItem_Param are exported
 	for (uint32_t i = 0; i < me->numOfParamItems; i++)
 	{
 		// Get pointer
 		AlxParamItem* ptr = &me->paramItemArr[i];
 
-		// Get groupId
-		uint32_t _groupId = AlxParamItem_GetGroupId(ptr);
+		// If not param, skip
+		if (AlxParamItem_GetParamType(ptr) != AlxParamItem_Param)
+		{
+			continue;
+		}
 
-		// If groupId match, store value
-		if (groupId == _groupId)
+		// Check len
+		uint32_t id = AlxParamItem_GetId(ptr);
+		uint8_t dataType = (uint8_t)AlxParamItem_GetDataType(ptr);
+		uint16_t valLen = (uint16_t)AlxParamItem_GetValLen(ptr);
+		if (offset + ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN + valLen + crcLen > lenMax)
 		{
-			Alx_Status status = AlxParamItem_StoreVal(ptr);
-			if (status != Alx_Ok)
-			{
-				return status;
-			}
+			ALX_PARAM_MGMT_TRACE("Err: lenMax");
+			return Alx_Err;
 		}
+
+		// Write record, little-endian
+		AlxParamMgmt_Snapshot_PutLe(&data[offset], id, 4);
+		AlxParamMgmt_Snapshot_PutLe(&data[offset + 4], dataType, 1);
+		AlxParamMgmt_Snapshot_PutLe(&data[offset + 5], valLen, 2);
+		AlxParamMgmt_Snapshot_ValToLe(&data[offset + ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN], AlxParamItem_GetValPtr(ptr), valLen, dataType);
+		offset = offset + ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN + valLen;
+		numOfRecs++;
 	}
 
-	// If we are here, all parameters were stored successfully, so we return OK
+	// Write header, little-endian
+	AlxParamMgmt_Snapshot_PutLe(&data[0], ver, 2);
+	AlxParamMgmt_Snapshot_PutLe(&data[2], numOfRecs, 2);
+
+	// Write CRC, little-endian
+	uint32_t crc = AlxCrc_Calc(&me->snapshotCrc, data, offset);
+	AlxParamMgmt_Snapshot_PutLe(&data[offset], crc, crcLen);
+	*lenActual = offset + crcLen;
+
+	// Return
 	return Alx_Ok;
 }
-Alx_Status AlxParamMgmt_StoreVal_All(AlxParamMgmt* me)
+Alx_Status AlxParamMgmt_ImportSnapshot(AlxParamMgmt* me, uint8_t* data, uint32_t len)
 {
 	// Assert
 	ALX_PARAM_MGMT_ASSERT(me->wasCtorCalled == true);
 
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint32_t crcLen = AlxCrc_GetLen(&me->snapshotCrc);
+	uint32_t ver = 0;
+
+	// Check len & CRC, CRC is little-endian
+	if (len < ALX_PARAM_MGMT_SNAPSHOT_HEADER_LEN + crcLen)
+	{
+		ALX_PARAM_MGMT_TRACE("Err: len");
+		return Alx_Err;
+	}
+	if (AlxCrc_Calc(&me->snapshotCrc, data, len - crcLen) != (uint32_t)AlxParamMgmt_Snapshot_GetLe(&data[len - crcLen], crcLen))
+	{
+		ALX_PARAM_MGMT_TRACE("Err: CRC");
+		return Alx_Err;
+	}
+
+	// Check version
+	ver = (uint32_t)AlxParamMgmt_Snapshot_GetLe(&data[0], 2);
+	if (ver != ALX_PARAM_MGMT_SNAPSHOT_VER)
+	{
+		ALX_PARAM_MGMT_TRACE("Err: ver %lu", ver);
+		return Alx_Err;
+	}
+
+	// Stage, whole snapshot is parsed & validated, nothing is set, if any record is invalid
+	status = AlxParamMgmt_Snapshot_Stage(me, data, len - crcLen);
+	if (status != Alx_Ok)
+	{
+		return status;
+	}
+
+	// Apply, can not fail, because all records were staged
+	AlxParamMgmt_Snapshot_Apply(me, data, len - crcLen);
+
+	// Store all changed values in single batch, if store fails, values stay applied with pending store, so next store retries
+	return AlxParamMgmt_StoreVal_All(me);
+}
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static AlxParamItem* AlxParamMgmt_FindById(AlxParamMgmt* me, uint32_t id)
+{
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	// Binary search through id index
+	uint32_t low = 0;
+	uint32_t high = me->numOfParamItems;
+	while (low < high)
+	{
+		uint32_t mid = low + (high - low) / 2;
+		AlxParamItem* ptr = &me->paramItemArr[me->idIndex[mid]];
+		uint32_t _id = AlxParamItem_GetId(ptr);
+		if (id == _id)
+		{
+			return ptr;
+		}
+		else if (_id < id)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+	#else
+	// Loop through all parameters
+	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	{
+		AlxParamItem* ptr = &me->paramItemArr[i];
+		if (id == AlxParamItem_GetId(ptr))
+		{
+			return ptr;
+		}
+	}
+	#endif
+
+	// Not found
+	return NULL;
+}
+static AlxParamItem* AlxParamMgmt_FindByKey(AlxParamMgmt* me, const char* key)
+{
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	// Linear probing through key index, empty entry ends search
+	uint32_t j = AlxGlobal_HashFnv1a(key) % me->keyIndexLen;
+	for (uint32_t i = 0; i < me->keyIndexLen; i++)
+	{
+		if (me->keyIndex[j] == ALX_PARAM_MGMT_INDEX_EMPTY)
+		{
+			break;
+		}
+		AlxParamItem* ptr = &me->paramItemArr[me->keyIndex[j]];
+		if (strcmp(key, AlxParamItem_GetKey(ptr)) == 0)
+		{
+			return ptr;
+		}
+		j = (j + 1) % me->keyIndexLen;
+	}
+	#else
 	// Loop through all parameters
 	for (uint32_t i = 0; i < me->numOfParamItems; i++)
 	{
-		// Get pointer
 		AlxParamItem* ptr = &me->paramItemArr[i];
+		if (strcmp(key, AlxParamItem_GetKey(ptr)) == 0)
+		{
+			return ptr;
+		}
+	}
+	#endif
+
+	// Not found
+	return NULL;
+}
+static Alx_Status AlxParamMgmt_StoreVal(AlxParamMgmt* me, bool all, uint32_t groupId)
+{
+	// Local variables
+	bool isPendingOther = true;
 
-		// Store value
-		Alx_Status status = AlxParamItem_StoreVal(ptr);
+	// Store pending items of each KV store in its own batch, until no items of other KV stores are pending
+	while (isPendingOther)
+	{
+		isPendingOther = false;
+		Alx_Status status = AlxParamMgmt_StoreVal_Batch(me, all, groupId, &isPendingOther);
 		if (status != Alx_Ok)
 		{
 			return status;
@@ -501,6 +849,353 @@ Alx_Status AlxParamMgmt_StoreVal_All(AlxParamMgmt* me)
 	// If we are here, all parameters were stored successfully, so we return OK
 	return Alx_Ok;
 }
+static Alx_Status AlxParamMgmt_StoreVal_Batch(AlxParamMgmt* me, bool all, uint32_t groupId, bool* isPendingOther)
+{
+	// Local variables
+	AlxParamKvStore* paramKvStore = NULL;
+	Alx_Status status = Alx_Err;
+
+	// Clear bits of items stored in batch, so that their pending store can be restored, if batch is not committed
+	memset(me->scratchBitmap, 0, ALX_PARAM_MGMT_BITMAP_WORD_LEN(me->numOfParamItems) * sizeof(uint32_t));
+
+	// Loop through parameters with pending store, items without it are skipped before batch is begun, so only pending items of other KV stores cause next batch
+	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	{
+		// Skip items without pending store, whole bitmap word at once, if it is clear
+		uint32_t word = me->pendingStoreBitmap[i / 32];
+		if (word == 0)
+		{
+			i = i | 31;
+			continue;
+		}
+		if ((word & (1UL << (i % 32))) == 0)
+		{
+			continue;
+		}
+
+		// Get pointer
+		AlxParamItem* ptr = &me->paramItemArr[i];
+
+		// If groupId does not match, skip
+		if (all == false && AlxParamItem_GetGroupId(ptr) != groupId)
+		{
+			continue;
+		}
+
+		// Begin batch on first pending item, so that all values of its KV store are committed together
+		if (paramKvStore == NULL)
+		{
+			paramKvStore = AlxParamItem_GetParamKvStore(ptr);
+			status = AlxParamKvStore_BeginBatch(paramKvStore);
+			if (status != Alx_Ok)
+			{
+				return status;
+			}
+		}
+
+		// If item is in other KV store, skip, it is stored in next batch
+		if (AlxParamItem_GetParamKvStore(ptr) != paramKvStore)
+		{
+			*isPendingOther = true;
+			continue;
+		}
+
+		// Store value, pending store bit is cleared by item
+		status = AlxParamItem_StoreVal(ptr);
+		if (status != Alx_Ok)
+		{
+			AlxParamKvStore_AbortBatch(paramKvStore);
+			AlxParamMgmt_StoreVal_Restore(me);
+			return status;
+		}
+		me->scratchBitmap[i / 32] = me->scratchBitmap[i / 32] | (1UL << (i % 32));
+	}
+
+	// Commit batch
+	if (paramKvStore != NULL)
+	{
+		status = AlxParamKvStore_Commit(paramKvStore);
+		if (status != Alx_Ok)
+		{
+			AlxParamMgmt_StoreVal_Restore(me);
+			return status;
+		}
+	}
+
+	// Return
+	return Alx_Ok;
+}
+static void AlxParamMgmt_StoreVal_Restore(AlxParamMgmt* me)
+{
+	// Set pending store again for all items stored in not committed batch
+	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	{
+		if (me->scratchBitmap[i / 32] & (1UL << (i % 32)))
+		{
+			AlxParamItem_SetPendingStore(&me->paramItemArr[i], true);
+		}
+	}
+}
+static void AlxParamMgmt_ValChanged(void* ctx, uint32_t index, void* valOld)
+{
+	// Local variables
+	AlxParamMgmt* me = (AlxParamMgmt*)ctx;
+	AlxParamItem* ptr = &me->paramItemArr[index];
+	uint32_t groupId = AlxParamItem_GetGroupId(ptr);
+
+	// Loop through subscriptions of item group & global subscriptions
+	for (uint32_t i = 0; i < ALX_PARAM_MGMT_VAL_CHANGED_SUB_LEN; i++)
+	{
+		// Get pointer
+		AlxParamMgmt_ValChangedSub* sub = &me->valChangedSubArr[i];
+
+		// If not used or groupId does not match, skip
+		if (sub->isUsed == false || (sub->all == false && sub->groupId != groupId))
+		{
+			continue;
+		}
+
+		// Call callback, valOld is NULL only for Arr longer than ALX_PARAM_ITEM_BUFF_LEN, because old value is kept in stack buffer of that length
+		if (sub->valChanged_Callback != NULL)
+		{
+			sub->valChanged_Callback(sub->valChanged_Callback_Ctx, AlxParamItem_GetId(ptr), valOld, AlxParamItem_GetValPtr(ptr));
+		}
+
+		// Set event flags
+		if (sub->eventFlagGroup != NULL)
+		{
+			AlxOsEventFlagGroup_Set(sub->eventFlagGroup, sub->eventFlags, false);
+		}
+	}
+}
+static AlxParamMgmt_ValChangedSub* AlxParamMgmt_ValChangedSub_Get(AlxParamMgmt* me, bool all, uint32_t groupId)
+{
+	// Local variables
+	AlxParamMgmt_ValChangedSub* subFree = NULL;
+
+	// Find existing subscription, else first free one
+	for (uint32_t i = 0; i < ALX_PARAM_MGMT_VAL_CHANGED_SUB_LEN; i++)
+	{
+		AlxParamMgmt_ValChangedSub* sub = &me->valChangedSubArr[i];
+		if (sub->isUsed && sub->all == all && (all || sub->groupId == groupId))
+		{
+			return sub;
+		}
+		if (sub->isUsed == false && subFree == NULL)
+		{
+			subFree = sub;
+		}
+	}
+
+	// Take free subscription
+	if (subFree == NULL)
+	{
+		ALX_PARAM_MGMT_ASSERT(false);	// Increase ALX_PARAM_MGMT_VAL_CHANGED_SUB_LEN
+		return NULL;
+	}
+	memset(subFree, 0, sizeof(AlxParamMgmt_ValChangedSub));
+	subFree->isUsed = true;
+	subFree->all = all;
+	subFree->groupId = groupId;
+
+	// Return
+	return subFree;
+}
+static void AlxParamMgmt_ValChangedSub_Free(AlxParamMgmt_ValChangedSub* sub)
+{
+	// If nothing is subscribed anymore, free subscription
+	if (sub->valChanged_Callback == NULL && sub->eventFlagGroup == NULL)
+	{
+		sub->isUsed = false;
+	}
+}
+static void AlxParamMgmt_Snapshot_PutLe(uint8_t* data, uint64_t val, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++)
+	{
+		data[i] = (uint8_t)(val >> (8 * i));
+	}
+}
+static uint64_t AlxParamMgmt_Snapshot_GetLe(uint8_t* data, uint32_t len)
+{
+	uint64_t val = 0;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		val = val | ((uint64_t)data[i] << (8 * i));
+	}
+	return val;
+}
+static void AlxParamMgmt_Snapshot_ValToLe(uint8_t* data, void* val, uint32_t valLen, uint8_t dataType)
+{
+	// Arr & Str are byte sequences
+	if ((dataType == AlxParamItem_Arr) || (dataType == AlxParamItem_Str))
+	{
+		memcpy(data, val, valLen);
+		return;
+	}
+
+	// Number, copied through integer of same size, so that byte order does not depend on CPU
+	if (valLen == 1)		{ uint8_t num = 0; memcpy(&num, val, valLen); AlxParamMgmt_Snapshot_PutLe(data, num, valLen); }
+	else if (valLen == 2)	{ uint16_t num = 0; memcpy(&num, val, valLen); AlxParamMgmt_Snapshot_PutLe(data, num, valLen); }
+	else if (valLen == 4)	{ uint32_t num = 0; memcpy(&num, val, valLen); AlxParamMgmt_Snapshot_PutLe(data, num, valLen); }
+	else if (valLen == 8)	{ uint64_t num = 0; memcpy(&num, val, valLen); AlxParamMgmt_Snapshot_PutLe(data, num, valLen); }
+	else					{ ALX_PARAM_MGMT_ASSERT(false); }	// We should never get here
+}
+static void AlxParamMgmt_Snapshot_LeToVal(void* val, uint8_t* data, uint32_t valLen, uint8_t dataType)
+{
+	// Arr & Str are byte sequences
+	if ((dataType == AlxParamItem_Arr) || (dataType == AlxParamItem_Str))
+	{
+		memcpy(val, data, valLen);
+		return;
+	}
+
+	// Number, copied through integer of same size, so that byte order does not depend on CPU
+	if (valLen == 1)		{ uint8_t num = (uint8_t)AlxParamMgmt_Snapshot_GetLe(data, valLen); memcpy(val, &num, valLen); }
+	else if (valLen == 2)	{ uint16_t num = (uint16_t)AlxParamMgmt_Snapshot_GetLe(data, valLen); memcpy(val, &num, valLen); }
+	else if (valLen == 4)	{ uint32_t num = (uint32_t)AlxParamMgmt_Snapshot_GetLe(data, valLen); memcpy(val, &num, valLen); }
+	else if (valLen == 8)	{ uint64_t num = AlxParamMgmt_Snapshot_GetLe(data, valLen); memcpy(val, &num, valLen); }
+	else					{ ALX_PARAM_MGMT_ASSERT(false); }	// We should never get here
+}
+static Alx_Status AlxParamMgmt_Snapshot_Stage(AlxParamMgmt* me, uint8_t* data, uint32_t len)
+{
+	// Local variables
+	uint32_t offset = ALX_PARAM_MGMT_SNAPSHOT_HEADER_LEN;
+	uint32_t numOfRecs = (uint32_t)AlxParamMgmt_Snapshot_GetLe(&data[2], 2);
+	memset(me->scratchBitmap, 0, ALX_PARAM_MGMT_BITMAP_WORD_LEN(me->numOfParamItems) * sizeof(uint32_t));	// Used as seen bitmap
+
+	// Loop through all records
+	for (uint32_t i = 0; i < numOfRecs; i++)
+	{
+		// Read record header
+		if (offset + ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN > len) { ALX_PARAM_MGMT_TRACE("Err: rec %lu len", i); return Alx_Err; }
+		uint32_t id = (uint32_t)AlxParamMgmt_Snapshot_GetLe(&data[offset], 4);
+		uint8_t dataType = (uint8_t)AlxParamMgmt_Snapshot_GetLe(&data[offset + 4], 1);
+		uint32_t valLen = (uint32_t)AlxParamMgmt_Snapshot_GetLe(&data[offset + 5], 2);
+		uint8_t* valLe = &data[offset + ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN];
+		offset = offset + ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN + valLen;
+		if (offset > len) { ALX_PARAM_MGMT_TRACE("Err: rec %lu len", i); return Alx_Err; }
+
+		// Find
+		AlxParamItem* ptr = AlxParamMgmt_FindById(me, id);
+		if (ptr == NULL) { ALX_PARAM_MGMT_TRACE("Err: id %lu not found", id); return Alx_Err; }
+
+		// Check record header
+		if (AlxParamItem_GetParamType(ptr) != AlxParamItem_Param) { ALX_PARAM_MGMT_TRACE("Err: id %lu not param", id); return Alx_Err; }
+		if (AlxParamItem_GetDataType(ptr) != dataType) { ALX_PARAM_MGMT_TRACE("Err: id %lu dataType", id); return Alx_Err; }
+		if (dataType == AlxParamItem_Str)
+		{
+			if ((valLen == 0) || (memchr(valLe, '\0', valLen) != &valLe[valLen - 1])) { ALX_PARAM_MGMT_TRACE("Err: id %lu str", id); return Alx_Err; }
+		}
+		else
+		{
+			if (valLen != AlxParamItem_GetValLen(ptr)) { ALX_PARAM_MGMT_TRACE("Err: id %lu valLen", id); return Alx_Err; }
+		}
+
+		// Check that id is not repeated, otherwise later record would silently override earlier one
+		uint32_t index = (uint32_t)(ptr - me->paramItemArr);
+		if (me->scratchBitmap[index / 32] & (1UL << (index % 32))) { ALX_PARAM_MGMT_TRACE("Err: id %lu repeated", id); return Alx_Err; }
+		me->scratchBitmap[index / 32] = me->scratchBitmap[index / 32] | (1UL << (index % 32));
+
+		// Check value, numbers are converted to CPU byte order first
+		if ((dataType == AlxParamItem_Arr) || (dataType == AlxParamItem_Str))
+		{
+			if (AlxParamItem_CheckVal(ptr, valLe) != Alx_Ok) { ALX_PARAM_MGMT_TRACE("Err: id %lu val", id); return Alx_Err; }
+		}
+		else
+		{
+			AlxParamItem_Val val = {};
+			AlxParamMgmt_Snapshot_LeToVal(&val, valLe, valLen, dataType);
+			if (AlxParamItem_CheckVal(ptr, &val) != Alx_Ok) { ALX_PARAM_MGMT_TRACE("Err: id %lu val", id); return Alx_Err; }
+		}
+	}
+
+	// Check that all data was used
+	if (offset != len) { ALX_PARAM_MGMT_TRACE("Err: len"); return Alx_Err; }
+
+	// Return
+	return Alx_Ok;
+}
+static void AlxParamMgmt_Snapshot_Apply(AlxParamMgmt* me, uint8_t* data, uint32_t len)
+{
+	// Local variables
+	uint32_t offset = ALX_PARAM_MGMT_SNAPSHOT_HEADER_LEN;
+	uint32_t numOfRecs = (uint32_t)AlxParamMgmt_Snapshot_GetLe(&data[2], 2);
+
+	// Loop through all records, snapshot was already staged, so all records are valid
+	for (uint32_t i = 0; i < numOfRecs; i++)
+	{
+		// Read record header
+		uint32_t id = (uint32_t)AlxParamMgmt_Snapshot_GetLe(&data[offset], 4);
+		uint8_t dataType = (uint8_t)AlxParamMgmt_Snapshot_GetLe(&data[offset + 4], 1);
+		uint32_t valLen = (uint32_t)AlxParamMgmt_Snapshot_GetLe(&data[offset + 5], 2);
+		uint8_t* valLe = &data[offset + ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN];
+		offset = offset + ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN + valLen;
+		ALX_PARAM_MGMT_ASSERT(offset <= len);
+
+		// Find
+		AlxParamItem* ptr = AlxParamMgmt_FindById(me, id);
+		ALX_PARAM_MGMT_ASSERT(ptr != NULL);
+
+		// Set
+		if (dataType == AlxParamItem_Str)
+		{
+			if (AlxParamItem_SetValStr(ptr, (char*)valLe) != Alx_Ok)
+			{
+				ALX_PARAM_MGMT_ASSERT(false);	// We should never get here, value was already checked
+			}
+		}
+		else if (dataType == AlxParamItem_Arr)
+		{
+			AlxParamItem_SetValRaw(ptr, valLe);
+		}
+		else
+		{
+			AlxParamItem_Val val = {};
+			AlxParamMgmt_Snapshot_LeToVal(&val, valLe, valLen, dataType);
+			AlxParamItem_SetValRaw(ptr, &val);
+		}
+	}
+}
+#if defined(ALX_PARAM_MGMT_INDEX)
+static void AlxParamMgmt_Index_Build(AlxParamMgmt* me)
+{
+	// Assert
+	ALX_PARAM_MGMT_ASSERT(me->numOfParamItems < ALX_PARAM_MGMT_INDEX_EMPTY);
+	ALX_PARAM_MGMT_ASSERT(me->keyIndexLen > me->numOfParamItems);
+
+	// Id index, insertion sort, which is O(n) if items are already ordered by id
+	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	{
+		uint32_t id = AlxParamItem_GetId(&me->paramItemArr[i]);
+		uint32_t j = i;
+		while (j > 0 && AlxParamItem_GetId(&me->paramItemArr[me->idIndex[j - 1]]) > id)
+		{
+			me->idIndex[j] = me->idIndex[j - 1];
+			j--;
+		}
+		ALX_PARAM_MGMT_ASSERT(j == 0 || AlxParamItem_GetId(&me->paramItemArr[me->idIndex[j - 1]]) != id);	// Id must be unique
+		me->idIndex[j] = (uint16_t)i;
+	}
+
+	// Key index, open addressing with linear probing
+	for (uint32_t i = 0; i < me->keyIndexLen; i++)
+	{
+		me->keyIndex[i] = ALX_PARAM_MGMT_INDEX_EMPTY;
+	}
+	for (uint32_t i = 0; i < me->numOfParamItems; i++)
+	{
+		const char* key = AlxParamItem_GetKey(&me->paramItemArr[i]);
+		uint32_t j = AlxGlobal_HashFnv1a(key) % me->keyIndexLen;
+		while (me->keyIndex[j] != ALX_PARAM_MGMT_INDEX_EMPTY)
+		{
+			ALX_PARAM_MGMT_ASSERT(strcmp(key, AlxParamItem_GetKey(&me->paramItemArr[me->keyIndex[j]])) != 0);	// Key must be unique
+			j = (j + 1) % me->keyIndexLen;
+		}
+		me->keyIndex[j] = (uint16_t)i;
+	}
+}
+#endif
 
 
 #endif // #if defined(ALX_C_LIB)
@@ -42,6 +42,8 @@ extern "C" {
 #include "alxGlobal.h"
 #include "alxTrace.h"
 #include "alxAssert.h"
+#include "alxCrc.h"
+#include "alxOsEventFlagGroup.h"
 #include "alxParamItem.h"
 
 
@@ -74,16 +76,55 @@ extern "C" {
 	#define ALX_PARAM_MGMT_TRACE(...) do{} while (false)
 #endif
 
+// Bitmap //
+#define ALX_PARAM_MGMT_BITMAP_WORD_LEN(numOfParamItems) (((numOfParamItems) + 31) / 32)
+#define ALX_PARAM_MGMT_BITMAP_LEN(numOfParamItems) (2 * ALX_PARAM_MGMT_BITMAP_WORD_LEN(numOfParamItems))	// Pending store bitmap & scratch bitmap, in uint32_t words
+
+// Defines
+#ifndef ALX_PARAM_MGMT_VAL_CHANGED_SUB_LEN
+	#define ALX_PARAM_MGMT_VAL_CHANGED_SUB_LEN 4	// Max number of group & global value changed subscriptions
+#endif
+
 
 //******************************************************************************
 // Types
 //******************************************************************************
 typedef struct
 {
+	bool isUsed;
+	bool all;
+	uint32_t groupId;
+	void (*valChanged_Callback)(void* ctx, uint32_t id, void* valOld, void* valNew);
+	void* valChanged_Callback_Ctx;
+	AlxOsEventFlagGroup* eventFlagGroup;
+	uint32_t eventFlags;
+} AlxParamMgmt_ValChangedSub;
+
+typedef struct
+{
+	// Defines
+	#define ALX_PARAM_MGMT_INDEX_EMPTY 0xFFFF
+	#define ALX_PARAM_MGMT_SNAPSHOT_VER 1
+	#define ALX_PARAM_MGMT_SNAPSHOT_HEADER_LEN 4		// ver (2) + numOfRecs (2), header, records & CRC are little-endian
+	#define ALX_PARAM_MGMT_SNAPSHOT_REC_HEADER_LEN 7	// id (4) + dataType (1) + valLen (2)
+
 	// Parameters
 	AlxParamItem* paramItemArr;
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	uint16_t* idIndex;		// Item indexes sorted by id, len must be numOfParamItems
+	uint16_t* keyIndex;		// Item indexes hashed by key, len must be greater than numOfParamItems, 2x numOfParamItems is recommended
+	uint32_t keyIndexLen;
+	#endif
+	uint32_t* bitmap;		// Len must be ALX_PARAM_MGMT_BITMAP_LEN(numOfParamItems)
 	uint32_t numOfParamItems;
 
+	// Variables
+	uint32_t* pendingStoreBitmap;	// Bit is set, if item has pending store, first half of bitmap
+	uint32_t* scratchBitmap;		// Bit is set, if item was stored in current batch or seen in staged snapshot, second half of bitmap
+	AlxParamItem_Owner owner;		// Set to all items, so that value changed subscriptions are kept here, not in each item
+	AlxParamMgmt_ValChangedSub valChangedSubArr[ALX_PARAM_MGMT_VAL_CHANGED_SUB_LEN];
+	AlxCrc snapshotCrc;
+
 	// Info
 	bool wasCtorCalled;
 } AlxParamMgmt;
@@ -96,6 +137,12 @@ void AlxParamMgmt_Ctor
 (
 	AlxParamMgmt* me,
 	AlxParamItem* paramItemArr,
+	#if defined(ALX_PARAM_MGMT_INDEX)
+	uint16_t* idIndex,
+	uint16_t* keyIndex,
+	uint32_t keyIndexLen,
+	#endif
+	uint32_t* bitmap,
 	uint32_t numOfParamItems
 );
 
@@ -123,6 +170,7 @@ const char*				AlxParamMgmt_ByIndex_GetGroupKey(AlxParamMgmt* me, uint32_t index
 uint32_t				AlxParamMgmt_ByIndex_GetGroupId(AlxParamMgmt* me, uint32_t index);
 void*					AlxParamMgmt_ByIndex_GetValPtr(AlxParamMgmt* me, uint32_t index);
 uint32_t				AlxParamMgmt_ByIndex_GetValLen(AlxParamMgmt* me, uint32_t index);
+uint32_t				AlxParamMgmt_ByIndex_GetValLenMax(AlxParamMgmt* me, uint32_t index);	// Str value can grow up to buffLen, others have fixed len
 Alx_Status				AlxParamMgmt_ByIndex_Get(AlxParamMgmt* me, uint32_t index, void* val, uint32_t len);	// TV: TODO
 Alx_Status				AlxParamMgmt_ByIndex_Set(AlxParamMgmt* me, uint32_t index, void* val, uint32_t len);	// TV: TODO
 Alx_Status				AlxParamMgmt_ByIndex_GetVal_StrFormat(AlxParamMgmt* me, uint32_t index, char* val, uint32_t maxLenWithNullTerm);
@@ -133,6 +181,7 @@ Alx_Status				AlxParamMgmt_ByIndex_SetVal_StrFormat(AlxParamMgmt* me, uint32_t i
 // By Key
 //------------------------------------------------------------------------------
 Alx_Status			AlxParamMgmt_ByKey_SetVal_StrFormat(AlxParamMgmt* me, char* key, char* val);
+Alx_Status			AlxParamMgmt_ByKey_GetIndex(AlxParamMgmt* me, const char* key, uint32_t* index);
 
 
 //------------------------------------------------------------------------------
@@ -141,6 +190,9 @@ Alx_Status			AlxParamMgmt_ByKey_SetVal_StrFormat(AlxParamMgmt* me, char* key, ch
 Alx_Status			AlxParamMgmt_ById_GetValLen(AlxParamMgmt* me, uint32_t id, uint32_t* valLen);
 Alx_Status			AlxParamMgmt_ById_Get(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len);
 Alx_Status			AlxParamMgmt_ById_Set(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len);
+Alx_Status			AlxParamMgmt_ById_CheckVal(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len);
+Alx_Status			AlxParamMgmt_ById_SetVal(AlxParamMgmt* me, uint32_t id, void* val, uint32_t len);
+Alx_Status			AlxParamMgmt_ById_GetIndex(AlxParamMgmt* me, uint32_t id, uint32_t* index);
 
 
 //------------------------------------------------------------------------------
@@ -159,6 +211,22 @@ Alx_Status AlxParamMgmt_StoreVal_Group(AlxParamMgmt* me, uint32_t groupId);
 Alx_Status AlxParamMgmt_StoreVal_All(AlxParamMgmt* me);
 
 
+//------------------------------------------------------------------------------
+// Value Changed
+//------------------------------------------------------------------------------
+void AlxParamMgmt_SetValChangedCallback_Group(AlxParamMgmt* me, uint32_t groupId, void (*valChanged_Callback)(void* ctx, uint32_t id, void* valOld, void* valNew), void* valChanged_Callback_Ctx);
+void AlxParamMgmt_SetValChangedCallback_All(AlxParamMgmt* me, void (*valChanged_Callback)(void* ctx, uint32_t id, void* valOld, void* valNew), void* valChanged_Callback_Ctx);
+void AlxParamMgmt_SetValChangedEventFlag_Group(AlxParamMgmt* me, uint32_t groupId, AlxOsEventFlagGroup* eventFlagGroup, uint32_t eventFlags);
+void AlxParamMgmt_SetValChangedEventFlag_All(AlxParamMgmt* me, AlxOsEventFlagGroup* eventFlagGroup, uint32_t eventFlags);
+
+
+//------------------------------------------------------------------------------
+// Snapshot
+//------------------------------------------------------------------------------
+Alx_Status AlxParamMgmt_ExportSnapshot(AlxParamMgmt* me, uint8_t* data, uint32_t lenMax, uint32_t* lenActual);
+Alx_Status AlxParamMgmt_ImportSnapshot(AlxParamMgmt* me, uint8_t* data, uint32_t len);
+
+
 #endif	// #if defined(ALX_C_LIB)
 
 #ifdef __cplusplus
@@ -41,9 +41,6 @@
 // Private Functions
 //******************************************************************************
 static bool AlxParamStore_IsParamGroupInitOk(AlxParamStore* me);
-static void AlxParamStore_Handle_1xGroup(AlxParamStore* me);
-static void AlxParamStore_Handle_2xGroup(AlxParamStore* me);
-static void AlxParamStore_Handle_4xGroup(AlxParamStore* me);
 
 
 //******************************************************************************
@@ -69,6 +66,7 @@ void AlxParamStore_Ctor
 
 	// Variables
 	me->st = AlxParamStore_St_Init;
+	me->paramGroupIndex = 0;
 	me->isParamGroupInitErr = false;
 
 	// Info
@@ -127,61 +125,13 @@ void AlxParamStore_Handle(AlxParamStore* me)
 	ALX_PARAM_STORE_ASSERT(me->wasCtorCalled == true);
 	ALX_PARAM_STORE_ASSERT(me->isInit == true);
 
-	// #1 Config
-	switch (me->numOfParamGroups)
+	// #1 Handle non-blocking memory of all groups
+	for (uint32_t i = 0; i < me->numOfParamGroups; i++)
 	{
-		case 1:
-		{
-			AlxParamStore_Handle_1xGroup(me);
-			break;
-		}
-		case 2:
-		{
-			AlxParamStore_Handle_2xGroup(me);
-			break;
-		}
-		case 4:
-		{
-			AlxParamStore_Handle_4xGroup(me);
-			break;
-		}
-		default:
-		{
-			ALX_PARAM_STORE_ASSERT(false);	// We should never get here
-			return;
-		}
+		AlxParamGroup_Handle(*(me->paramGroupArr + i));
 	}
-}
-
-/**
-  * @brief
-  * @param[in,out]	me
-  * @retval			false
-  * @retval			true
-  */
-bool AlxParamStore_IsErr(AlxParamStore* me)
-{
-	// Assert
-	ALX_PARAM_STORE_ASSERT(me->wasCtorCalled == true);
-	ALX_PARAM_STORE_ASSERT(me->isInit == true);
-
-	// #1 Return
-	if (me->st == AlxParamStore_St_Err)
-		return true;
-	else
-		return false;
-}
-
 
-//******************************************************************************
-// Private Functions
-//******************************************************************************
-static bool AlxParamStore_IsParamGroupInitOk(AlxParamStore* me)
-{
-	return !(me->isParamGroupInitErr);
-}
-static void AlxParamStore_Handle_1xGroup(AlxParamStore* me)
-{
+	// #2 Handle state, groups are checked one after another, only groups with changed values are refreshed & compared
 	switch (me->st)
 	{
 		case AlxParamStore_St_Init:
@@ -190,7 +140,7 @@ static void AlxParamStore_Handle_1xGroup(AlxParamStore* me)
 			if(AlxParamStore_IsParamGroupInitOk(me))
 			{
 				// #1.1 Change state
-				me->st = AlxParamStore_St_CheckingGroup1;
+				me->st = AlxParamStore_St_CheckingGroup;
 
 				// #1.2 Trace
 				ALX_PARAM_STORE_TRACE("InitOk");
@@ -208,222 +158,74 @@ static void AlxParamStore_Handle_1xGroup(AlxParamStore* me)
 			// #2 Break
 			break;
 		}
-		case AlxParamStore_St_CheckingGroup1:
+		case AlxParamStore_St_CheckingGroup:
 		{
-			// #1 Transition
-			if(AlxParamGroup_IsValStoredBuffDiff(me->paramGroupArr[0]))
+			// #1 Check groups, starting with current one, unchanged groups are skipped
+			for (uint32_t i = 0; i < me->numOfParamGroups; i++)
 			{
-				// #1.1 Prepare values to store
-				AlxParamGroup_ValBuffToValToStoreBuff(me->paramGroupArr[0]);
-
-				// #1.2 Start writing
-				AlxParamGroup_Write(me->paramGroupArr[0]);
-
-				// #1.3 Change state
-				me->st = AlxParamStore_St_WritingGroup1;
-
-				// #1.4 Trace
-				ALX_PARAM_STORE_TRACE("Group1_WriteStart");
-			}
-
-			// #2.1 Refresh values
-			AlxParamGroup_ParamItemsValToValBuff(me->paramGroupArr[0]);
-
-			// #3 Do Nothing
-
-			// #4 Break
-			break;
-		}
-		case AlxParamStore_St_WritingGroup1:
-		{
-			// #1 Transition
-			if(AlxParamGroup_IsWriteDone(me->paramGroupArr[0]))
-			{
-				// #1.1 Update stored values
-				AlxParamGroup_ValToStoreBuffToValStoredBuff(me->paramGroupArr[0]);
-
-				// #1.2 Change state
-				me->st = AlxParamStore_St_CheckingGroup1;
-
-				// #1.3 Trace
-				ALX_PARAM_STORE_TRACE("Group1_WriteDone");
+				// #1.1 Prepare variables
+				AlxParamGroup* paramGroup = *(me->paramGroupArr + me->paramGroupIndex);
+
+				// #1.2 Transition
+				if (AlxParamGroup_IsValChanged(paramGroup))
+				{
+					// #1.2.1 Refresh values
+					AlxParamGroup_ParamItemsValToValBuff(paramGroup);
+
+					// #1.2.2 Start writing, if values differ from stored
+					if (AlxParamGroup_IsValStoredBuffDiff(paramGroup))
+					{
+						AlxParamGroup_ValBuffToValToStoreBuff(paramGroup);
+						AlxParamGroup_Write(paramGroup);
+						me->st = AlxParamStore_St_WritingGroup;
+						ALX_PARAM_STORE_TRACE("Group%lu_WriteStart", me->paramGroupIndex + 1);
+						break;
+					}
+
+					// #1.2.3 Next group, only one group is refreshed per call
+					me->paramGroupIndex = (me->paramGroupIndex + 1) % me->numOfParamGroups;
+					break;
+				}
+
+				// #1.3 Next group
+				me->paramGroupIndex = (me->paramGroupIndex + 1) % me->numOfParamGroups;
 			}
 
-			// #2 Transition
-			else if(AlxParamGroup_IsWriteErr(me->paramGroupArr[0]))
-			{
-				// #2.1 Change state
-				me->st = AlxParamStore_St_Err;
-
-				// #2.2 Trace
-				ALX_PARAM_STORE_TRACE("Group1_Err");
-			}
-
-			// #3 Do Nothing
-
-			// #4 Break
-			break;
-		}
-		default:
-		{
-			// #1 Assert
-			ALX_PARAM_STORE_ASSERT(false); 	// We should never get here
-
 			// #2 Break
 			break;
 		}
-	}
-}
-static void AlxParamStore_Handle_2xGroup(AlxParamStore* me)
-{
-	switch (me->st)
-	{
-		case AlxParamStore_St_Init:
+		case AlxParamStore_St_WritingGroup:
 		{
-			// #1 Transition
-			if(AlxParamStore_IsParamGroupInitOk(me))
-			{
-				// #1.1 Change state
-				me->st = AlxParamStore_St_CheckingGroup1;
+			// #1 Prepare variables
+			AlxParamGroup* paramGroup = *(me->paramGroupArr + me->paramGroupIndex);
 
-				// #1.2 Trace
-				ALX_PARAM_STORE_TRACE("InitOk");
-			}
-
-			// #2 Do Nothing
-
-			// #3 Break
-			break;
-		}
-		case AlxParamStore_St_Err:
-		{
-			// #1 Do Nothing
-
-			// #2 Break
-			break;
-		}
-		case AlxParamStore_St_CheckingGroup1:
-		{
-			// #1 Transition
-			if(AlxParamGroup_IsValStoredBuffDiff(me->paramGroupArr[0]))
-			{
-				// #1.1 Prepare values to store
-				AlxParamGroup_ValBuffToValToStoreBuff(me->paramGroupArr[0]);
-
-				// #1.2 Start writing
-				AlxParamGroup_Write(me->paramGroupArr[0]);
-
-				// #1.3 Change state
-				me->st = AlxParamStore_St_WritingGroup1;
-
-				// #1.4 Trace
-				ALX_PARAM_STORE_TRACE("Group1_WriteStart");
-			}
 			// #2 Transition
-			else
+			if (AlxParamGroup_IsWriteDone(paramGroup))
 			{
-				// #2.1 Refresh values
-				AlxParamGroup_ParamItemsValToValBuff(me->paramGroupArr[0]);
-
-				// #2.2 Change state
-				me->st = AlxParamStore_St_CheckingGroup2;
-			}
-
-			// #3 Do Nothing
-
-			// #4 Break
-			break;
-		}
-		case AlxParamStore_St_WritingGroup1:
-		{
-			// #1 Transition
-			if (AlxParamGroup_IsWriteDone(me->paramGroupArr[0]))
-			{
-				// #1.1 Update stored values
-				AlxParamGroup_ValToStoreBuffToValStoredBuff(me->paramGroupArr[0]);
-
-				// #1.2 Change state
-				me->st = AlxParamStore_St_CheckingGroup2;
-
-				// #1.3 Trace
-				ALX_PARAM_STORE_TRACE("Group1_WriteDone");
-			}
-
-			// #2 Transition
-			else if (AlxParamGroup_IsWriteErr(me->paramGroupArr[0]))
-			{
-				// #2.1 Change state
-				me->st = AlxParamStore_St_Err;
+				// #2.1 Update stored values
+				AlxParamGroup_ValToStoreBuffToValStoredBuff(paramGroup);
 
 				// #2.2 Trace
-				ALX_PARAM_STORE_TRACE("Group1_Err");
-			}
-
-			// #3 Do Nothing
-
-			// #4 Break
-			break;
-		}
-		case AlxParamStore_St_CheckingGroup2:
-		{
-			// #1 Transition
-			if(AlxParamGroup_IsValStoredBuffDiff(me->paramGroupArr[1]))
-			{
-				// #1.1 Prepare values to store
-				AlxParamGroup_ValBuffToValToStoreBuff(me->paramGroupArr[1]);
-
-				// #1.2 Start writing
-				AlxParamGroup_Write(me->paramGroupArr[1]);
+				ALX_PARAM_STORE_TRACE("Group%lu_WriteDone", me->paramGroupIndex + 1);
 
-				// #1.3 Change state
-				me->st = AlxParamStore_St_WritingGroup2;
-
-				// #1.4 Trace
-				ALX_PARAM_STORE_TRACE("Group2_WriteStart");
-			}
-			// #2 Transition
-			else
-			{
-				// #2.1 Refresh values
-				AlxParamGroup_ParamItemsValToValBuff(me->paramGroupArr[1]);
-
-				// #2.2 Change state
-				me->st = AlxParamStore_St_CheckingGroup1;
-			}
-
-			// #3 Do Nothing
-
-			// #4 Break
-			break;
-		}
-		case AlxParamStore_St_WritingGroup2:
-		{
-			// #1 Transition
-			if (AlxParamGroup_IsWriteDone(me->paramGroupArr[1]))
-			{
-				// #1.1 Update stored values
-				AlxParamGroup_ValToStoreBuffToValStoredBuff(me->paramGroupArr[1]);
-
-				// #1.2 Change state
-				me->st = AlxParamStore_St_CheckingGroup1;
-
-				// #1.3 Trace
-				ALX_PARAM_STORE_TRACE("Group2_WriteDone");
+				// #2.3 Change state, continue with next group
+				me->paramGroupIndex = (me->paramGroupIndex + 1) % me->numOfParamGroups;
+				me->st = AlxParamStore_St_CheckingGroup;
 			}
 
-			// #2 Transition
-			else if (AlxParamGroup_IsWriteErr(me->paramGroupArr[1]))
+			// #3 Transition
+			else if (AlxParamGroup_IsWriteErr(paramGroup))
 			{
-				// #2.1 Change state
+				// #3.1 Change state
 				me->st = AlxParamStore_St_Err;
 
-				// #2.2 Trace
-				ALX_PARAM_STORE_TRACE("Group2_Err");
+				// #3.2 Trace
+				ALX_PARAM_STORE_TRACE("Group%lu_Err", me->paramGroupIndex + 1);
 			}
 
-			// #3 Do Nothing
+			// #4 Do Nothing
 
-			// #4 Break
+			// #5 Break
 			break;
 		}
 		default:
@@ -436,11 +238,33 @@ static void AlxParamStore_Handle_2xGroup(AlxParamStore* me)
 		}
 	}
 }
-static void AlxParamStore_Handle_4xGroup(AlxParamStore* me)
+
+/**
+  * @brief
+  * @param[in,out]	me
+  * @retval			false
+  * @retval			true
+  */
+bool AlxParamStore_IsErr(AlxParamStore* me)
 {
-	// TV: TODO
-	(void)me;
-	ALX_PARAM_STORE_ASSERT(false);
+	// Assert
+	ALX_PARAM_STORE_ASSERT(me->wasCtorCalled == true);
+	ALX_PARAM_STORE_ASSERT(me->isInit == true);
+
+	// #1 Return
+	if (me->st == AlxParamStore_St_Err)
+		return true;
+	else
+		return false;
+}
+
+
+//******************************************************************************
+// Private Functions
+//******************************************************************************
+static bool AlxParamStore_IsParamGroupInitOk(AlxParamStore* me)
+{
+	return !(me->isParamGroupInitErr);
 }
 
 
@@ -82,14 +82,16 @@ typedef enum
 {
 	AlxParamStore_St_Init = 0,
 	AlxParamStore_St_Err = 1,
-	AlxParamStore_St_CheckingGroup1 = 2,
-	AlxParamStore_St_CheckingGroup2 = 3,
-	AlxParamStore_St_CheckingGroup3 = 4,
-	AlxParamStore_St_CheckingGroup4 = 5,
-	AlxParamStore_St_WritingGroup1 = 6,
-	AlxParamStore_St_WritingGroup2 = 7,
-	AlxParamStore_St_WritingGroup3 = 8,
-	AlxParamStore_St_WritingGroup4 = 9
+	AlxParamStore_St_CheckingGroup1 = 2,	// Deprecated, NOT used anymore, kept so that existing values don't change, group is in paramGroupIndex
+	AlxParamStore_St_CheckingGroup2 = 3,	// Deprecated
+	AlxParamStore_St_CheckingGroup3 = 4,	// Deprecated
+	AlxParamStore_St_CheckingGroup4 = 5,	// Deprecated
+	AlxParamStore_St_WritingGroup1 = 6,		// Deprecated
+	AlxParamStore_St_WritingGroup2 = 7,		// Deprecated
+	AlxParamStore_St_WritingGroup3 = 8,		// Deprecated
+	AlxParamStore_St_WritingGroup4 = 9,		// Deprecated
+	AlxParamStore_St_CheckingGroup = 10,
+	AlxParamStore_St_WritingGroup = 11
 } AlxParamStore_St;
 
 typedef struct
@@ -100,6 +102,7 @@ typedef struct
 
 	// Variables
 	AlxParamStore_St st;
+	uint32_t paramGroupIndex;
 	bool isParamGroupInitErr;
 
 	// Info
@@ -52,6 +52,9 @@ Alx_Status AlxSd_SpiMode_SendCmd12(AlxSd* me);
 Alx_Status AlxSd_SpiMode_SendCmd13(AlxSd* me);
 Alx_Status AlxSd_SpiMode_SendCmd18(AlxSd* me, uint32_t addr);
 Alx_Status AlxSd_SpiMode_SendCmd25(AlxSd* me, uint32_t addr);
+Alx_Status AlxSd_SpiMode_SendCmd32(AlxSd* me, uint32_t addr);
+Alx_Status AlxSd_SpiMode_SendCmd33(AlxSd* me, uint32_t addr);
+Alx_Status AlxSd_SpiMode_SendCmd38(AlxSd* me);
 Alx_Status AlxSd_SpiMode_SendCmd58_SdIdle(AlxSd* me);
 Alx_Status AlxSd_SpiMode_SendCmd58_SdReady(AlxSd* me);
 Alx_Status AlxSd_SpiMode_SendAcmd23(AlxSd* me, uint32_t numOfBlocksToPreErase);
@@ -313,6 +316,52 @@ Alx_Status AlxSd_WriteBlock(AlxSd* me, uint32_t numOfBlocks, uint32_t addr, uint
 	}
 
 
+	//------------------------------------------------------------------------------
+	// Catch
+	//------------------------------------------------------------------------------
+
+	// Return
+	return Alx_ErrNumOfTries;
+}
+Alx_Status AlxSd_EraseBlock(AlxSd* me, uint32_t numOfBlocks, uint32_t addr, uint8_t numOfTries, uint16_t newTryWaitTime_ms)
+{
+	//------------------------------------------------------------------------------
+	// Prepare
+	//------------------------------------------------------------------------------
+
+	// Assert
+	ALX_SD_ASSERT(me->wasCtorCalled == true);
+	ALX_SD_ASSERT(me->isInit == true);
+	ALX_SD_ASSERT(numOfBlocks > 0);
+
+	// Local variables
+	Alx_Status status = Alx_Err;
+
+
+	//------------------------------------------------------------------------------
+	// Try
+	//------------------------------------------------------------------------------
+
+	// Try for number of tries
+	for (uint8_t _try = 1; _try <= numOfTries; _try++)
+	{
+		// Execute CMD32 SPI mode - Sends address of first block to erase
+		status = AlxSd_SpiMode_SendCmd32(me, addr);
+		if (status != Alx_Ok) { ALX_SD_TRACE_WRN("Err"); AlxDelay_ms(newTryWaitTime_ms); continue; }
+
+		// Execute CMD33 SPI mode - Sends address of last block to erase
+		status = AlxSd_SpiMode_SendCmd33(me, addr + numOfBlocks - 1);
+		if (status != Alx_Ok) { ALX_SD_TRACE_WRN("Err"); AlxDelay_ms(newTryWaitTime_ms); continue; }
+
+		// Execute CMD38 SPI mode - Discards selected blocks & waits until SD card is not busy
+		status = AlxSd_SpiMode_SendCmd38(me);
+		if (status != Alx_Ok) { ALX_SD_TRACE_WRN("Err"); AlxDelay_ms(newTryWaitTime_ms); continue; }
+
+		// Return
+		return Alx_Ok;
+	}
+
+
 	//------------------------------------------------------------------------------
 	// Catch
 	//------------------------------------------------------------------------------
@@ -716,6 +765,99 @@ Alx_Status AlxSd_SpiMode_SendCmd25(AlxSd* me, uint32_t addr)
 	// Return
 	return status;
 }
+Alx_Status AlxSd_SpiMode_SendCmd32(AlxSd* me, uint32_t addr)
+{
+	// Prepare
+	uint8_t cmd[6] = {};
+	cmd[0] = (0x40 | 32);	// 0x60
+	cmd[1] = addr >> 24;
+	cmd[2] = addr >> 16;
+	cmd[3] = addr >> 8;
+	cmd[4] = addr;
+	cmd[5] = 0x01;	// CRC not needed
+
+	// Return
+	uint8_t actualRespR1 = 0;
+	Alx_Status status = AlxSd_SpiMode_SendCmd(me, cmd, sizeof(cmd), 0xFF, 0x00, &actualRespR1, false, false, ALX_NULL_PTR, ALX_NULL);
+
+	// Return
+	return status;
+}
+Alx_Status AlxSd_SpiMode_SendCmd33(AlxSd* me, uint32_t addr)
+{
+	// Prepare
+	uint8_t cmd[6] = {};
+	cmd[0] = (0x40 | 33);	// 0x61
+	cmd[1] = addr >> 24;
+	cmd[2] = addr >> 16;
+	cmd[3] = addr >> 8;
+	cmd[4] = addr;
+	cmd[5] = 0x01;	// CRC not needed
+
+	// Return
+	uint8_t actualRespR1 = 0;
+	Alx_Status status = AlxSd_SpiMode_SendCmd(me, cmd, sizeof(cmd), 0xFF, 0x00, &actualRespR1, false, false, ALX_NULL_PTR, ALX_NULL);
+
+	// Return
+	return status;
+}
+Alx_Status AlxSd_SpiMode_SendCmd38(AlxSd* me)
+{
+	//------------------------------------------------------------------------------
+	// Prepare
+	//------------------------------------------------------------------------------
+
+	// Local variables
+	Alx_Status status = Alx_Err;
+	uint8_t cmd[6] = {};
+	uint8_t actualRespR1 = 0;
+	uint8_t rxByte = 0;
+
+
+	//------------------------------------------------------------------------------
+	// Try
+	//------------------------------------------------------------------------------
+	while (1)
+	{
+		// Prepare
+		cmd[0] = (0x40 | 38);	// 0x66
+		cmd[1] = 0x00;
+		cmd[2] = 0x00;
+		cmd[3] = 0x00;
+		cmd[4] = 0x01;	// Discard, cards older than SD 5.1 treat argument as stuff bits & perform erase
+		cmd[5] = 0x01;	// CRC not needed
+
+		// Send, busy is not handled by AlxSd_SpiMode_SendCmd, because erase busy time is much longer than cmdRespR1Timeout_ms
+		status = AlxSd_SpiMode_SendCmd(me, cmd, sizeof(cmd), 0xFF, 0x00, &actualRespR1, false, false, ALX_NULL_PTR, ALX_NULL);
+		if (status != Alx_Ok) { ALX_SD_TRACE_WRN("Err"); break; }
+
+		// Assert CS + Send sync byte
+		status = AlxSd_SpiMode_AssertCs_SendSyncByte(me);
+		if (status != Alx_Ok) { ALX_SD_TRACE_WRN("Err"); break; }
+
+		// Wait until SD card busy
+		status = AlxSd_SpiMode_WaitByte(me, 0xFF, 0x00, false, ALX_SD_ERASE_BUSY_TIMEOUT_MS, &rxByte);
+		if (status != Alx_Ok) { ALX_SD_TRACE_WRN("Err"); break; }
+
+		// Send sync byte + DeAssert CS
+		status = AlxSd_SpiMode_SendSyncByte_DeAssertCs(me);
+		if (status != Alx_Ok) { ALX_SD_TRACE_WRN("Err"); break; }
+
+		// Return
+		return Alx_Ok;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Catch
+	//------------------------------------------------------------------------------
+
+	// DeAssert CS
+	AlxSpi_Master_DeAssertCs(me->alxSpi);
+
+	// Return
+	return Alx_Err;
+}
 Alx_Status AlxSd_SpiMode_SendCmd58_SdIdle(AlxSd* me)
 {
 	// Prepare
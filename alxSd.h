@@ -84,6 +84,7 @@ typedef struct
 	// Defines
 	#define ALX_SD_DATA_0xFF_LEN 520
 	#define ALX_SD_BLOCK_LEN 512
+	#define ALX_SD_ERASE_BUSY_TIMEOUT_MS 10000	// Erase busy time depends on number of erased blocks & card, so it is much longer than busy time of other commands
 
 	// Const
 	uint8_t DATA_0xFF[ALX_SD_DATA_0xFF_LEN];
@@ -129,6 +130,7 @@ Alx_Status AlxSd_Init(AlxSd* me, uint8_t numOfTries, uint16_t newTryWaitTime_ms)
 Alx_Status AlxSd_DeInit(AlxSd* me, uint8_t numOfTries, uint16_t newTryWaitTime_ms);
 Alx_Status AlxSd_ReadBlock(AlxSd* me, uint32_t numOfBlocks, uint32_t addr, uint8_t* data, uint32_t len, uint8_t numOfTries, uint16_t newTryWaitTime_ms);
 Alx_Status AlxSd_WriteBlock(AlxSd* me, uint32_t numOfBlocks, uint32_t addr, uint8_t* data, uint32_t len, uint8_t numOfTries, uint16_t newTryWaitTime_ms);
+Alx_Status AlxSd_EraseBlock(AlxSd* me, uint32_t numOfBlocks, uint32_t addr, uint8_t numOfTries, uint16_t newTryWaitTime_ms);
 
 
 #endif	// #if defined(ALX_C_LIB)